@@ -18,9 +18,19 @@
 %ignore vrv::Toolkit::ResetLogBuffer( );
 %ignore vrv::Toolkit::SetShowBoundingBoxes( bool );
 %ignore vrv::Toolkit::SetCString( const std::string & );
+%ignore vrv::SetLogCallback;
+%ignore vrv::Toolkit::SetLogCallbackUserData;
+%ignore vrv::PAEBatchRecord;
+%ignore vrv::Toolkit::RenderPAEBatchStream;
+%ignore vrv::Toolkit::WriteMEI;
+%ignore vrv::Toolkit::RenderToMIDIBuffer;
+%ignore vrv::Toolkit::RenderToTimemapBuffer;
+%ignore vrv::Toolkit::GetCBuffer;
 
 %module verovio
 %include "std_string.i"
+%include "std_vector.i"
+%template(StringVector) std::vector<std::string>;
 %include "../../include/vrv/toolkit.h"
 %include "../../include/vrv/toolkitdef.h"
 
@@ -18,6 +18,55 @@
 %ignore vrv::Toolkit::ResetLogBuffer( );
 %ignore vrv::Toolkit::SetShowBoundingBoxes( bool );
 %ignore vrv::Toolkit::SetCString( const std::string & );
+%ignore vrv::SetLogCallback;
+%ignore vrv::Toolkit::SetLogCallbackUserData;
+%ignore vrv::PAEBatchRecord;
+%ignore vrv::Toolkit::RenderPAEBatchStream;
+%ignore vrv::Toolkit::WriteMEI;
+%ignore vrv::Toolkit::GetCBuffer;
+
+// Release the GIL in the methods loading, laying out, rendering or exporting a document, so that toolkits can be
+// used concurrently from Python threads (one toolkit per thread - see vrv::Toolkit).
+// The methods going through humlib, which has global state, release it as well since the toolkit serializes them
+// with a mutex (see vrv::Toolkit), and keeping the GIL while waiting for it would block the other Python threads.
+%nothread;
+%thread vrv::Toolkit::ConvertHumdrumToHumdrum;
+%thread vrv::Toolkit::ConvertMEIToHumdrum;
+%thread vrv::Toolkit::Edit;
+%thread vrv::Toolkit::GetDescriptiveFeatures;
+%thread vrv::Toolkit::GetElementsAttr;
+%thread vrv::Toolkit::GetElementsInTimeRange;
+%thread vrv::Toolkit::GetHumdrum;
+%thread vrv::Toolkit::GetHumdrumFile;
+%thread vrv::Toolkit::GetMEI;
+%thread vrv::Toolkit::GetMIDIValuesForElements;
+%thread vrv::Toolkit::GetPagesWithElements;
+%thread vrv::Toolkit::GetTimesForElements;
+%thread vrv::Toolkit::LoadData;
+%thread vrv::Toolkit::LoadFile;
+%thread vrv::Toolkit::LoadZipDataBase64;
+%thread vrv::Toolkit::RedoLayout;
+%thread vrv::Toolkit::RedoPagePitchPosLayout;
+%thread vrv::Toolkit::RenderAllToSVG;
+%thread vrv::Toolkit::RenderData;
+%thread vrv::Toolkit::RenderPAEBatch;
+%thread vrv::Toolkit::RenderPagesToSVG;
+%thread vrv::Toolkit::RenderToExpansionMap;
+%thread vrv::Toolkit::RenderToExpansionMapFile;
+%thread vrv::Toolkit::RenderToMIDI;
+%thread vrv::Toolkit::RenderToMIDIBuffer;
+%thread vrv::Toolkit::RenderToMIDIFile;
+%thread vrv::Toolkit::RenderToPAE;
+%thread vrv::Toolkit::RenderToPAEFile;
+%thread vrv::Toolkit::RenderToSVG;
+%thread vrv::Toolkit::RenderToSVGFile;
+%thread vrv::Toolkit::RenderToTimemap;
+%thread vrv::Toolkit::RenderToTimemapBuffer;
+%thread vrv::Toolkit::RenderToTimemapFile;
+%thread vrv::Toolkit::SaveFile;
+%thread vrv::Toolkit::Select;
+%thread vrv::Toolkit::ValidatePAE;
+%thread vrv::Toolkit::ValidatePAEFile;
 
 %feature("autodoc", "1");
 
@@ -71,6 +120,13 @@ def getElementAttr(toolkit, xml_id: str) -> dict:
     return json.loads($action(toolkit, xml_id))
 %}
 
+// Toolkit::GetElementsAttr
+%feature("shadow") vrv::Toolkit::GetElementsAttr(const std::string &) %{
+def getElementsAttr(toolkit, query: Union[list, dict]) -> dict:
+    """Return the attributes of a list of elements as a dictionary keyed by ID."""
+    return json.loads($action(toolkit, json.dumps(query)))
+%}
+
 // Toolkit::GetElementsAtTime
 %feature("shadow") vrv::Toolkit::GetElementsAtTime(int) %{
 def getElementsAtTime(toolkit, millisec: int) -> dict:
@@ -78,6 +134,13 @@ def getElementsAtTime(toolkit, millisec: int) -> dict:
     return json.loads($action(toolkit, millisec))
 %}
 
+// Toolkit::GetElementsInTimeRange
+%feature("shadow") vrv::Toolkit::GetElementsInTimeRange(const std::string &) %{
+def getElementsInTimeRange(toolkit, options: dict) -> dict:
+    """Return array of IDs of elements being played within a time range."""
+    return json.loads($action(toolkit, json.dumps(options)))
+%}
+
 // Toolkit::GetExpansionIdsForElement
 %feature("shadow") vrv::Toolkit::GetExpansionIdsForElement(const std::string &) %{
 def getExpansionIdsForElement(toolkit, xml_id: str) -> dict:
@@ -101,6 +164,13 @@ def getMIDIValuesForElement(toolkit, xml_id: str) -> dict:
     return json.loads($action(toolkit, xml_id))
 %}
 
+// Toolkit::GetMIDIValuesForElements
+%feature("shadow") vrv::Toolkit::GetMIDIValuesForElements(const std::string &) %{
+def getMIDIValuesForElements(toolkit, query: Union[list, dict]) -> dict:
+    """Return the MIDI values of a list of elements as a dictionary keyed by ID."""
+    return json.loads($action(toolkit, json.dumps(query)))
+%}
+
 // Toolkit::GetOptions
 %feature("shadow") vrv::Toolkit::GetOptions() const %{
 def getOptions(toolkit) -> dict:
@@ -108,6 +178,13 @@ def getOptions(toolkit) -> dict:
     return json.loads($action(toolkit))
 %}
 
+// Toolkit::GetPagesWithElements
+%feature("shadow") vrv::Toolkit::GetPagesWithElements(const std::string &) %{
+def getPagesWithElements(toolkit, query: Union[list, dict]) -> dict:
+    """Return the page of a list of elements as a dictionary keyed by ID."""
+    return json.loads($action(toolkit, json.dumps(query)))
+%}
+
 // Toolkit::GetTimesForElement
 %feature("shadow") vrv::Toolkit::GetTimesForElement(const std::string &) %{
 def getTimesForElement(toolkit, xml_id: str) -> dict:
@@ -115,6 +192,13 @@ def getTimesForElement(toolkit, xml_id: str) -> dict:
     return json.loads($action(toolkit, xml_id))
 %}
 
+// Toolkit::GetTimesForElements
+%feature("shadow") vrv::Toolkit::GetTimesForElements(const std::string &) %{
+def getTimesForElements(toolkit, query: Union[list, dict]) -> dict:
+    """Return the times of a list of elements as a dictionary keyed by ID."""
+    return json.loads($action(toolkit, json.dumps(query)))
+%}
+
 // Toolkit::RedoLayout
 %feature("shadow") vrv::Toolkit::RedoLayout(const std::string & = "") %{
 def redoLayout(toolkit, options: Optional[dict] = None) -> None:
@@ -131,6 +215,17 @@ def renderData(toolkit, data, options: dict) -> str:
     return $action(toolkit, data, json.dumps(options))
 %}
 
+// Toolkit::RenderPAEBatch
+%feature("shadow") vrv::Toolkit::RenderPAEBatch(const std::string &, const std::string & = "") %{
+def renderPAEBatch(toolkit, records: Union[list, str], options: Optional[dict] = None) -> list:
+    """Render a batch of Plaine & Easie incipits to SVG."""
+    if options is None:
+        options = {}
+    if not isinstance(records, str):
+        records = json.dumps(records)
+    return json.loads($action(toolkit, records, json.dumps(options)))
+%}
+
 // Toolkit::RenderToExpansionMap
 %feature("shadow") vrv::Toolkit::RenderToExpansionMap() %{
 def renderToExpansionMap(toolkit) -> list:
@@ -145,13 +240,34 @@ def renderToExpansionMapFile(toolkit, filename: str) -> bool:
     return $action(toolkit, filename)
 %}
 
+// Toolkit::RenderToMIDIBuffer
+%feature("shadow") vrv::Toolkit::RenderToMIDIBuffer(std::vector<unsigned char> &) %{
+def renderToMIDIBuffer(toolkit) -> bytes:
+    """Render the document to MIDI as bytes."""
+    return $action(toolkit)
+%}
+
 // Toolkit::RenderToTimemap
 %feature("shadow") vrv::Toolkit::RenderToTimemap(const std::string & = "") %{
-def renderToTimemap(toolkit, options: Optional[dict] = None) -> list:
-    """Render a document to a timemap."""
+def renderToTimemap(toolkit, options: Optional[dict] = None) -> Union[list, dict, str]:
+    """Render a document to a timemap.
+
+    The binary format is returned as a base64-encoded string."""
     if options is None:
         options = {}
-    return json.loads($action(toolkit, json.dumps(options)))
+    output = $action(toolkit, json.dumps(options))
+    if options.get("format") == "binary":
+        return output
+    return json.loads(output)
+%}
+
+// Toolkit::RenderToTimemapBuffer
+%feature("shadow") vrv::Toolkit::RenderToTimemapBuffer(std::vector<unsigned char> &, const std::string & = "") %{
+def renderToTimemapBuffer(toolkit, options: Optional[dict] = None) -> bytes:
+    """Render a document to a timemap in the compact binary encoding as bytes."""
+    if options is None:
+        options = {}
+    return $action(toolkit, json.dumps(options))
 %}
 
 // Toolkit::RenderToTimemapFile
@@ -195,8 +311,20 @@ def validatePAE(toolkit, data: Union[str, dict]) -> dict:
     return json.loads($action(toolkit, data))
 %}
 
-%module(package="verovio") verovio
+%module(package="verovio", threads="1") verovio
 %include "std_string.i"
+%include "std_vector.i"
+%template(StringVector) std::vector<std::string>;
+
+// The MIDI buffer is returned as bytes instead of being passed as an argument
+%typemap(in, numinputs=0) std::vector<unsigned char> &output (std::vector<unsigned char> temp) {
+    $1 = &temp;
+}
+%typemap(argout) std::vector<unsigned char> &output {
+    Py_XDECREF($result);
+    $result = PyBytes_FromStringAndSize(reinterpret_cast<const char *>($1->data()), $1->size());
+}
+
 %include "../../include/vrv/toolkit.h"
 %include "../../include/vrv/toolkitdef.h"
 
@@ -0,0 +1,95 @@
+// Counts the heap allocations of loading the same data repeatedly with the recycleMemory option and fails when the
+// steady-state count of LoadData is above a threshold. The allocations of RenderToSVG are reported as well.
+// The default threshold is set for ../doc/importer.mei with about 10% of margin and has to be adjusted for other files.
+// Only the arena blocks of the objects are recycled, so most of the allocations are for the content of the objects.
+//
+// The check is built with the command-line tool (BUILD_CHECKS option) and run by CTest from the cmake directory.
+// Otherwise, build the library with -DBUILD_AS_LIBRARY=ON and run from the build directory:
+//   g++ -O2 -std=c++17 -I../include -I../include/vrv -I../include/crc -I../include/hum -I../include/json
+//     -I../include/midi -I../include/pugi -I../include/zip -I../libmei/dist -I../libmei/addons
+//     ../doc/allocation-check.cpp -L. -lverovio -o allocation-check
+//   ./allocation-check [file.mei] [threshold] [repeat]
+
+#include <algorithm>
+#include <atomic>
+#include <cstdio>
+#include <cstdlib>
+#include <fstream>
+#include <new>
+#include <sstream>
+#include <string>
+
+//----------------------------------------------------------------------------
+
+#include "toolkit.h"
+#include "vrv.h"
+
+static std::atomic<long> allocationCount(0);
+
+void *operator new(std::size_t size)
+{
+    ++allocationCount;
+    if (void *ptr = std::malloc(size ? size : 1)) return ptr;
+    throw std::bad_alloc();
+}
+
+void operator delete(void *ptr) noexcept
+{
+    std::free(ptr);
+}
+
+void operator delete(void *ptr, std::size_t) noexcept
+{
+    std::free(ptr);
+}
+
+int main(int argc, char **argv)
+{
+    const std::string filename = (argc > 1) ? argv[1] : "../doc/importer.mei";
+    const long threshold = (argc > 2) ? atol(argv[2]) : 10300;
+    const int repeat = (argc > 3) ? std::max(atoi(argv[3]), 1) : 5;
+
+    std::ifstream file(filename);
+    if (!file.is_open()) {
+        fprintf(stderr, "Cannot open %s\n", filename.c_str());
+        return 1;
+    }
+    std::stringstream data;
+    data << file.rdbuf();
+
+    vrv::EnableLog(vrv::LOG_OFF);
+
+    vrv::Toolkit toolkit(false);
+    if (!toolkit.SetResourcePath("../data")) {
+        fprintf(stderr, "Cannot load the resources from ../data\n");
+        return 1;
+    }
+    toolkit.SetOptions("{\"recycleMemory\": true}");
+
+    // the first loads fill the recycled memory and the caches
+    long loadCount = 0;
+    long renderCount = 0;
+    for (int i = 0; i < 2 + repeat; ++i) {
+        long start = allocationCount;
+        if (!toolkit.LoadData(data.str())) {
+            fprintf(stderr, "Cannot load %s\n", filename.c_str());
+            return 1;
+        }
+        const long load = allocationCount - start;
+        start = allocationCount;
+        toolkit.RenderToSVG(1);
+        const long render = allocationCount - start;
+        if (i < 2) continue;
+        // keep the maximum to catch allocations that are not made at every load
+        loadCount = std::max(loadCount, load);
+        renderCount = std::max(renderCount, render);
+    }
+
+    printf("LoadData %ld allocation(s) (threshold %ld), RenderToSVG %ld allocation(s)\n", loadCount, threshold,
+        renderCount);
+    if (loadCount > threshold) {
+        printf("LoadData allocates more than the threshold\n");
+        return 1;
+    }
+    return 0;
+}
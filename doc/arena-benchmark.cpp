@@ -0,0 +1,81 @@
+// Times the MEI import and the reset of a document with the objects allocated on the heap and in the arena of the
+// document. The two variants are interleaved and the minimum, median and maximum of each are reported.
+//
+// Build the library with -DBUILD_AS_LIBRARY=ON and run from the build directory:
+//   g++ -O2 -std=c++17 -I../include -I../include/vrv -I../include/crc -I../include/hum -I../include/json
+//     -I../include/midi -I../include/pugi -I../include/zip -I../libmei/dist -I../libmei/addons
+//     ../doc/arena-benchmark.cpp -L. -lverovio -o arena-benchmark
+//   ./arena-benchmark file.mei [repeat]
+
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <fstream>
+#include <memory>
+#include <sstream>
+#include <string>
+#include <vector>
+
+//----------------------------------------------------------------------------
+
+#include "doc.h"
+#include "iomei.h"
+#include "object.h"
+#include "vrv.h"
+
+using Clock = std::chrono::steady_clock;
+
+static double Milliseconds(Clock::time_point start, Clock::time_point end)
+{
+    return std::chrono::duration<double, std::milli>(end - start).count();
+}
+
+static void Report(const char *name, std::vector<double> &times)
+{
+    std::sort(times.begin(), times.end());
+    printf("%s min %.1f median %.1f max %.1f ms", name, times.front(), times.at(times.size() / 2), times.back());
+}
+
+int main(int argc, char **argv)
+{
+    if (argc < 2) {
+        fprintf(stderr, "Usage: %s file.mei [repeat]\n", argv[0]);
+        return 1;
+    }
+    const int repeat = (argc > 2) ? std::max(atoi(argv[2]), 1) : 11;
+
+    std::ifstream file(argv[1]);
+    std::stringstream data;
+    data << file.rdbuf();
+
+    vrv::EnableLog(vrv::LOG_OFF);
+
+    std::vector<double> importTimes[2];
+    std::vector<double> resetTimes[2];
+    for (int i = 0; i < repeat; ++i) {
+        for (int useArena = 0; useArena < 2; ++useArena) {
+            vrv::Doc doc;
+            std::unique_ptr<vrv::ObjectArenaScope> arenaScope;
+            if (useArena) arenaScope = std::make_unique<vrv::ObjectArenaScope>(doc.GetArena());
+
+            const Clock::time_point start = Clock::now();
+            vrv::MEIInput input(&doc);
+            input.Import(data.str());
+            const Clock::time_point imported = Clock::now();
+            doc.Reset();
+            const Clock::time_point reset = Clock::now();
+
+            importTimes[useArena].push_back(Milliseconds(start, imported));
+            resetTimes[useArena].push_back(Milliseconds(imported, reset));
+        }
+    }
+
+    for (int useArena = 0; useArena < 2; ++useArena) {
+        printf("%s: ", useArena ? "arena" : "heap ");
+        Report("import", importTimes[useArena]);
+        printf(", ");
+        Report("reset", resetTimes[useArena]);
+        printf("\n");
+    }
+    return 0;
+}
@@ -0,0 +1,153 @@
+# This script is expected to be run from the build directory of the library (-DBUILD_AS_LIBRARY=ON)
+# It times the round-trips through the AttConverterBase StrTo* and *ToStr converters generated with lookup tables
+# against the chained comparisons generated before. The previous converters are taken from a git revision of
+# libmei/dist/attconverter.cpp and compiled in the same driver with the class renamed to OldAttConverterBase.
+# The two variants are interleaved and the minimum, median and maximum of each are reported.
+#   python3 ../doc/attconverter-benchmark.py [revision] [--repeat N]
+import argparse
+import os
+import re
+import subprocess
+import sys
+import tempfile
+
+root = os.path.join(os.path.dirname(os.path.abspath(__file__)), '..')
+
+includes = ['include', 'include/vrv', 'include/crc', 'include/hum', 'include/json', 'include/midi', 'include/pugi',
+            'include/zip', 'libmei/dist', 'libmei/addons']
+
+driver = '''
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <string>
+#include <vector>
+
+#include "attconverter.h"
+#include "attconverter-old.h"
+#include "vrv.h"
+
+using namespace vrv;
+using Clock = std::chrono::steady_clock;
+
+static std::vector<double> s_times[2];
+static long s_roundTrips = 0;
+static int s_mismatches = 0;
+
+// Every value of the enum and an unknown one, converted from a string and back
+template <typename T>
+void RoundTrips(int max, int repeat, std::string (AttConverterBase::*toStr)(T) const,
+    T (AttConverterBase::*strTo)(const std::string &, bool) const, std::string (OldAttConverterBase::*oldToStr)(T) const,
+    T (OldAttConverterBase::*oldStrTo)(const std::string &, bool) const)
+{{
+    static const AttConverter converter;
+    static const OldAttConverterBase oldConverter;
+    std::vector<std::string> values;
+    for (int i = 1; i < max; ++i) values.push_back((converter.*toStr)((T)i));
+    values.push_back("unknown-value");
+    s_roundTrips += (long)values.size() * repeat;
+
+    size_t check[2] = {{ 0, 0 }};
+    for (int useOld = 0; useOld < 2; ++useOld) {{
+        const Clock::time_point start = Clock::now();
+        for (int i = 0; i < repeat; ++i) {{
+            for (const std::string &value : values) {{
+                const std::string result = (useOld) ? (oldConverter.*oldToStr)((oldConverter.*oldStrTo)(value, false))
+                                                    : (converter.*toStr)((converter.*strTo)(value, false));
+                check[useOld] += result.size();
+                if ((i == 0) && (result != ((value == "unknown-value") ? "" : value))) ++s_mismatches;
+            }}
+        }}
+        s_times[useOld].push_back(std::chrono::duration<double, std::nano>(Clock::now() - start).count());
+    }}
+    if (check[0] != check[1]) ++s_mismatches;
+}}
+
+static void Report(const char *name, std::vector<double> &totals, long roundTrips)
+{{
+    std::sort(totals.begin(), totals.end());
+    printf("%s min %.1f median %.1f max %.1f ns per round-trip\\n", name, totals.front() / roundTrips,
+        totals.at(totals.size() / 2) / roundTrips, totals.back() / roundTrips);
+}}
+
+int main(int argc, char **argv)
+{{
+    const int repeat = (argc > 1) ? std::max(atoi(argv[1]), 1) : 11;
+    EnableLog(LOG_OFF);
+
+    std::vector<double> totals[2];
+    long roundTrips = 0;
+    for (int r = 0; r < repeat; ++r) {{
+        s_times[0].clear();
+        s_times[1].clear();
+        s_roundTrips = 0;
+{calls}
+        for (int useOld = 0; useOld < 2; ++useOld) {{
+            double total = 0.0;
+            for (double time : s_times[useOld]) total += time;
+            totals[useOld].push_back(total);
+        }}
+        roundTrips = s_roundTrips;
+    }}
+
+    printf("%d converters, %ld round-trips per run\\n", {count}, roundTrips);
+    Report("tables: ", totals[0], roundTrips);
+    Report("chained:", totals[1], roundTrips);
+    if (s_mismatches > 0) {{
+        printf("%d round-trip(s) with different results\\n", s_mismatches);
+        return 1;
+    }}
+    return 0;
+}}
+'''
+
+
+def old_sources(revision, header):
+    """
+    Returns the header and the source of the converters at the revision with the class renamed.
+    The declarations are the ones of the current header since the signatures did not change.
+    """
+    source = subprocess.run(['git', '-C', root, 'show', f'{revision}:libmei/dist/attconverter.cpp'],
+                            check=True, capture_output=True, text=True).stdout
+    source = source.replace('AttConverterBase::', 'OldAttConverterBase::')
+    source = source.replace('#include "attconverter.h"', '#include "attconverter-old.h"')
+
+    declaration = re.search(r'class AttConverterBase \{.*?\n\};', header, re.S).group(0)
+    declaration = declaration.replace('AttConverterBase', 'OldAttConverterBase').replace('protected:', 'public:')
+    old_header = '#include <string>\n\n#include "attdef.h"\n\nnamespace vrv {\n\n' + declaration + '\n\n} // namespace vrv\n'
+    return old_header, source
+
+
+if __name__ == '__main__':
+    parser = argparse.ArgumentParser()
+    parser.add_argument('revision', nargs='?', default='version-4.1.0',
+                        help='git revision with the chained comparisons (default: version-4.1.0)')
+    parser.add_argument('--build-dir', default='.', help='directory of the verovio library')
+    parser.add_argument('--repeat', type=int, default=11)
+    args = parser.parse_args()
+
+    with open(os.path.join(root, 'libmei/dist/attconverter.h')) as file:
+        header = file.read()
+    converters = re.findall(r'std::string (\w+)ToStr\((\w+) data\) const;', header)
+    calls = '\n'.join(
+        f'        RoundTrips<{type}>({type.removeprefix("data_")}_MAX, 100, &AttConverterBase::{name}ToStr, '
+        f'&AttConverterBase::StrTo{name}, &OldAttConverterBase::{name}ToStr, &OldAttConverterBase::StrTo{name});'
+        for name, type in converters)
+
+    old_header, old_source = old_sources(args.revision, header)
+    build_dir = os.path.abspath(args.build_dir)
+    with tempfile.TemporaryDirectory() as tmp:
+        files = {'attconverter-old.h': old_header, 'attconverter-old.cpp': old_source,
+                 'attconverter-benchmark.cpp': driver.format(calls=calls, count=len(converters))}
+        for name, content in files.items():
+            with open(os.path.join(tmp, name), 'w') as file:
+                file.write(content)
+        binary = os.path.join(tmp, 'attconverter-benchmark')
+        command = [os.environ.get('CXX', 'g++'), '-O2', '-std=c++17', f'-I{tmp}']
+        command += [f'-I{os.path.join(root, include)}' for include in includes]
+        command += [os.path.join(tmp, 'attconverter-benchmark.cpp'), os.path.join(tmp, 'attconverter-old.cpp')]
+        command += [f'-L{build_dir}', '-lverovio', f'-Wl,-rpath,{build_dir}', '-lpthread', '-o', binary]
+        print('Compiling the converters of ' + args.revision)
+        subprocess.run(command, check=True)
+        sys.exit(subprocess.run([binary, str(args.repeat)]).returncode)
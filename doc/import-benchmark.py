@@ -0,0 +1,59 @@
+# This script is expected to be run from ./bindings/python
+# It times the import of every MusicXML file found in a corpus directory
+import argparse
+import os
+import statistics
+import sys
+import time
+
+# Add path for toolkit built in-place
+sys.path.append('.')
+import verovio
+
+extensions = ('.musicxml', '.xml', '.mxl')
+
+benchmarkOptions = {
+    'breaks': 'none',
+    'header': 'none',
+    'footer': 'none'
+}
+
+if __name__ == '__main__':
+    parser = argparse.ArgumentParser()
+    parser.add_argument('corpus_dir')
+    parser.add_argument('--repeat', type=int, default=3)
+    args = parser.parse_args()
+
+    # version of the toolkit
+    tk = verovio.toolkit(False)
+    print(f'Verovio {tk.getVersion()}')
+
+    tk.setResourcePath('../../data')
+    tk.setOptions(benchmarkOptions)
+    verovio.enableLog(verovio.LOG_OFF)
+
+    path = args.corpus_dir.replace("\\ ", " ")
+    files = []
+    for root, dirs, items in os.walk(path):
+        for item in items:
+            if item.endswith(extensions):
+                files.append(os.path.join(root, item))
+    files.sort()
+
+    total = 0.0
+    for file in files:
+        timings = []
+        for i in range(args.repeat):
+            start = time.perf_counter()
+            loaded = tk.loadFile(file)
+            timings.append(time.perf_counter() - start)
+        if not loaded:
+            print(f'{os.path.relpath(file, path)}: could not be loaded')
+            continue
+        best = min(timings)
+        total += best
+        size = os.path.getsize(file) / (1024 * 1024)
+        print(f'{os.path.relpath(file, path)}: {size:.2f} MB, {tk.getPageCount()} page(s), '
+              f'best {best:.3f} s, median {statistics.median(timings):.3f} s')
+
+    print(f'{len(files)} file(s), total {total:.3f} s')
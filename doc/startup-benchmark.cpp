@@ -0,0 +1,68 @@
+// Times the startup of a toolkit, which loads the fonts of the resource directory, with the XML files and with the
+// binary font packs. The two variants are interleaved and the minimum, median and maximum of each are reported.
+// The toolkit is deleted after each startup so that the fonts are not shared between two of them.
+//
+// Build the library with -DBUILD_AS_LIBRARY=ON and run from the build directory with a copy of the data directory
+// that includes the packs:
+//   g++ -O2 -std=c++17 -I../include -I../include/vrv -I../include/crc -I../include/hum -I../include/json
+//     -I../include/midi -I../include/pugi -I../include/zip -I../libmei/dist -I../libmei/addons
+//     ../doc/startup-benchmark.cpp -L. -lverovio -o startup-benchmark
+//   cp -r ../data data-packs && python3 ../fonts/generate_pack.py --data data-packs
+//   ./startup-benchmark ../data data-packs [repeat]
+
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <string>
+#include <vector>
+
+//----------------------------------------------------------------------------
+
+#include "toolkit.h"
+#include "vrv.h"
+
+using Clock = std::chrono::steady_clock;
+
+static double Milliseconds(Clock::time_point start, Clock::time_point end)
+{
+    return std::chrono::duration<double, std::milli>(end - start).count();
+}
+
+static void Report(const char *name, std::vector<double> &times)
+{
+    std::sort(times.begin(), times.end());
+    printf("%s min %.2f median %.2f max %.2f ms\n", name, times.front(), times.at(times.size() / 2), times.back());
+}
+
+int main(int argc, char **argv)
+{
+    if (argc < 3) {
+        fprintf(stderr, "Usage: %s xml_data_dir pack_data_dir [repeat]\n", argv[0]);
+        return 1;
+    }
+    const std::string paths[2] = { argv[1], argv[2] };
+    const int repeat = (argc > 3) ? std::max(atoi(argv[3]), 1) : 21;
+
+    // a stale pack is reported as a warning
+    vrv::EnableLog(vrv::LOG_WARNING);
+
+    std::vector<double> times[2];
+    for (int i = 0; i < repeat; ++i) {
+        for (int usePacks = 0; usePacks < 2; ++usePacks) {
+            const Clock::time_point start = Clock::now();
+            {
+                vrv::Toolkit toolkit(false);
+                if (!toolkit.SetResourcePath(paths[usePacks])) {
+                    fprintf(stderr, "Cannot load the resources from %s\n", paths[usePacks].c_str());
+                    return 1;
+                }
+            }
+            times[usePacks].push_back(Milliseconds(start, Clock::now()));
+        }
+    }
+
+    Report("xml:  ", times[0]);
+    Report("packs:", times[1]);
+    return 0;
+}
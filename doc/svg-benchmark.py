@@ -0,0 +1,88 @@
+# This script is expected to be run from ./bindings/python
+# It times the rendering of every MEI file found in a corpus directory with the default DOM SVG writer and with the
+# streaming one (svgStreaming option), and checks that both produce byte-identical SVG for every page
+import argparse
+import os
+import sys
+import time
+
+# Add path for toolkit built in-place
+sys.path.append('.')
+import verovio
+
+extensions = ('.mei', )
+
+benchmarkOptions = {
+    'header': 'none',
+    'footer': 'none'
+}
+
+variants = [
+    {},
+    {'svgFormatRaw': True},
+    {'svgHtml5': True, 'svgViewBox': True},
+    {'svgBoundingBoxes': True, 'outputIndentTab': True}
+]
+
+
+def render(tk, file, streaming, repeat):
+    pages = []
+    best = None
+    for i in range(repeat):
+        # re-seed the ids and reload so both writers start from the same state
+        tk.setOptions({'svgStreaming': streaming, 'xmlIdSeed': 1})
+        tk.loadFile(file)
+        start = time.perf_counter()
+        pages = [tk.renderToSVG(page, True) for page in range(1, tk.getPageCount() + 1)]
+        elapsed = time.perf_counter() - start
+        best = elapsed if best is None else min(best, elapsed)
+    return pages, best
+
+
+if __name__ == '__main__':
+    parser = argparse.ArgumentParser()
+    parser.add_argument('corpus_dir')
+    parser.add_argument('--repeat', type=int, default=3)
+    args = parser.parse_args()
+
+    # version of the toolkit
+    tk = verovio.toolkit(False)
+    print(f'Verovio {tk.getVersion()}')
+
+    tk.setResourcePath('../../data')
+    verovio.enableLog(verovio.LOG_OFF)
+
+    path = args.corpus_dir.replace("\\ ", " ")
+    files = []
+    for root, dirs, items in os.walk(path):
+        for item in items:
+            if item.endswith(extensions):
+                files.append(os.path.join(root, item))
+    files.sort()
+
+    totalDom = 0.0
+    totalStream = 0.0
+    mismatches = 0
+    for file in files:
+        for variant in variants:
+            tk.resetOptions()
+            tk.setOptions(benchmarkOptions)
+            tk.setOptions(variant)
+            if not tk.loadFile(file):
+                print(f'{os.path.relpath(file, path)}: could not be loaded')
+                break
+            domPages, domTime = render(tk, file, False, args.repeat)
+            streamPages, streamTime = render(tk, file, True, args.repeat)
+            for page, (dom, stream) in enumerate(zip(domPages, streamPages), 1):
+                if dom != stream:
+                    mismatches += 1
+                    print(f'{os.path.relpath(file, path)} {variant}: page {page} differs')
+            # only time the default options
+            if not variant:
+                totalDom += domTime
+                totalStream += streamTime
+                print(f'{os.path.relpath(file, path)}: {len(domPages)} page(s), '
+                      f'DOM {domTime * 1000:.1f} ms, streaming {streamTime * 1000:.1f} ms')
+
+    print(f'{len(files)} file(s), DOM {totalDom:.3f} s, streaming {totalStream:.3f} s, {mismatches} mismatch(es)')
+    sys.exit(1 if mismatches else 0)
@@ -0,0 +1,90 @@
+# This script is expected to be run from ./bindings/python
+# It times the rendering of every file found in a corpus directory with an increasing number of threads,
+# each thread using its own toolkit, and reports the speedup over a single thread
+import argparse
+import concurrent.futures
+import os
+import sys
+import time
+
+# Add path for toolkit built in-place
+sys.path.append('.')
+import verovio
+
+extensions = ('.mei', '.musicxml', '.xml', '.mxl', '.abc', '.pae')
+
+benchmarkOptions = {
+    'breaks': 'auto',
+    'header': 'none',
+    'footer': 'none'
+}
+
+
+def create_toolkit():
+    # Create the toolkit in the main thread, the default resource path being kept per thread
+    tk = verovio.toolkit(False)
+    tk.setResourcePath('../../data')
+    tk.setOptions(benchmarkOptions)
+    return tk
+
+
+def render_files(tk, files):
+    pages = 0
+    for file in files:
+        if not tk.loadFile(file):
+            continue
+        for page in range(1, tk.getPageCount() + 1):
+            tk.renderToSVG(page)
+            pages += 1
+        tk.renderToMIDI()
+    return pages
+
+
+def run(files, thread_count):
+    toolkits = [create_toolkit() for _ in range(thread_count)]
+    # Distribute the files in a round-robin to have a similar amount of work in each thread
+    chunks = [files[i::thread_count] for i in range(thread_count)]
+    start = time.perf_counter()
+    with concurrent.futures.ThreadPoolExecutor(max_workers=thread_count) as executor:
+        pages = sum(executor.map(render_files, toolkits, chunks))
+    return time.perf_counter() - start, pages
+
+
+if __name__ == '__main__':
+    parser = argparse.ArgumentParser()
+    parser.add_argument('corpus_dir')
+    parser.add_argument('--max-threads', type=int, default=os.cpu_count())
+    parser.add_argument('--repeat', type=int, default=3)
+    args = parser.parse_args()
+
+    print(f'Verovio {verovio.toolkit(False).getVersion()}')
+    verovio.enableLog(verovio.LOG_OFF)
+
+    path = args.corpus_dir.replace("\\ ", " ")
+    files = []
+    for root, dirs, items in os.walk(path):
+        for item in items:
+            if item.endswith(extensions):
+                files.append(os.path.join(root, item))
+    files.sort()
+    print(f'{len(files)} file(s), {os.cpu_count()} CPU(s)')
+
+    thread_counts = []
+    thread_count = 1
+    while thread_count < args.max_threads:
+        thread_counts.append(thread_count)
+        thread_count *= 2
+    thread_counts.append(args.max_threads)
+
+    reference = None
+    for thread_count in thread_counts:
+        timings = []
+        for i in range(args.repeat):
+            elapsed, pages = run(files, thread_count)
+            timings.append(elapsed)
+        best = min(timings)
+        if reference is None:
+            reference = best
+        speedup = reference / best
+        print(f'{thread_count} thread(s): {pages} page(s), best {best:.3f} s, '
+              f'speedup {speedup:.2f}, efficiency {speedup / thread_count:.0%}')
@@ -0,0 +1,72 @@
+// This script is expected to be run from ./emscripten/npm after running ../buildNpmPackage
+// It times the layout and the rendering of a score with the single-threaded and the multithreaded WebAssembly
+// modules, and reports the speedup of the multithreaded module over the single-threaded one
+//
+// Usage: node ../../doc/wasm-thread-benchmark.mjs score.mei [--repeat 3]
+import fs from "node:fs";
+import os from "node:os";
+import { performance } from "node:perf_hooks";
+
+import { VerovioToolkit, enableLog, LOG_OFF } from "./dist/verovio.mjs";
+import createVerovioModule from "./dist/verovio-module.mjs";
+import createVerovioModuleThreads from "./dist/verovio-module-threads.mjs";
+
+const benchmarkOptions = {
+    breaks: "auto",
+    header: "none",
+    footer: "none",
+};
+
+function run(VerovioModule, score, threads) {
+    const tk = new VerovioToolkit(VerovioModule);
+    tk.setOptions({ ...benchmarkOptions, threads: threads });
+    // The systems are laid out vertically when loading the data
+    let start = performance.now();
+    tk.loadData(score);
+    const layout = performance.now() - start;
+    start = performance.now();
+    const pages = tk.renderPagesToSVG();
+    const rendering = performance.now() - start;
+    tk.destroy();
+    return { layout, rendering, pages: pages.length };
+}
+
+function best(VerovioModule, score, threads, repeat) {
+    let result = null;
+    for (let i = 0; i < repeat; ++i) {
+        const timing = run(VerovioModule, score, threads);
+        if (!result || (timing.layout + timing.rendering < result.layout + result.rendering)) result = timing;
+    }
+    return result;
+}
+
+const args = process.argv.slice(2);
+const repeatIdx = args.indexOf("--repeat");
+const repeat = (repeatIdx >= 0) ? parseInt(args.splice(repeatIdx, 2)[1]) : 3;
+if (args.length !== 1) {
+    console.log("Usage: node wasm-thread-benchmark.mjs score.mei [--repeat 3]");
+    process.exit(1);
+}
+const score = fs.readFileSync(args[0]).toString();
+
+const VerovioModule = await createVerovioModule();
+const VerovioModuleThreads = await createVerovioModuleThreads();
+enableLog(LOG_OFF, VerovioModule);
+enableLog(LOG_OFF, VerovioModuleThreads);
+
+const cpus = os.cpus().length;
+const tk = new VerovioToolkit(VerovioModule);
+console.log(`Verovio ${tk.getVersion()}, ${cpus} CPU(s)`);
+tk.destroy();
+
+const reference = best(VerovioModule, score, 1, repeat);
+const runs = [
+    ["single-threaded module", reference],
+    ["multithreaded module, 1 thread", best(VerovioModuleThreads, score, 1, repeat)],
+    [`multithreaded module, ${cpus} threads`, best(VerovioModuleThreads, score, 0, repeat)],
+];
+for (const [name, timing] of runs) {
+    const speedup = (reference.layout + reference.rendering) / (timing.layout + timing.rendering);
+    console.log(`${name}: ${timing.pages} page(s), layout ${timing.layout.toFixed(0)} ms, ` +
+        `rendering ${timing.rendering.toFixed(0)} ms, speedup ${speedup.toFixed(2)}`);
+}
@@ -36,9 +36,15 @@ function getToolkitFunction(VerovioModule, method) {
     // char *getElementAttr(Toolkit *ic, const char *xmlId)
     mapping.getElementAttr = VerovioModule.cwrap("vrvToolkit_getElementAttr", "string", ["number", "string"]);
 
+    // char *getElementsAttr(Toolkit *ic, const char *query)
+    mapping.getElementsAttr = VerovioModule.cwrap("vrvToolkit_getElementsAttr", "string", ["number", "string"]);
+
     // char *getElementsAtTime(Toolkit *ic, int time)
     mapping.getElementsAtTime = VerovioModule.cwrap("vrvToolkit_getElementsAtTime", "string", ["number", "number"]);
 
+    // char *getElementsInTimeRange(Toolkit *ic, const char *options)
+    mapping.getElementsInTimeRange = VerovioModule.cwrap("vrvToolkit_getElementsInTimeRange", "string", ["number", "string"]);
+
     // char *vrvToolkit_getExpansionIdsForElement(Toolkit *tk, const char *xmlId);
     mapping.getExpansionIdsForElement = VerovioModule.cwrap("vrvToolkit_getExpansionIdsForElement", "string", ["number", "string"]);
 
@@ -72,15 +78,24 @@ function getToolkitFunction(VerovioModule, method) {
     // int getPageWithElement(Toolkit *ic, const char *xmlId)
     mapping.getPageWithElement = VerovioModule.cwrap("vrvToolkit_getPageWithElement", "number", ["number", "string"]);
 
+    // char *getPagesWithElements(Toolkit *ic, const char *query)
+    mapping.getPagesWithElements = VerovioModule.cwrap("vrvToolkit_getPagesWithElements", "string", ["number", "string"]);
+
     // double getTimeForElement(Toolkit *ic, const char *xmlId)
     mapping.getTimeForElement = VerovioModule.cwrap("vrvToolkit_getTimeForElement", "number", ["number", "string"]);
 
     // char *getTimesForElement(Toolkit *ic, const char *xmlId)
     mapping.getTimesForElement = VerovioModule.cwrap("vrvToolkit_getTimesForElement", "string", ["number", "string"]);
 
+    // char *getTimesForElements(Toolkit *ic, const char *query)
+    mapping.getTimesForElements = VerovioModule.cwrap("vrvToolkit_getTimesForElements", "string", ["number", "string"]);
+
     // char *getMIDIValuesForElement(Toolkit *ic, const char *xmlId)
     mapping.getMIDIValuesForElement = VerovioModule.cwrap("vrvToolkit_getMIDIValuesForElement", "string", ["number", "string"]);
 
+    // char *getMIDIValuesForElements(Toolkit *ic, const char *query)
+    mapping.getMIDIValuesForElements = VerovioModule.cwrap("vrvToolkit_getMIDIValuesForElements", "string", ["number", "string"]);
+
     // char *getVersion(Toolkit *ic)
     mapping.getVersion = VerovioModule.cwrap("vrvToolkit_getVersion", "string", ["number"]);
 
@@ -102,12 +117,21 @@ function getToolkitFunction(VerovioModule, method) {
     // char *renderData(Toolkit *ic, const char *data, const char *options)
     mapping.renderData = VerovioModule.cwrap("vrvToolkit_renderData", "string", ["number", "string", "string"]);
 
+    // char *renderPAEBatch(Toolkit *ic, const char *records, const char *options)
+    mapping.renderPAEBatch = VerovioModule.cwrap("vrvToolkit_renderPAEBatch", "string", ["number", "string", "string"]);
+
+    // char *renderPagesToSVG(Toolkit *ic, int firstPageNo, int lastPageNo, int xmlDeclaration)
+    mapping.renderPagesToSVG = VerovioModule.cwrap("vrvToolkit_renderPagesToSVG", "string", ["number", "number", "number", "number"]);
+
     // char *renderToExpansionMap(Toolkit *ic)
     mapping.renderToExpansionMap = VerovioModule.cwrap("vrvToolkit_renderToExpansionMap", "string", ["number"]);
 
     // char *renderToMIDI(Toolkit *ic, const char *rendering_options)
     mapping.renderToMIDI = VerovioModule.cwrap("vrvToolkit_renderToMIDI", "string", ["number", "string"]);
 
+    // unsigned char *renderToMIDIBuffer(Toolkit *ic, const char *rendering_options, int *length)
+    mapping.renderToMIDIBuffer = VerovioModule.cwrap("vrvToolkit_renderToMIDIBuffer", "number", ["number", "string", "number"]);
+
     // char *renderToPAE(Toolkit *ic)
     mapping.renderToPAE = VerovioModule.cwrap("vrvToolkit_renderToPAE", "string");
 
@@ -117,6 +141,9 @@ function getToolkitFunction(VerovioModule, method) {
     // char *renderToTimemap(Toolkit *ic)
     mapping.renderToTimemap = VerovioModule.cwrap("vrvToolkit_renderToTimemap", "string", ["number", "string"]);
 
+    // unsigned char *renderToTimemapBuffer(Toolkit *ic, const char *options, int *length)
+    mapping.renderToTimemapBuffer = VerovioModule.cwrap("vrvToolkit_renderToTimemapBuffer", "number", ["number", "string", "number"]);
+
     // void resetOptions(Toolkit *ic)
     mapping.resetOptions = VerovioModule.cwrap("vrvToolkit_resetOptions", null, ["number"]);
 
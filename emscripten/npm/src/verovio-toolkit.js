@@ -42,10 +42,18 @@ export class VerovioToolkit {
         return JSON.parse(this.proxy.getElementAttr(this.ptr, xmlId));
     }
 
+    getElementsAttr(query) {
+        return JSON.parse(this.proxy.getElementsAttr(this.ptr, JSON.stringify(query)));
+    }
+
     getElementsAtTime(millisec) {
         return JSON.parse(this.proxy.getElementsAtTime(this.ptr, millisec));
     }
 
+    getElementsInTimeRange(options) {
+        return JSON.parse(this.proxy.getElementsInTimeRange(this.ptr, JSON.stringify(options)));
+    }
+
     getExpansionIdsForElement(xmlId) {
         return JSON.parse(this.proxy.getExpansionIdsForElement(this.ptr, xmlId));
     }
@@ -78,6 +86,10 @@ export class VerovioToolkit {
         return JSON.parse(this.proxy.getMIDIValuesForElement(this.ptr, xmlId));
     }
 
+    getMIDIValuesForElements(query) {
+        return JSON.parse(this.proxy.getMIDIValuesForElements(this.ptr, JSON.stringify(query)));
+    }
+
     getNotatedIdForElement(xmlId) {
         return this.proxy.getNotatedIdForElement(this.ptr, xmlId);
     }
@@ -104,6 +116,10 @@ export class VerovioToolkit {
         return this.proxy.getPageWithElement(this.ptr, xmlId);
     }
 
+    getPagesWithElements(query) {
+        return JSON.parse(this.proxy.getPagesWithElements(this.ptr, JSON.stringify(query)));
+    }
+
     getTimeForElement(xmlId) {
         return this.proxy.getTimeForElement(this.ptr, xmlId);
     }
@@ -112,6 +128,10 @@ export class VerovioToolkit {
         return JSON.parse(this.proxy.getTimesForElement(this.ptr, xmlId));
     }
 
+    getTimesForElements(query) {
+        return JSON.parse(this.proxy.getTimesForElements(this.ptr, JSON.stringify(query)));
+    }
+
     getVersion() {
         return this.proxy.getVersion(this.ptr);
     }
@@ -150,6 +170,15 @@ export class VerovioToolkit {
         return this.proxy.renderData(this.ptr, data, JSON.stringify(options));
     }
 
+    renderPAEBatch(records, options = {}) {
+        if (typeof records !== "string") records = JSON.stringify(records);
+        return JSON.parse(this.proxy.renderPAEBatch(this.ptr, records, JSON.stringify(options)));
+    }
+
+    renderPagesToSVG(firstPageNo = 1, lastPageNo = this.getPageCount(), xmlDeclaration = false) {
+        return JSON.parse(this.proxy.renderPagesToSVG(this.ptr, firstPageNo, lastPageNo, xmlDeclaration));
+    }
+
     renderToExpansionMap() {
         return JSON.parse(this.proxy.renderToExpansionMap(this.ptr));
     }
@@ -158,6 +187,15 @@ export class VerovioToolkit {
         return this.proxy.renderToMIDI(this.ptr, JSON.stringify(options));
     }
 
+    renderToMIDIBuffer(options) {
+        // The returned array is a view over the module memory and is valid until the next call to the toolkit
+        var lengthPtr = this.VerovioModule._malloc(4);
+        var dataPtr = this.proxy.renderToMIDIBuffer(this.ptr, JSON.stringify(options), lengthPtr);
+        var length = new Int32Array(this.VerovioModule.HEAPU8.buffer, lengthPtr, 1)[0];
+        this.VerovioModule._free(lengthPtr);
+        return new Uint8Array(this.VerovioModule.HEAPU8.buffer, dataPtr, length);
+    }
+
     renderToPAE() {
         return this.proxy.renderToPAE(this.ptr);
     }
@@ -167,7 +205,18 @@ export class VerovioToolkit {
     }
 
     renderToTimemap(options = {}) {
-        return JSON.parse(this.proxy.renderToTimemap(this.ptr, JSON.stringify(options)));
+        const output = this.proxy.renderToTimemap(this.ptr, JSON.stringify(options));
+        // The binary format is returned as a base64-encoded string
+        return (options.format === "binary") ? output : JSON.parse(output);
+    }
+
+    renderToTimemapBuffer(options = {}) {
+        // The returned array is a view over the module memory and is valid until the next call to the toolkit
+        var lengthPtr = this.VerovioModule._malloc(4);
+        var dataPtr = this.proxy.renderToTimemapBuffer(this.ptr, JSON.stringify(options), lengthPtr);
+        var length = new Int32Array(this.VerovioModule.HEAPU8.buffer, lengthPtr, 1)[0];
+        this.VerovioModule._free(lengthPtr);
+        return new Uint8Array(this.VerovioModule.HEAPU8.buffer, dataPtr, length);
     }
 
     resetOptions() {
@@ -0,0 +1,209 @@
+"""
+Compiles the bounding box XML files of the fonts in the Verovio data directory into binary font packs
+(e.g., `Leipzig.vrvfont`) that the toolkit can memory-map at startup instead of parsing the XML files.
+
+For SMuFL fonts, the pack also includes the XML definition of every glyph (`Leipzig/E050.xml`).
+Text fonts (`text/Times.xml`) only include the bounding boxes.
+
+The layout must match the one expected by the FontPack class in `src/resources.cpp`. All values are little-endian:
+
+    header:  magic "VRVFONT\\0", version, units-per-em, glyph count, anchor count, string data offset, size,
+             size and 32-bit FNV-1a hash of the content of the bounding box XML file
+    glyphs:  code, x, y, w, h, h-a-x, flags, (offset, length) for the code string, name and definition,
+             first anchor, anchor count
+    anchors: (offset, length) for the name, x, y
+    strings: UTF-8 data referenced by (offset, length) from the string data offset
+"""
+
+import logging
+import struct
+import sys
+import xml.etree.ElementTree as Et
+from argparse import ArgumentParser, Namespace
+from pathlib import Path
+from typing import Optional
+
+PACK_MAGIC: bytes = b"VRVFONT\0"
+PACK_VERSION: int = 3
+PACK_EXTENSION: str = ".vrvfont"
+
+HEADER_FORMAT: str = "<8s8I"
+GLYPH_FORMAT: str = "<I5fI8I"
+ANCHOR_FORMAT: str = "<2I2f"
+
+FLAG_HORIZ_ADV_X: int = 0x1
+
+SMUFL_FONTS: list = ["Bravura", "Gootville", "Leipzig", "Leland", "Petaluma"]
+TEXT_FONTS: list = ["Times", "Times-bold", "Times-bold-italic", "Times-italic"]
+
+log = logging.getLogger(__name__)
+
+
+class StringTable:
+    def __init__(self) -> None:
+        self.data: bytearray = bytearray()
+
+    def add(self, value: bytes) -> tuple:
+        offset: int = len(self.data)
+        self.data.extend(value)
+        return offset, len(value)
+
+
+def __fnv1a(data: bytes) -> int:
+    value: int = 2166136261
+    for byte in data:
+        value = ((value ^ byte) * 16777619) & 0xFFFFFFFF
+    return value
+
+
+def __attr_float(element: Et.Element, name: str) -> float:
+    value: Optional[str] = element.get(name)
+    return float(value) if value is not None else 0.0
+
+
+def pack_font(xml_path: Path, glyph_dir: Optional[Path], out_path: Path) -> bool:
+    """
+    Writes the pack for one bounding box file. Glyphs are kept in the order of the XML file since later
+    definitions replace earlier ones when loaded. The size and the content hash of the XML file are stored
+    so that the toolkit falls back to the XML files when the pack is out of date.
+    """
+    try:
+        xml_content: bytes = xml_path.read_bytes()
+        root: Et.Element = Et.fromstring(xml_content)
+    except (OSError, Et.ParseError) as e:
+        log.error("Could not read %s: %s", xml_path, e)
+        return False
+
+    units_per_em: Optional[str] = root.get("units-per-em")
+    if units_per_em is None:
+        log.error("No units-per-em attribute in %s", xml_path)
+        return False
+
+    strings = StringTable()
+    glyphs: list = []
+    anchors: list = []
+
+    for g in root.findall("g"):
+        code_str: Optional[str] = g.get("c")
+        name: Optional[str] = g.get("n")
+        # SMuFL fonts require a name, the text fonts only a code
+        if code_str is None or (glyph_dir is not None and name is None):
+            continue
+
+        definition: bytes = b""
+        if glyph_dir is not None:
+            glyph_path: Path = glyph_dir / f"{code_str}.xml"
+            if glyph_path.exists():
+                definition = glyph_path.read_bytes()
+            else:
+                log.warning("Missing glyph definition %s", glyph_path)
+
+        flags: int = 0
+        horiz_adv_x: float = 0.0
+        if g.get("h-a-x") is not None:
+            flags |= FLAG_HORIZ_ADV_X
+            horiz_adv_x = __attr_float(g, "h-a-x")
+
+        first_anchor: int = len(anchors)
+        for a in g.findall("a"):
+            anchor_name: Optional[str] = a.get("n")
+            if anchor_name is None:
+                continue
+            anchors.append(
+                struct.pack(
+                    ANCHOR_FORMAT,
+                    *strings.add(anchor_name.encode("utf-8")),
+                    __attr_float(a, "x"),
+                    __attr_float(a, "y"),
+                )
+            )
+
+        glyphs.append(
+            struct.pack(
+                GLYPH_FORMAT,
+                int(code_str, 16),
+                __attr_float(g, "x"),
+                __attr_float(g, "y"),
+                __attr_float(g, "w"),
+                __attr_float(g, "h"),
+                horiz_adv_x,
+                flags,
+                *strings.add(code_str.encode("utf-8")),
+                *strings.add((name or "").encode("utf-8")),
+                *strings.add(definition),
+                first_anchor,
+                len(anchors) - first_anchor,
+            )
+        )
+
+    strings_offset: int = (
+        struct.calcsize(HEADER_FORMAT)
+        + len(glyphs) * struct.calcsize(GLYPH_FORMAT)
+        + len(anchors) * struct.calcsize(ANCHOR_FORMAT)
+    )
+    header: bytes = struct.pack(
+        HEADER_FORMAT,
+        PACK_MAGIC,
+        PACK_VERSION,
+        int(float(units_per_em)),
+        len(glyphs),
+        len(anchors),
+        strings_offset,
+        len(strings.data),
+        len(xml_content) & 0xFFFFFFFF,
+        __fnv1a(xml_content),
+    )
+
+    out_path.parent.mkdir(parents=True, exist_ok=True)
+    with open(out_path, "wb") as f:
+        f.write(header)
+        f.write(b"".join(glyphs))
+        f.write(b"".join(anchors))
+        f.write(strings.data)
+
+    log.info("Wrote %s with %d glyphs", out_path, len(glyphs))
+    return True
+
+
+def generate_packs(opts: Namespace) -> bool:
+    data: Path = Path(opts.data)
+    output: Path = Path(opts.output) if opts.output else data
+    res: bool = True
+
+    for fontname in opts.fonts or SMUFL_FONTS:
+        res &= pack_font(data / f"{fontname}.xml", data / fontname, output / f"{fontname}{PACK_EXTENSION}")
+
+    if not opts.fonts:
+        for fontname in TEXT_FONTS:
+            res &= pack_font(
+                data / "text" / f"{fontname}.xml", None, output / "text" / f"{fontname}{PACK_EXTENSION}"
+            )
+
+    return res
+
+
+if __name__ == "__main__":
+    cli = ArgumentParser(
+        description="Compiles the fonts of the Verovio data directory into binary font packs."
+    )
+    cli.add_argument("--debug", help="Run the command with debug output.", action="store_true")
+    cli.add_argument("--data", help="Path to the Verovio data directory", default="../data")
+    cli.add_argument("--output", help="Output directory (default is the data directory)")
+    cli.add_argument(
+        "fonts",
+        nargs="*",
+        help="The SMuFL fonts to compile (default is all the fonts, including the text fonts)",
+    )
+
+    cmd_opts: Namespace = cli.parse_args()
+
+    logging.basicConfig(
+        format="[%(asctime)s] [%(levelname)8s] %(message)s (%(filename)s:%(lineno)s)",
+        level=logging.DEBUG if cmd_opts.debug else logging.WARNING,
+    )
+
+    if not generate_packs(cmd_opts):
+        log.error("An error has occurred.")
+        sys.exit(1)
+
+    sys.exit(0)
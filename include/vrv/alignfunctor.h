@@ -104,6 +104,11 @@ public:
      */
     void StoreCastOffSystemWidths(bool storeWidths) { m_storeCastOffSystemWidths = storeWidths; }
 
+    /*
+     * Set if the cached width of measures should be used when available
+     */
+    void UseCachedWidths(bool useCachedWidths) { m_useCachedWidths = useCachedWidths; }
+
     /*
      * Functor interface
      */
@@ -131,6 +136,8 @@ private:
     bool m_applySectionRestartShift;
     // Store castoff system widths if true
     bool m_storeCastOffSystemWidths;
+    // Use the cached measure widths if true
+    bool m_useCachedWidths;
 };
 
 //----------------------------------------------------------------------------
@@ -8,6 +8,10 @@
 #ifndef __VRV_COMPARISON_H__
 #define __VRV_COMPARISON_H__
 
+#include <unordered_set>
+
+//----------------------------------------------------------------------------
+
 #include "artic.h"
 #include "atts_shared.h"
 #include "durationinterface.h"
@@ -116,6 +120,25 @@ protected:
     InterfaceId m_interfaceId;
 };
 
+//----------------------------------------------------------------------------
+// IDsComparison
+//----------------------------------------------------------------------------
+
+/**
+ * This class evaluates if the object has one of the IDs.
+ * Used for looking up several elements in a single traversal.
+ */
+class IDsComparison : public Comparison {
+
+public:
+    IDsComparison(const std::unordered_set<std::string> &ids) : m_ids(ids) {}
+
+    bool operator()(const Object *object) override { return (m_ids.count(object->GetID()) > 0); }
+
+protected:
+    const std::unordered_set<std::string> &m_ids;
+};
+
 //----------------------------------------------------------------------------
 // PointingToComparison
 //----------------------------------------------------------------------------
@@ -478,6 +501,27 @@ private:
     int m_time;
 };
 
+//----------------------------------------------------------------------------
+// CachedHorizontalLayoutComparison
+//----------------------------------------------------------------------------
+
+/**
+ * This class evaluates if the object is a measure with a cached horizontal layout
+ */
+class CachedHorizontalLayoutComparison : public ClassIdComparison {
+
+public:
+    CachedHorizontalLayoutComparison() : ClassIdComparison(MEASURE) { m_supportReverse = true; }
+
+    bool operator()(const Object *object) override
+    {
+        if (!MatchesType(object)) return false;
+        const Measure *measure = vrv_cast<const Measure *>(object);
+        assert(measure);
+        return Result(measure->HasCachedHorizontalLayout());
+    }
+};
+
 //----------------------------------------------------------------------------
 // NoteOrRestOnsetOffsetComparison
 //----------------------------------------------------------------------------
@@ -579,6 +623,10 @@ public:
     }
 
     void Add(Comparison *comp) { m_filters.push_back(comp); }
+    void Append(const Filters &filters)
+    {
+        std::copy(filters.m_filters.begin(), filters.m_filters.end(), std::back_inserter(m_filters));
+    }
     void Clear() { m_filters.clear(); }
     void SetType(Type type) { m_type = type; }
 
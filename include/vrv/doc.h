@@ -8,12 +8,17 @@
 #ifndef __VRV_DOC_H__
 #define __VRV_DOC_H__
 
+#include <unordered_map>
+
+//----------------------------------------------------------------------------
+
 #include "devicecontextbase.h"
 #include "expansionmap.h"
 #include "facsimile.h"
 #include "options.h"
 #include "resources.h"
 #include "scoredef.h"
+#include "timemap.h"
 
 namespace smf {
 class MidiFile;
@@ -22,6 +27,7 @@ class MidiFile;
 namespace vrv {
 
 class DocSelection;
+class DrawingPageContext;
 class FontInfo;
 class Glyph;
 class Pages;
@@ -30,6 +36,11 @@ class Score;
 
 enum DocType { Raw = 0, Rendering, Transcription, Facs };
 
+/**
+ * The id index of the document, with possibly several objects for one id.
+ */
+using IDIndex = std::unordered_multimap<std::string, Object *>;
+
 //----------------------------------------------------------------------------
 // Doc
 //----------------------------------------------------------------------------
@@ -81,6 +92,15 @@ public:
     Resources &GetResourcesForModification() { return m_resources; }
     ///@}
 
+    /**
+     * Getter for the arena in which the objects of the document are allocated.
+     * Objects are allocated in it only within an ObjectArenaScope.
+     */
+    ///@{
+    ObjectArena *GetArena() { return &m_arena; }
+    const ObjectArena *GetArena() const { return &m_arena; }
+    ///@}
+
     /**
      * Generate a document scoreDef when none is provided.
      * This only looks at the content first system of the document.
@@ -218,6 +238,7 @@ public:
     /**
      * @name Get the height or width for a glyph taking into account the staff and grace sizes
      * (no const because the size of the member font is changed)
+     * The fonts are kept per thread since pages can be drawn concurrently.
      */
     ///@{
     FontInfo *GetDrawingSmuflFont(int staffSize, bool graceSize);
@@ -264,6 +285,12 @@ public:
      */
     bool HasTimemap() const;
 
+    /**
+     * Return the time index of the measures, notes and rests.
+     * The timemap is calculated if necessary and the index is rebuilt if the content of the document changed.
+     */
+    const TimeIndex &GetTimeIndex();
+
     /**
      * Export the document to a MIDI file.
      * Run trough all the layers and fill the midi file content.
@@ -276,6 +303,11 @@ public:
      */
     bool ExportTimemap(std::string &output, bool includeRests, bool includeMeasures);
 
+    /**
+     * Fill the timemap with the onsets and offsets of the document, for exporting it in another encoding.
+     */
+    bool GenerateTimemap(Timemap &timemap);
+
     /**
      *  Extract expansionMap from the document to JSON string.
      */
@@ -405,6 +437,12 @@ public:
     const Page *GetDrawingPage() const { return m_drawingPage; }
     ///@}
 
+    /**
+     * Return the drawing values of the current drawing page.
+     * The context can be given to a View for drawing the page without the document drawing page.
+     */
+    DrawingPageContext GetDrawingPageContext() const;
+
     /**
      * Return the width adjusted to the content of the current drawing page.
      * This includes the appropriate left and right margins.
@@ -463,6 +501,29 @@ public:
     void ReactivateSelection(bool resetAligners);
     ///@}
 
+    /**
+     * @name Methods for the id index of the document.
+     * The index is kept up-to-date by Object when children are added, detached or deleted and when ids are changed.
+     * It is suspended during cast-off and un-cast-off and rebuilt once at the end.
+     */
+    ///@{
+    void RegisterID(Object *object);
+    void UnregisterID(Object *object);
+    std::pair<IDIndex::const_iterator, IDIndex::const_iterator> FindInIDIndex(const std::string &id) const
+    {
+        return m_idIndex.equal_range(id);
+    }
+    void SuspendIDIndex();
+    void RebuildIDIndex();
+    bool IsIDIndexActive() const { return !m_idIndexSuspended; }
+    ///@}
+
+    /**
+     * Return a revision number incremented every time the id index changes.
+     * This can be used to detect that objects were added to or removed from the document.
+     */
+    unsigned int GetIDIndexRevision() const { return m_idIndexRevision; }
+
     //----------//
     // Functors //
     //----------//
@@ -478,6 +539,11 @@ public:
     ///@}
 
 private:
+    /**
+     * Fill the time index from the current timemap values.
+     */
+    void BuildTimeIndex();
+
     /**
      * Calculates the music font size according to the m_interlDefin reference value.
      */
@@ -566,6 +632,12 @@ private:
      */
     Resources m_resources;
 
+    /**
+     * The arena for the objects of the document.
+     * Its blocks are released in bulk when the document is reset.
+     */
+    ObjectArena m_arena;
+
     /**
      * The list of all visible scores
      * Used in Doc::GetCorrespondingScore to quickly determine the score for an object
@@ -577,6 +649,23 @@ private:
      */
     bool m_isCastOff;
 
+    /**
+     * The id index of the objects in the document tree.
+     * See Object::FindDescendantByID
+     */
+    IDIndex m_idIndex;
+
+    /**
+     * A flag indicating if the id index is suspended.
+     * Lookups fall back to a tree traversal in that case.
+     */
+    bool m_idIndexSuspended;
+
+    /**
+     * The revision number of the id index.
+     */
+    unsigned int m_idIndexRevision;
+
     /*
      * The following values are set in the Doc::SetDrawingPage.
      * They are all current values to be used when drawing a page in a View and
@@ -602,11 +691,11 @@ private:
     /** Fingering font size*/
     int m_fingeringFontSize;
     /** Current music font */
-    FontInfo m_drawingSmuflFont;
+    static thread_local FontInfo s_drawingSmuflFont;
     /** Current lyric font */
-    FontInfo m_drawingLyricFont;
+    static thread_local FontInfo s_drawingLyricFont;
     /** Current fingering font */
-    FontInfo m_fingeringFont;
+    static thread_local FontInfo s_fingeringFont;
 
     /**
      * A flag to indicate whether the currentScoreDef has been set or not.
@@ -628,6 +717,12 @@ private:
      */
     double m_timemapTempo;
 
+    /**
+     * The time index built from the timemap and the id index revision it corresponds to.
+     */
+    TimeIndex m_timeIndex;
+    unsigned int m_timeIndexRevision;
+
     /**
      * A flag to indicate whereas the document contains analytical markup to be converted.
      * This is currently limited to @fermata and @tie. Other attribute markup (@accid and @artic)
@@ -67,6 +67,12 @@ protected:
 
     Object *GetElement(std::string &elementId);
 
+    /**
+     * Reset the cached horizontal layout of the measure of the edited object.
+     * The measure will be laid out again by the next RedoLayout.
+     */
+    void ResetCachedLayout(Object *object);
+
 public:
     //
 protected:
@@ -71,6 +71,24 @@ public:
     }
     ///@}
 
+    /**
+     * Setter for the classes the functor visits, and check against a set of descendant classes.
+     * When set, the children of Measure, Staff and Layer objects are processed only if the subtree contains one of
+     * them. This must include all the classes with a Visit method relying on the traversal of these subtrees.
+     */
+    ///@{
+    void SetVisitedClasses(const std::vector<ClassId> &classIds)
+    {
+        m_visitedClasses.reset();
+        for (ClassId classId : classIds) m_visitedClasses.set(classId);
+        m_hasVisitedClasses = true;
+    }
+    bool VisitsAnyOf(const ClassIdSet &classIds) const
+    {
+        return (!m_hasVisitedClasses || (m_visitedClasses & classIds).any());
+    }
+    ///@}
+
     /**
      * Return true if the functor implements the end interface
      */
@@ -89,6 +107,9 @@ private:
     bool m_visibleOnly = true;
     // Direction
     bool m_direction = FORWARD;
+    // The classes visited (when the flag is set)
+    ClassIdSet m_visitedClasses;
+    bool m_hasVisitedClasses = false;
 };
 
 //----------------------------------------------------------------------------
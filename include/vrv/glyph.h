@@ -10,6 +10,7 @@
 
 #include <algorithm>
 #include <string>
+#include <string_view>
 
 //----------------------------------------------------------------------------
 
@@ -75,19 +76,20 @@ public:
     ///@}
 
     /**
-     * @name Setter and getter for the horizAdvX
+     * @name Setter and getter for the XML definition when it is already in memory (e.g., from a font pack)
+     * The data is not owned by the glyph. An empty value means that the definition needs to be read from the path.
      */
     ///@{
-    int GetHorizAdvX() const { return m_horizAdvX; }
-    void SetHorizAdvX(double horizAdvX) { m_horizAdvX = (int)(horizAdvX * 10.0); }
+    std::string_view GetXML() const { return m_xml; }
+    void SetXML(std::string_view xml) { m_xml = xml; }
     ///@}
 
     /**
-     * @name Setter and getter for the fallback falg
+     * @name Setter and getter for the horizAdvX
      */
     ///@{
-    bool GetFallback() const { return m_isFallback; }
-    void SetFallback(bool isFallback) { m_isFallback = isFallback; }
+    int GetHorizAdvX() const { return m_horizAdvX; }
+    void SetHorizAdvX(double horizAdvX) { m_horizAdvX = (int)(horizAdvX * 10.0); }
     ///@}
 
     /**
@@ -124,10 +126,10 @@ private:
     std::string m_codeStr;
     /** Path to the glyph XML file */
     std::string m_path;
+    /** The XML definition of the glyph (not owned) */
+    std::string_view m_xml;
     /** A map of the available anchors */
     std::map<SMuFLGlyphAnchor, Point> m_anchors;
-    /** A flag indicating it is a fallback */
-    bool m_isFallback;
 };
 
 } // namespace vrv
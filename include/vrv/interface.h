@@ -8,16 +8,64 @@
 #ifndef __VRV_INTERFACE_H__
 #define __VRV_INTERFACE_H__
 
+#include <atomic>
+#include <cstdint>
 #include <string>
 
 //----------------------------------------------------------------------------
 
+#include "attclasses.h"
 #include "vrvdef.h"
 
 namespace vrv {
 
 class Object;
 
+//----------------------------------------------------------------------------
+// AtomicBitset
+//----------------------------------------------------------------------------
+
+/**
+ * A fixed-size bitset that can be set concurrently.
+ * It is used for the att classes and the interfaces registered by the constructors, which are shared by all the
+ * instances of a class and can therefore be registered by objects created in different threads.
+ * A bit is set only if it is not already, so registering again the same bits does not write to memory.
+ */
+template <size_t N> class AtomicBitset {
+public:
+    void Set(size_t pos)
+    {
+        const uint64_t mask = uint64_t(1) << (pos % 64);
+        std::atomic<uint64_t> &word = m_words[pos / 64];
+        if (!(word.load(std::memory_order_relaxed) & mask)) word.fetch_or(mask, std::memory_order_relaxed);
+    }
+
+    void Set(const AtomicBitset &bitset)
+    {
+        for (size_t i = 0; i < WORDS; ++i) {
+            const uint64_t mask = bitset.m_words[i].load(std::memory_order_relaxed);
+            if ((m_words[i].load(std::memory_order_relaxed) & mask) != mask) {
+                m_words[i].fetch_or(mask, std::memory_order_relaxed);
+            }
+        }
+    }
+
+    bool Test(size_t pos) const
+    {
+        return (m_words[pos / 64].load(std::memory_order_relaxed) & (uint64_t(1) << (pos % 64)));
+    }
+
+private:
+    static const size_t WORDS = (N + 63) / 64;
+    std::atomic<uint64_t> m_words[WORDS] = {};
+};
+
+/**
+ * The bitsets of MEI att classes and of interfaces
+ */
+using AttClassSet = AtomicBitset<ATT_CLASS_max>;
+using InterfaceSet = AtomicBitset<INTERFACE_max>;
+
 //----------------------------------------------------------------------------
 // Interface
 //----------------------------------------------------------------------------
@@ -42,14 +90,21 @@ public:
     ///@}
 
     /**
-     * Method for registering an MEI att classes in the interface.
+     * Methods for registering an MEI att class in the interface, or all the att classes of a parent interface.
+     * The att classes are shared by all the instances of the interface.
      */
-    void RegisterInterfaceAttClass(AttClassId attClassId) { m_interfaceAttClasses.push_back(attClassId); }
+    ///@{
+    void RegisterInterfaceAttClass(AttClassId attClassId) { s_interfaceAttClasses[this->IsInterface()].Set(attClassId); }
+    void RegisterInterfaceAttClasses(InterfaceId interfaceId)
+    {
+        s_interfaceAttClasses[this->IsInterface()].Set(s_interfaceAttClasses[interfaceId]);
+    }
+    ///@}
 
     /**
-     * Method for obtaining a pointer to the attribute class vector of the interface.
+     * Method for obtaining the att classes of the interface.
      */
-    std::vector<AttClassId> *GetAttClasses() { return &m_interfaceAttClasses; }
+    const AttClassSet &GetAttClasses() const { return s_interfaceAttClasses[this->IsInterface()]; }
 
     /**
      * Virtual reset method.
@@ -65,9 +120,9 @@ public:
 
 private:
     /**
-     * A vector for storing all the MEI att classes grouped in the interface.
+     * The MEI att classes grouped in each interface.
      */
-    std::vector<AttClassId> m_interfaceAttClasses;
+    static AttClassSet s_interfaceAttClasses[INTERFACE_max];
 };
 
 } // namespace vrv
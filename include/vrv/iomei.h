@@ -199,6 +199,13 @@ public:
      */
     bool Export();
 
+    /**
+     * Export the file to MEI and write it to the output stream.
+     * The xml elements are written to the stream as soon as they are completed, so that the tree of the whole
+     * document is never built.
+     */
+    bool Export(std::ostream &output);
+
     /**
      * The main method for writing objects.
      */
@@ -289,7 +296,18 @@ private:
     void UpdateMdivFilter(Object *object);
     bool ProcessScoreBasedFilter(Object *object);
     bool ProcessScoreBasedFilterEnd(Object *object);
-    void PruneAttributes(pugi::xml_node node);
+    bool PruneAttributes(pugi::xml_node node, bool recursive = true);
+    ///@}
+
+    /**
+     * @name Methods for writing the xml elements to the output stream as they are completed
+     */
+    ///@{
+    void StreamNode(pugi::xml_node node, bool open);
+    void StreamChildren(pugi::xml_node parent, pugi::xml_node until = pugi::xml_node());
+    void OpenNode(pugi::xml_node node);
+    void CloseNode();
+    bool IsOpenNode(pugi::xml_node node) const;
     ///@}
 
     /**
@@ -557,6 +575,14 @@ public:
     //
 private:
     std::ostringstream m_streamStringOutput;
+    /** The output stream and its formatting */
+    ///@{
+    std::ostream *m_stream;
+    std::string m_indentString;
+    unsigned int m_outputFlags;
+    ///@}
+    /** The xml elements with their start tag written and whether the attributes of their children are pruned */
+    std::vector<std::pair<pugi::xml_node, bool>> m_openNodes;
     int m_indent;
     bool m_scoreBasedMEI;
     /** A flag indicating that we want to produce MEI basic */
@@ -866,6 +892,19 @@ private:
      */
     void NormalizeAttributes(pugi::xml_node &xmlElement);
 
+    /**
+     * @name Methods for the streaming import
+     * The tree is first loaded without the content of the measures, staves and surfaces of the music.
+     * These are replaced by empty elements with the position of their content in the input data, which is loaded
+     * into a separate tree only when the element is read.
+     */
+    ///@{
+    std::string GetStreamedSkeleton(const std::string &mei) const;
+    pugi::xml_node LoadStreamedElement(pugi::xml_node element, pugi::xml_document &subtree);
+    static size_t FindMarkupEnd(const std::string &mei, size_t pos);
+    static size_t FindElementEnd(const std::string &mei, size_t pos);
+    ///@}
+
     /**
      * Read score-based MEI.
      * The data is read into an object, which is then converted to page-based MEI.
@@ -959,6 +998,11 @@ private:
      */
     std::string m_comment;
 
+    /**
+     * The input data when streaming the import (NULL otherwise)
+     */
+    const std::string *m_streamedData;
+
     //----------------//
     // Static members //
     //----------------//
@@ -967,6 +1011,11 @@ private:
      * A static array for storing the implemented editorial elements
      */
     static const std::vector<std::string> s_editorialElementNames;
+
+    /**
+     * A static array for storing the elements loaded one by one in the streaming import
+     */
+    static const std::vector<std::string> s_streamedElementNames;
 };
 
 } // namespace vrv
@@ -352,6 +352,27 @@ private:
     std::string GetContentOfChild(const pugi::xml_node node, const std::string &child) const;
     ///@}
 
+    /*
+     * @name Helper methods for selecting children and grandchildren by iterating over the tree.
+     * They replace XPath queries in the per-measure and per-note code paths, where evaluating
+     * queries becomes the dominant cost for large files. Null nodes are accepted and return a null node.
+     */
+    ///@{
+    pugi::xml_node GetPrintedChild(const pugi::xml_node node, const std::string &name) const;
+    pugi::xml_node GetUnnumberedChild(const pugi::xml_node node, const std::string &name) const;
+    pugi::xml_node GetBeam(const pugi::xml_node node, const std::string &value, int number = 0) const;
+    pugi::xml_node GetGrandchild(
+        const pugi::xml_node node, const std::string &child, const std::string &grandchild) const;
+    pugi::xml_node GetGrandchildWithAttribute(const pugi::xml_node node, const std::string &child,
+        const std::string &grandchild, const std::string &attribute, const std::string &value) const;
+    pugi::xml_node GetGrandchildWithSubstring(
+        const pugi::xml_node node, const std::string &child, const std::vector<std::string> &substrings) const;
+    pugi::xml_node GetPrintedGrandchild(
+        const pugi::xml_node node, const std::string &child, const std::string &grandchild) const;
+    std::vector<pugi::xml_node> GetGrandchildren(
+        const pugi::xml_node node, const std::string &child, const std::vector<std::string> &names) const;
+    ///@}
+
     /*
      * @name Methods for opening and closing ties and slurs.
      * Opened ties and slurs are stacked together with musicxml::OpenTie
@@ -373,7 +394,7 @@ private:
     ///@{
     ///@}
     std::string GetWordsOrDynamicsText(const pugi::xml_node node) const;
-    void TextRendition(const pugi::xpath_node_set words, ControlElement *element) const;
+    void TextRendition(const std::vector<pugi::xml_node> &words, ControlElement *element) const;
     std::string StyleLabel(pugi::xml_node display);
     void PrintMetronome(pugi::xml_node metronome, Tempo *tempo);
 
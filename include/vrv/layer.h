@@ -33,6 +33,7 @@ class StaffDef;
 class Layer : public Object,
               public DrawingListInterface,
               public ObjectListInterface,
+              public DescendantClassesInterface,
               public AttCue,
               public AttNInteger,
               public AttTyped,
@@ -55,6 +56,20 @@ public:
      */
     void CloneReset() override;
 
+    /**
+     * @name Getter to interfaces
+     */
+    ///@{
+    DescendantClassesInterface *GetDescendantClassesInterface() override
+    {
+        return vrv_cast<DescendantClassesInterface *>(this);
+    }
+    const DescendantClassesInterface *GetDescendantClassesInterface() const override
+    {
+        return vrv_cast<const DescendantClassesInterface *>(this);
+    }
+    ///@}
+
     /**
      * @name Methods for adding allowed content
      */
@@ -34,6 +34,7 @@ class TimestampAttr;
  * For internally simplication of processing, unmeasured music is contained in one single measure object
  */
 class Measure : public Object,
+                public DescendantClassesInterface,
                 public AttBarring,
                 public AttCoordX1,
                 public AttCoordX2,
@@ -63,6 +64,20 @@ public:
      */
     void CloneReset() override;
 
+    /**
+     * @name Getter to interfaces
+     */
+    ///@{
+    DescendantClassesInterface *GetDescendantClassesInterface() override
+    {
+        return vrv_cast<DescendantClassesInterface *>(this);
+    }
+    const DescendantClassesInterface *GetDescendantClassesInterface() const override
+    {
+        return vrv_cast<const DescendantClassesInterface *>(this);
+    }
+    ///@}
+
     /**
      * Return true if measured music (otherwise we have fake measures)
      */
@@ -227,6 +242,12 @@ public:
     void ResetCachedOverflow() { m_cachedOverflow = VRV_UNSET; }
     ///@}
 
+    /**
+     * Reset all the cached values of the horizontal layout.
+     * This marks the measure as needing to be laid out again (e.g., after editing its content).
+     */
+    void ResetCachedHorizontalLayout();
+
     /**
      * Return the right overflow of the control events in the measure.
      * Takes into account Dir, Dynam, and Tempo.
@@ -295,10 +316,26 @@ public:
      */
     int EnclosesTime(int time) const;
 
+    /**
+     * Return the number of playing repeats for which a time offset was calculated
+     */
+    int GetRepeatCount() const { return (int)m_realTimeOffsetMilliseconds.size(); }
+
     /**
      * Read only access to m_scoreTimeOffset
      */
+    ///@{
     double GetLastTimeOffset() const { return m_scoreTimeOffset.back(); }
+    double GetScoreTimeOffset(int repeat) const;
+    ///@}
+
+    /**
+     * Return the duration of the measure in quarter notes and in milliseconds (with the current tempo)
+     */
+    ///@{
+    double GetScoreTimeDuration() const;
+    double GetRealTimeDurationMilliseconds() const;
+    ///@}
 
     /**
      * Return the real time offset in milliseconds
@@ -17,6 +17,7 @@ class MidiFile;
 namespace vrv {
 
 class FeatureExtractor;
+class TimeIndex;
 class Timemap;
 
 //----------------------------------------------------------------------------
@@ -421,6 +422,56 @@ private:
     Timemap *m_timemap;
 };
 
+//----------------------------------------------------------------------------
+// GenerateTimeIndexFunctor
+//----------------------------------------------------------------------------
+
+/**
+ * This class fills the time index with the measures, notes and rests.
+ */
+class GenerateTimeIndexFunctor : public ConstFunctor {
+public:
+    /**
+     * @name Constructors, destructors
+     */
+    ///@{
+    GenerateTimeIndexFunctor(TimeIndex *timeIndex);
+    virtual ~GenerateTimeIndexFunctor() = default;
+    ///@}
+
+    /*
+     * Abstract base implementation
+     */
+    bool ImplementsEndInterface() const override { return false; }
+
+    /*
+     * Functor interface
+     */
+    ///@{
+    FunctorCode VisitMeasure(const Measure *measure) override;
+    FunctorCode VisitNote(const Note *note) override;
+    FunctorCode VisitRest(const Rest *rest) override;
+    ///@}
+
+protected:
+    //
+private:
+    /**
+     * Add an entry to the time index for each repeat of the current measure.
+     */
+    void AddTimeIndexEntries(const Object *object);
+
+public:
+    //
+private:
+    // The current measure
+    const Measure *m_currentMeasure;
+    // The position of the next object in the document order
+    int m_order;
+    // The time index
+    TimeIndex *m_timeIndex;
+};
+
 //----------------------------------------------------------------------------
 // GenerateFeaturesFunctor
 //----------------------------------------------------------------------------
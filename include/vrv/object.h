@@ -8,6 +8,7 @@
 #ifndef __VRV_OBJECT_H__
 #define __VRV_OBJECT_H__
 
+#include <atomic>
 #include <cstdlib>
 #include <functional>
 #include <iterator>
@@ -19,18 +20,21 @@
 #include "attclasses.h"
 #include "attmodule.h"
 #include "boundingbox.h"
+#include "interface.h"
 #include "vrvdef.h"
 
 namespace vrv {
 
 class AltSymInterface;
 class AreaPosInterface;
+class DescendantClassesInterface;
 class Doc;
 class DurationInterface;
 class EditorialElement;
 class Output;
 class Filters;
 class Functor;
+class FunctorBase;
 class FunctorParams;
 class Functor;
 class ConstFunctor;
@@ -72,6 +76,14 @@ public:
     virtual std::string GetClassName() const { return "[MISSING]"; }
     ///@}
 
+    /**
+     * @name Allocation of the objects in the current ObjectArena, or on the heap if there is none
+     */
+    ///@{
+    static void *operator new(size_t size);
+    static void operator delete(void *ptr);
+    ///@}
+
     /**
      * Make an object a reference object that do not own children.
      * This cannot be un-done and has to be set before any child is added.
@@ -112,18 +124,14 @@ public:
 
     /**
      * @name Methods for registering a MEI att class and for registering interfaces regrouping MEI att classes.
+     * The att classes and the interfaces are the same for all the objects of a class and are therefore stored
+     * once per ClassId.
      */
     ///@{
-    void RegisterAttClass(AttClassId attClassId) { m_attClasses.push_back(attClassId); }
-    bool HasAttClass(AttClassId attClassId) const
-    {
-        return std::find(m_attClasses.begin(), m_attClasses.end(), attClassId) != m_attClasses.end();
-    }
-    void RegisterInterface(std::vector<AttClassId> *attClasses, InterfaceId interfaceId);
-    bool HasInterface(InterfaceId interfaceId) const
-    {
-        return std::find(m_interfaces.begin(), m_interfaces.end(), interfaceId) != m_interfaces.end();
-    }
+    void RegisterAttClass(AttClassId attClassId) { s_classAttClasses[m_classId].Set(attClassId); }
+    bool HasAttClass(AttClassId attClassId) const { return s_classAttClasses[m_classId].Test(attClassId); }
+    void RegisterInterface(const AttClassSet &attClasses, InterfaceId interfaceId);
+    bool HasInterface(InterfaceId interfaceId) const { return s_classInterfaces[m_classId].Test(interfaceId); }
     ///@}
 
     /**
@@ -136,6 +144,8 @@ public:
     virtual const AreaPosInterface *GetAreaPosInterface() const { return NULL; }
     virtual BeamDrawingInterface *GetBeamDrawingInterface() { return NULL; }
     virtual const BeamDrawingInterface *GetBeamDrawingInterface() const { return NULL; }
+    virtual DescendantClassesInterface *GetDescendantClassesInterface() { return NULL; }
+    virtual const DescendantClassesInterface *GetDescendantClassesInterface() const { return NULL; }
     virtual DurationInterface *GetDurationInterface() { return NULL; }
     virtual const DurationInterface *GetDurationInterface() const { return NULL; }
     virtual LinkingInterface *GetLinkingInterface() { return NULL; }
@@ -242,10 +252,16 @@ public:
      */
     virtual void CloneReset();
 
+    /**
+     * @name Getter and setters for the id.
+     * Setting or resetting the id keeps the document id index up-to-date.
+     */
+    ///@{
     const std::string &GetID() const { return m_id; }
-    void SetID(const std::string &id) { m_id = id; }
+    void SetID(const std::string &id);
     void SwapID(Object *other);
     void ResetID();
+    ///@}
 
     /**
      * Methods for setting / getting comments
@@ -424,6 +440,12 @@ public:
      */
     Object *DetachChild(int idx);
 
+    /**
+     * Add the ClassIds of all the descendants to the set.
+     * The cached set of descendants implementing the DescendantClassesInterface is used.
+     */
+    void AddDescendantClasses(ClassIdSet &classIds) const;
+
     /**
      * Return true if the object has the child Object as descendant (reference of direct).
      * Processes in depth-first.
@@ -432,7 +454,8 @@ public:
 
     /**
      * Look for a descendant with the specified id (returns NULL if not found)
-     * This method is a wrapper for the Object::FindByID functor.
+     * When the object is part of a document and no depth limit is given, the id index of the document is used.
+     * Otherwise, this method is a wrapper for the Object::FindByID functor.
      */
     ///@{
     Object *FindDescendantByID(const std::string &id, int deepness = UNLIMITED_DEPTH, bool direction = FORWARD);
@@ -582,6 +605,16 @@ public:
      */
     void FillFlatList(ListOfConstObjects &list) const;
 
+    /**
+     * @name Add or remove the object and its descendants to / from the id index of the document.
+     * Only children owned by the object are processed.
+     * Called internally when the tree is modified and by Doc::RebuildIDIndex.
+     */
+    ///@{
+    void AddToIDIndex(Doc *doc);
+    void RemoveFromIDIndex(Doc *doc);
+    ///@}
+
     /**
      * Check if the content was modified or not
      */
@@ -668,6 +701,15 @@ public:
 
     static std::string GenerateHashID();
 
+    /**
+     * Getter and setter for the id counter of the current thread.
+     * Once set, the counter is not seeded again randomly by the first object created in the thread.
+     */
+    ///@{
+    static uint32_t GetIDCounter() { return s_xmlIDCounter; }
+    static void SetIDCounter(uint32_t counter);
+    ///@}
+
     static uint32_t Hash(uint32_t number, bool reverse = false);
 
     static bool sortByUlx(Object *a, Object *b);
@@ -677,6 +719,16 @@ public:
      */
     static bool IsPreOrdered(const Object *left, const Object *right);
 
+protected:
+    /**
+     * @name Update the id index of the document when a child is added or removed.
+     * Has to be called in AddChild overrides that do not call the parent method.
+     */
+    ///@{
+    void IndexChild(Object *child);
+    void UnindexChild(Object *child);
+    ///@}
+
 private:
     /**
      * Method for generating the id.
@@ -693,9 +745,25 @@ private:
      */
     ///@{
     bool SkipChildren(bool visibleOnly) const;
+    bool SkipDescendants(const FunctorBase &functor) const;
     bool FiltersApply(const Filters *filters, Object *object) const;
     ///@}
 
+    /**
+     * Return the document holding the id index for the object.
+     * Returns NULL if the object is not indexed or if the index is currently suspended.
+     */
+    ///@{
+    Doc *GetIDIndexDoc();
+    const Doc *GetIDIndexDoc() const;
+    ///@}
+
+    /**
+     * Return true if the descendant would be reached from this by a FindByIDFunctor traversal.
+     * Hidden editorial, mdiv and system elements on the path are not traversed.
+     */
+    bool IsVisibleDescendant(const Object *descendant) const;
+
 public:
     /**
      * Keep an array of unsupported attributes as pairs.
@@ -744,6 +812,12 @@ private:
      */
     mutable bool m_isModified;
 
+    /**
+     * Indicates whether the object is registered in the id index of the document.
+     * Only objects owned by the document tree are indexed (not aligners or other objects only referring a parent).
+     */
+    bool m_isIDIndexed;
+
     /**
      * Members used for caching iterator values.
      * See Object::IterGetFirst, Object::IterGetNext and Object::IterIsNotEnd
@@ -754,16 +828,6 @@ private:
     mutable ClassId m_iteratorElementType;
     ///@}
 
-    /**
-     * A vector for storing the list of AttClassId (MEI att classes) implemented.
-     */
-    std::vector<AttClassId> m_attClasses;
-
-    /**
-     * A vector for storing the list of InterfaceId (group of MEI att classes) implemented.
-     */
-    std::vector<InterfaceId> m_interfaces;
-
     /**
      * String for storing a comments attached to the object when printing an MEI element.
      * m_comment is to be printed immediately before the element
@@ -797,6 +861,14 @@ private:
      * XML id counter
      */
     static thread_local uint32_t s_xmlIDCounter;
+
+    /**
+     * The MEI att classes and the interfaces implemented by each class, registered by the constructors.
+     */
+    ///@{
+    static AttClassSet s_classAttClasses[UNSPECIFIED];
+    static InterfaceSet s_classInterfaces[UNSPECIFIED];
+    ///@}
 };
 
 //----------------------------------------------------------------------------
@@ -899,6 +971,53 @@ private:
     mutable const Object *m_owner = NULL;
 };
 
+//----------------------------------------------------------------------------
+// DescendantClassesInterface
+//----------------------------------------------------------------------------
+
+/**
+ * This class is an pseudo interface for elements caching the set of ClassIds found in their subtree.
+ * It is used in Object::Process for not processing the children when the functor visits none of them.
+ * The set is invalidated when a child is added in the subtree. Removing children does not invalidate it,
+ * since a set with too many classes only prevents the skipping.
+ * It is expected to be used as a base class of element classes derived from Object.
+ */
+class DescendantClassesInterface {
+public:
+    // constructors and destructors
+    DescendantClassesInterface(){};
+    virtual ~DescendantClassesInterface(){};
+    DescendantClassesInterface(const DescendantClassesInterface &interface); // copy constructor;
+    DescendantClassesInterface &operator=(const DescendantClassesInterface &interface); // copy assignment;
+
+    /**
+     * Return the set of ClassIds of the descendants, which is updated first if necessary.
+     */
+    const ClassIdSet &GetDescendantClasses() const;
+
+    /**
+     * Invalidate the set.
+     * Return false if it was not valid, in which case the sets of the ancestors are not valid either.
+     */
+    bool ResetDescendantClasses() const;
+
+private:
+    /**
+     * Retrieve the owner object of the interface.
+     */
+    const Object *GetInterfaceOwner() const;
+
+public:
+    //
+private:
+    // The ClassIds of the descendants
+    mutable ClassIdSet m_descendantClasses;
+    // A flag indicating the set is up-to-date
+    mutable bool m_hasDescendantClasses = false;
+    // The owner object
+    mutable const Object *m_owner = NULL;
+};
+
 //----------------------------------------------------------------------------
 // TextListInterface
 //----------------------------------------------------------------------------
@@ -970,6 +1089,136 @@ private:
     ClassId m_classId;
 };
 
+//----------------------------------------------------------------------------
+// ObjectArena
+//----------------------------------------------------------------------------
+
+/**
+ * Counters of the allocations of objects, used for comparing the arena with the heap.
+ */
+struct ObjectAllocationStats {
+    // Objects allocated in the arena, including the ones reusing the memory of deleted objects
+    long m_allocations = 0;
+    long m_reuses = 0;
+    long m_deallocations = 0;
+    // Blocks allocated and released in bulk
+    long m_blocks = 0;
+    long m_releases = 0;
+    long m_recycles = 0;
+    size_t m_blockBytes = 0;
+};
+
+/**
+ * This class provides the memory of the objects of a document.
+ * The objects are carved from large blocks and the memory of the deleted ones is kept in free lists by size.
+ * The blocks are released all at once when no object is left, which avoids one call to the heap allocator
+ * per object when a document is loaded and deleted.
+ * Objects are allocated in the arena set with an ObjectArenaScope for the current thread, otherwise on the
+ * heap. An arena is not thread-safe and its objects have to be created and deleted by the thread owning the
+ * document.
+ */
+class ObjectArena {
+public:
+    /**
+     * @name Constructors, destructors, and other standard methods
+     */
+    ///@{
+    ObjectArena();
+    ~ObjectArena();
+    ObjectArena(const ObjectArena &) = delete;
+    ObjectArena &operator=(const ObjectArena &) = delete;
+    ///@}
+
+    /**
+     * Release all the blocks if no object allocated in the arena is left.
+     * Return false if some objects are still alive.
+     */
+    bool Release();
+
+    /**
+     * Keep all the blocks and reuse them from the first one if no object allocated in the arena is left.
+     * Return false if some objects are still alive.
+     */
+    bool Recycle();
+
+    /**
+     * Getters for the counters
+     */
+    ///@{
+    const ObjectAllocationStats &GetStats() const { return m_stats; }
+    long GetLiveCount() const { return m_liveCount; }
+    static long GetHeapAllocations() { return s_heapAllocations.load(std::memory_order_relaxed); }
+    ///@}
+
+    /**
+     * @name Allocate and free the memory of an object, in the current arena or on the heap.
+     * Called by Object::operator new and Object::operator delete.
+     */
+    ///@{
+    static void *AllocateObject(size_t size);
+    static void FreeObject(void *ptr);
+    ///@}
+
+    /**
+     * The arena of the current thread (NULL if none)
+     */
+    static ObjectArena *GetCurrent() { return s_current; }
+
+private:
+    void *Allocate(size_t size);
+    void Deallocate(void *ptr, size_t size);
+
+private:
+    // The list of blocks, the one currently used and the position in it
+    std::vector<char *> m_blocks;
+    size_t m_blockIdx;
+    char *m_blockCurrent;
+    char *m_blockEnd;
+    // The free lists by size class
+    std::vector<void *> m_freeLists;
+    long m_liveCount;
+    ObjectAllocationStats m_stats;
+
+    static thread_local ObjectArena *s_current;
+    static std::atomic<long> s_heapAllocations;
+
+    friend class ObjectArenaScope;
+};
+
+//----------------------------------------------------------------------------
+// ObjectArenaScope
+//----------------------------------------------------------------------------
+
+/**
+ * This class sets the arena in which the objects are allocated by the current thread for its lifetime.
+ */
+class ObjectArenaScope {
+public:
+    explicit ObjectArenaScope(ObjectArena *arena);
+    ~ObjectArenaScope();
+
+private:
+    ObjectArena *m_previous;
+};
+
+//----------------------------------------------------------------------------
+// IDCounterScope
+//----------------------------------------------------------------------------
+
+/**
+ * This class sets the id counter of the current thread for its lifetime and restores the previous one afterwards.
+ * It is used for the temporary objects created when drawing, so that their ids depend neither on the thread drawing
+ * nor on how many times the content was drawn before.
+ */
+class IDCounterScope {
+public:
+    explicit IDCounterScope(uint32_t counter);
+    ~IDCounterScope();
+
+private:
+    uint32_t m_previous;
+};
+
 //----------------------------------------------------------------------------
 // ObjectFactory
 //----------------------------------------------------------------------------
@@ -626,6 +626,7 @@ public:
     OptionBool m_incip;
     OptionBool m_justifyVertically;
     OptionBool m_landscape;
+    OptionBool m_meiStreaming;
     OptionDbl m_minLastJustification;
     OptionBool m_mmOutput;
     OptionBool m_moveScoreDefinitionToStaff;
@@ -644,6 +645,7 @@ public:
     OptionInt m_pageWidth;
     OptionIntMap m_pedalStyle;
     OptionBool m_preserveAnalyticalMarkup;
+    OptionBool m_recycleMemory;
     OptionBool m_removeIds;
     OptionBool m_scaleToPageSize;
     OptionBool m_showRuntime;
@@ -655,8 +657,10 @@ public:
     OptionBool m_svgViewBox;
     OptionBool m_svgHtml5;
     OptionBool m_svgFormatRaw;
+    OptionBool m_svgStreaming;
     OptionBool m_svgRemoveXlink;
     OptionArray m_svgAdditionalAttribute;
+    OptionInt m_threads;
     OptionDbl m_unit;
     OptionBool m_useFacsimile;
     OptionBool m_usePgFooterForAll;
@@ -13,11 +13,18 @@
 
 namespace vrv {
 
+class BBoxDeviceContext;
 class DeviceContext;
 class RunningElement;
 class Score;
 class Staff;
 class System;
+class View;
+
+/**
+ * The function laying out a system vertically with the view and device context of its group
+ */
+using SystemLayOutFunction = std::function<void(System *system, View &view, BBoxDeviceContext &bBoxDC)>;
 
 //----------------------------------------------------------------------------
 // Page
@@ -94,16 +101,17 @@ public:
     void LayOutTranscription(bool force = false);
 
     /**
-     * Lay out the content of the page (measures and their content) horizontally
+     * Lay out the content of the page (measures and their content) horizontally.
+     * With filters, only the measures matching them are laid out and the other ones keep their cached width.
      */
-    void LayOutHorizontally();
+    void LayOutHorizontally(Filters *filters = NULL);
 
     /**
      * Lay out the measures horizontally using the cached values.
      * This should be done in preparation of cast-off which is based on measure positioning.
      * The content of the measures is not laid out and keeps previously cached positioning.
      */
-    void LayOutHorizontallyWithCache(bool restore = false);
+    void LayOutHorizontallyWithCache(bool restore = false, Filters *filters = NULL);
 
     /**
      * Justifiy the content of the page (measures and their content) horizontally
@@ -123,7 +131,7 @@ public:
     /**
      * Reset and set the horizontal and vertical alignment
      */
-    void ResetAligners();
+    void ResetAligners(Filters *filters = NULL);
 
     /**
      * Lay out the pitch positions and stems (without redoing the entire layout)
@@ -160,10 +168,28 @@ public:
     ///@}
 
 private:
+    /**
+     * Lay out the systems of the page vertically system by system, concurrently until they are aligned on the page.
+     * This is used instead of laying out the entire page when several threads are allowed.
+     */
+    void LayOutSystemsVerticallyConcurrently(Doc *doc, View &view, BBoxDeviceContext &bBoxDC);
+
+    /**
+     * Process the groups of dependent systems of the page with the function concurrently with RunConcurrently.
+     * Each group has its own view and bounding box device context given to the function.
+     */
+    void ProcessSystemsConcurrently(Doc *doc, const SystemLayOutFunction &layOutSystem);
+
+    /**
+     * Group the consecutive systems depending on each other, because of spanning elements or of the system divider.
+     * The systems of a group have to be laid out in order by the same thread.
+     */
+    std::vector<std::vector<System *>> GetDependentSystemGroups(const Doc *doc);
+
     /**
      * Adjust the horizontal position of the syl processing verse by verse
      */
-    void AdjustSylSpacingByVerse(const IntTree &verseTree, Doc *doc);
+    void AdjustSylSpacingByVerse(const IntTree &verseTree, Doc *doc, Filters *filters);
 
     /**
      * Check whether vertical justification is required for the current page
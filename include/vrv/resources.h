@@ -8,14 +8,97 @@
 #ifndef __VRV_RESOURCES_H__
 #define __VRV_RESOURCES_H__
 
+#include <map>
+#include <memory>
+#include <mutex>
 #include <unordered_map>
 
 //----------------------------------------------------------------------------
 
 #include "glyph.h"
 
+namespace pugi {
+class xml_document;
+}
+
 namespace vrv {
 
+class FontPack;
+
+//----------------------------------------------------------------------------
+// FontData
+//----------------------------------------------------------------------------
+
+/**
+ * This class holds the glyphs of one font loaded from the resource files.
+ * It is immutable once loaded and is shared by all the Resources instances using the font.
+ */
+class FontData {
+public:
+    using GlyphTable = std::unordered_map<char32_t, Glyph>;
+    using GlyphNameTable = std::unordered_map<std::string, char32_t>;
+
+    /**
+     * @name Constructors, destructors, and other standard methods
+     */
+    ///@{
+    FontData() = default;
+    virtual ~FontData() = default;
+    ///@}
+
+    /**
+     * Return the SMuFL font or the text font (bounding boxes only) from the resources directory.
+     * The font is loaded from the binary font pack if available and from the XML files otherwise.
+     * A font is loaded only once per process as long as it is in use. Return NULL if it cannot be loaded.
+     */
+    ///@{
+    static std::shared_ptr<const FontData> GetFont(const std::string &path, const std::string &fontName);
+    static std::shared_ptr<const FontData> GetTextFont(const std::string &path, const std::string &fontName);
+    ///@}
+
+    /**
+     * Retrieving glyphs
+     */
+    ///@{
+    /** Returns the glyph (if exists) for a glyph code */
+    const Glyph *GetGlyph(char32_t code) const;
+    /** Returns true and set the code if the font has a glyph with the name */
+    bool GetGlyphCode(const std::string &name, char32_t &code) const;
+    /** Returns the glyph table */
+    const GlyphTable &GetGlyphTable() const { return m_glyphTable; }
+    ///@}
+
+private:
+    /**
+     * Load the font from the binary font pack or from the XML files.
+     */
+    ///@{
+    bool LoadFont(const std::string &path, const std::string &fontName);
+    bool LoadFontPack(const std::string &path, const std::string &fontName);
+    bool LoadTextFont(const std::string &path, const std::string &fontName);
+    bool LoadTextFontPack(const std::string &path, const std::string &fontName);
+    ///@}
+
+public:
+    //
+private:
+    /** The glyphs of the font */
+    GlyphTable m_glyphTable;
+    /** A map of glyph name / code */
+    GlyphNameTable m_glyphNameTable;
+    /** The font pack the glyph definitions point to (if any) */
+    std::shared_ptr<const FontPack> m_fontPack;
+
+    //----------------//
+    // Static members //
+    //----------------//
+
+    /** The fonts in use, by file name */
+    static std::map<std::string, std::weak_ptr<const FontData>> s_fonts;
+    /** The mutex for loading the fonts */
+    static std::mutex s_fontsMutex;
+};
+
 //----------------------------------------------------------------------------
 // Resources
 //----------------------------------------------------------------------------
@@ -23,14 +106,13 @@ namespace vrv {
 /**
  * This class provides resource values.
  * It manages fonts and glyph tables.
+ * The glyph tables are shared FontData objects and only the font selection is specific to the instance.
  */
 
 class Resources {
 public:
     using StyleAttributes = std::pair<data_FONTWEIGHT, data_FONTSTYLE>;
-    using GlyphTable = std::unordered_map<char32_t, Glyph>;
-    using GlyphNameTable = std::unordered_map<std::string, char32_t>;
-    using GlyphTextMap = std::map<StyleAttributes, GlyphTable>;
+    using TextFontMap = std::map<StyleAttributes, std::shared_ptr<const FontData>>;
 
     /**
      * @name Constructors, destructors, and other standard methods
@@ -97,23 +179,48 @@ public:
      */
     static char32_t GetSmuflGlyphForUnicodeChar(const char32_t unicodeChar);
 
+    /**
+     * Return the parsed XML definition (<symbol> or <path>) of the glyph to be included in the SVG.
+     * The file is loaded once per process and the document is shared read-only by all callers.
+     * The document is empty if the file cannot be loaded.
+     */
+    static const pugi::xml_document &GetGlyphDefinition(const Glyph *glyph);
+
+    /**
+     * Return the content of the CSS font file for the font name to be embedded in the SVG.
+     * The file is loaded once per process. Return false if it cannot be loaded.
+     */
+    bool GetCSSFont(const std::string &fontName, std::string &cssContent) const;
+
 private:
     bool LoadFont(const std::string &fontName, bool withFallback = true);
 
+    /**
+     * Return the glyph for the code and the index of the font it comes from (-1 if not found)
+     */
+    const Glyph *FindGlyph(char32_t smuflCode, int &fontIdx) const;
+
+    /**
+     * Return the number of distinct glyphs in the loaded SMuFL fonts
+     */
+    int GetGlyphCount() const;
+
 private:
     /** The font name of the font that is currently loaded */
     std::string m_fontName;
     /** The path to the resources directory (e.g., for the svg/ subdirectory with fonts as XML */
     std::string m_path;
-    /** The loaded SMuFL font */
-    GlyphTable m_fontGlyphTable;
-    /** A text font used for bounding box calculations */
-    GlyphTextMap m_textFont;
-    mutable StyleAttributes m_currentStyle;
     /**
-     * A map of glyph name / code
+     * The loaded SMuFL fonts in loading order.
+     * A glyph is taken from the last font that has it.
      */
-    GlyphNameTable m_glyphNameTable;
+    std::vector<std::shared_ptr<const FontData>> m_fonts;
+    /** The number of fonts at the beginning of m_fonts that are a fallback for the current font */
+    int m_fallbackFontCount;
+    /** The text fonts used for bounding box calculations */
+    TextFontMap m_textFonts;
+    /** The current text style - a copy of the resources has to be used for drawing concurrently */
+    mutable StyleAttributes m_currentStyle;
 
     //----------------//
     // Static members //
@@ -124,6 +231,12 @@ private:
 
     /** The default font style */
     static const StyleAttributes k_defaultStyle;
+
+    /** The glyph definitions and the CSS fonts loaded from the resource files, by file path */
+    static std::map<std::string, std::unique_ptr<pugi::xml_document>> s_glyphDefinitions;
+    static std::map<std::string, std::string> s_cssFonts;
+    /** The mutex for loading the files into the caches above */
+    static std::mutex s_fileCacheMutex;
 };
 
 } // namespace vrv
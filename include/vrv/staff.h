@@ -34,6 +34,7 @@ class Tuning;
  * For unmeasured music, one single Measure is added for simplifying internal processing
  */
 class Staff : public Object,
+              public DescendantClassesInterface,
               public FacsimileInterface,
               public AttCoordY1,
               public AttNInteger,
@@ -62,6 +63,14 @@ public:
      * @name Getter to interfaces
      */
     ///@{
+    DescendantClassesInterface *GetDescendantClassesInterface() override
+    {
+        return vrv_cast<DescendantClassesInterface *>(this);
+    }
+    const DescendantClassesInterface *GetDescendantClassesInterface() const override
+    {
+        return vrv_cast<const DescendantClassesInterface *>(this);
+    }
     FacsimileInterface *GetFacsimileInterface() override { return vrv_cast<FacsimileInterface *>(this); }
     const FacsimileInterface *GetFacsimileInterface() const override
     {
@@ -8,12 +8,15 @@
 #ifndef __VRV_SVG_DC_H__
 #define __VRV_SVG_DC_H__
 
+#include <deque>
 #include <fstream>
 #include <iostream>
 #include <list>
+#include <memory>
 #include <set>
 #include <sstream>
 #include <string>
+#include <unordered_map>
 #include <vector>
 
 //----------------------------------------------------------------------------
@@ -29,6 +32,339 @@ class Resources;
 
 namespace vrv {
 
+//----------------------------------------------------------------------------
+// SvgWriter
+//----------------------------------------------------------------------------
+
+/**
+ * This class is an interface for writing the SVG markup of a SvgDeviceContext.
+ * Elements that can have children are kept on a stack. Leaves (paths, uses, etc.) stay open until
+ * the next node is started so attributes can be appended to them.
+ */
+class SvgWriter {
+public:
+    /**
+     * Where a child is inserted in the current element.
+     * AFTER_PARENT appends it to the grandparent, right after the parent of the current element.
+     */
+    enum Position { APPEND = 0, PREPEND, BEFORE_GROUP, AFTER_PARENT };
+
+    /**
+     * @name Constructors, destructors, and other standard methods
+     */
+    ///@{
+    SvgWriter() {}
+    virtual ~SvgWriter() {}
+    ///@}
+
+    /**
+     * @name Setters for the formatting - they have to be set before children are written
+     */
+    ///@{
+    virtual void SetIndent(int indent) = 0;
+    virtual void SetFormatRaw(bool formatRaw) = 0;
+    ///@}
+
+    /**
+     * @name Start and end elements that can have children
+     */
+    ///@{
+    virtual void StartElement(const char *name, Position position = APPEND) = 0;
+    virtual void EndElement() = 0;
+    ///@}
+
+    /**
+     * @name Resume a <g> already ended and identified by its @id or @data-id.
+     * The current element is resumed if none is found.
+     */
+    ///@{
+    virtual void ResumeElement(const std::string &id) = 0;
+    virtual void EndResumedElement() = 0;
+    ///@}
+
+    /**
+     * @name Start a leaf element that remains open until the next node is started or CloseLeaf is called
+     */
+    ///@{
+    virtual void StartLeaf(const std::string &name, Position position = APPEND) = 0;
+    virtual void SetLeafText(const std::string &text) = 0;
+    virtual void CloseLeaf() = 0;
+    ///@}
+
+    /**
+     * @name Add an attribute to the leaf being written or to the current element otherwise
+     */
+    ///@{
+    virtual void AddAttribute(const char *name, const char *value) = 0;
+    void AddAttribute(const char *name, const std::string &value) { this->AddAttribute(name, value.c_str()); }
+    virtual void AddAttribute(const char *name, int value) = 0;
+    virtual void AddAttribute(const char *name, float value) = 0;
+    virtual void AddAttribute(const char *name, double value) = 0;
+    ///@}
+
+    /**
+     * Prepend an attribute to the current element
+     */
+    virtual void PrependAttribute(const char *name, const std::string &value) = 0;
+
+    /**
+     * Remove the @id of the current element - this is possible only until it has children
+     */
+    virtual void RemoveId() = 0;
+
+    /**
+     * @name Getters for the current element
+     */
+    ///@{
+    virtual bool HasTransform() const = 0;
+    virtual bool HasGroupChild() const = 0;
+    ///@}
+
+    /**
+     * Return the @font-family of the closest ancestor of the current element that has one
+     */
+    virtual std::string GetAncestorFontFamily() const = 0;
+
+    /**
+     * Append a copy of a pugixml node (with its descendants) to the current element.
+     * The @id of the copy is replaced by id if given.
+     */
+    virtual void AppendCopy(pugi::xml_node node, const char *id = NULL) = 0;
+
+    /**
+     * End all the elements and return the document
+     */
+    virtual std::string Flatten(bool xmlDeclaration) = 0;
+
+    /**
+     * Clear the markup written so far for starting a new document.
+     * The memory already allocated is kept when possible.
+     */
+    virtual void Reset() = 0;
+};
+
+//----------------------------------------------------------------------------
+// SvgDomWriter
+//----------------------------------------------------------------------------
+
+/**
+ * This class writes the SVG markup by building a pugixml DOM serialized when the document is flattened.
+ * This is the default writer.
+ */
+class SvgDomWriter : public SvgWriter {
+public:
+    /**
+     * @name Constructors, destructors, and other standard methods
+     */
+    ///@{
+    SvgDomWriter();
+    virtual ~SvgDomWriter() {}
+    ///@}
+
+    /**
+     * @name Setters for the formatting
+     */
+    ///@{
+    void SetIndent(int indent) override { m_indent = indent; }
+    void SetFormatRaw(bool formatRaw) override { m_formatRaw = formatRaw; }
+    ///@}
+
+    /**
+     * @name Implementation of the SvgWriter interface
+     */
+    ///@{
+    void StartElement(const char *name, Position position = APPEND) override;
+    void EndElement() override;
+    void ResumeElement(const std::string &id) override;
+    void EndResumedElement() override;
+    void StartLeaf(const std::string &name, Position position = APPEND) override;
+    void SetLeafText(const std::string &text) override;
+    void CloseLeaf() override { m_leafNode = pugi::xml_node(); }
+    using SvgWriter::AddAttribute;
+    void AddAttribute(const char *name, const char *value) override;
+    void AddAttribute(const char *name, int value) override;
+    void AddAttribute(const char *name, float value) override;
+    void AddAttribute(const char *name, double value) override;
+    void PrependAttribute(const char *name, const std::string &value) override;
+    void RemoveId() override;
+    bool HasTransform() const override { return m_currentNode.attribute("transform"); }
+    bool HasGroupChild() const override { return m_currentNode.child("g"); }
+    std::string GetAncestorFontFamily() const override;
+    void AppendCopy(pugi::xml_node node, const char *id = NULL) override;
+    std::string Flatten(bool xmlDeclaration) override;
+    void Reset() override;
+    ///@}
+
+private:
+    /**
+     * Add a child to the current element at the given position
+     */
+    pugi::xml_node AddNode(const char *name, Position position);
+
+    /**
+     * Return the leaf being written or the current element otherwise
+     */
+    pugi::xml_node GetAttributeNode() const { return (m_leafNode) ? m_leafNode : m_currentNode; }
+
+private:
+    pugi::xml_document m_svgDoc;
+    pugi::xml_node m_currentNode;
+    std::list<pugi::xml_node> m_svgNodeStack;
+    // the leaf being written
+    pugi::xml_node m_leafNode;
+    // formatting
+    int m_indent;
+    bool m_formatRaw;
+};
+
+//----------------------------------------------------------------------------
+// SvgStreamWriter
+//----------------------------------------------------------------------------
+
+/**
+ * This class writes SVG markup directly into growable buffers without building a DOM.
+ * Elements are serialized as they are created, with the same formatting as pugixml.
+ * The few changes made to markup already written (the root size, the <defs>, children prepended or
+ * inserted before the first <g>, attributes added after the children, and graphics resumed by id)
+ * are recorded in a fixup table and applied when the document is flattened.
+ * It is used when the svgStreaming option is set.
+ */
+class SvgStreamWriter : public SvgWriter {
+public:
+    /**
+     * @name Constructors, destructors, and other standard methods
+     */
+    ///@{
+    SvgStreamWriter();
+    virtual ~SvgStreamWriter() {}
+    ///@}
+
+    /**
+     * @name Setters for the formatting
+     */
+    ///@{
+    void SetIndent(int indent) override;
+    void SetFormatRaw(bool formatRaw) override { m_formatRaw = formatRaw; }
+    ///@}
+
+    /**
+     * @name Implementation of the SvgWriter interface
+     */
+    ///@{
+    void StartElement(const char *name, Position position = APPEND) override;
+    void EndElement() override;
+    void ResumeElement(const std::string &id) override;
+    void EndResumedElement() override;
+    void StartLeaf(const std::string &name, Position position = APPEND) override;
+    void SetLeafText(const std::string &text) override;
+    void CloseLeaf() override;
+    using SvgWriter::AddAttribute;
+    void AddAttribute(const char *name, const char *value) override;
+    void AddAttribute(const char *name, int value) override;
+    void AddAttribute(const char *name, float value) override;
+    void AddAttribute(const char *name, double value) override;
+    void PrependAttribute(const char *name, const std::string &value) override;
+    void RemoveId() override;
+    bool HasTransform() const override { return m_stack.back()->m_hasTransform; }
+    bool HasGroupChild() const override { return (m_stack.back()->m_firstGroup.m_sink != -1); }
+    std::string GetAncestorFontFamily() const override;
+    void AppendCopy(pugi::xml_node node, const char *id = NULL) override;
+    std::string Flatten(bool xmlDeclaration) override;
+    void Reset() override;
+    ///@}
+
+private:
+    /**
+     * A position in one of the buffers
+     */
+    struct Location {
+        int m_sink = -1;
+        size_t m_offset = 0;
+    };
+
+    /**
+     * The state of an element on the stack, or of a <g> ended with an id in case it gets resumed
+     */
+    struct Element {
+        const char *m_name = "";
+        std::string m_id;
+        int m_depth = 0;
+        // The buffer with the start tag and the one where children are appended (-1 once ended)
+        int m_sink = -1;
+        int m_contentSink = -1;
+        size_t m_tagStart = 0;
+        size_t m_attrEnd = 0;
+        size_t m_closeOffset = 0;
+        size_t m_closeEnd = 0;
+        Location m_contentStart;
+        Location m_firstGroup;
+        // The buffer for children inserted before the first <g> and the one for nodes appended after the element
+        int m_beforeGroupSink = -1;
+        int m_trailingSink = -1;
+        // The fixup re-opening an element ended without children
+        int m_reopenFixup = -1;
+        const std::string *m_fontFamily = NULL;
+        const std::string *m_ancestorFontFamily = NULL;
+        bool m_tagOpen = true;
+        bool m_hasChildren = false;
+        bool m_ended = false;
+        bool m_selfClosed = false;
+        bool m_hasTransform = false;
+        bool m_afterText = false;
+    };
+
+    /**
+     * A piece of markup inserted in a buffer (and replacing m_erase characters) when flattening.
+     * Attribute fixups have rank 0 so they come before content inserted at the same offset.
+     * Prepended content has a negative order so the latest comes first.
+     */
+    struct Fixup {
+        int m_sink;
+        size_t m_offset;
+        size_t m_erase;
+        int m_rank;
+        long m_order;
+        int m_content;
+        std::string m_suffix;
+    };
+
+    int AddSink();
+    int AddFixup(const Location &location, int rank, bool prepend, size_t erase = 0);
+
+    /**
+     * Get the buffer where a child is to be written and update the state of the parent accordingly
+     */
+    int PrepareChild(Element &parent, Position position, bool isGroup);
+
+    void WriteIndent(std::string &sink, int depth);
+    void WriteAttribute(std::string &sink, const char *name, const char *value);
+    void WriteEscaped(std::string &sink, const char *value, bool attribute);
+
+    void FlattenSink(int sink, std::string &output) const;
+
+private:
+    // the buffers - a deque because references to them are kept while others are added
+    std::deque<std::string> m_sinks;
+    std::vector<Fixup> m_fixups;
+    // the elements on the stack
+    std::deque<Element> m_elements;
+    std::vector<Element *> m_stack;
+    // the <g> ended with an id, in case they get resumed - the first one is kept when ids are duplicated
+    std::unordered_map<std::string, Element> m_groups;
+    // the values of @font-family
+    std::set<std::string> m_fontFamilies;
+    // the leaf being written
+    bool m_leafOpen;
+    int m_leafSink;
+    std::string m_leafName;
+    std::string m_leafText;
+    bool m_leafHasText;
+    // formatting
+    std::string m_indent;
+    bool m_formatRaw;
+    long m_fixupCount;
+};
+
 //----------------------------------------------------------------------------
 // SvgDeviceContext
 //----------------------------------------------------------------------------
@@ -48,6 +384,12 @@ public:
     virtual ~SvgDeviceContext();
     ///@}
 
+    /**
+     * Reset the device context to its initial state for drawing a new page.
+     * The SVG writer is kept with its buffers, which avoids re-allocating them for every page rendered.
+     */
+    void Reset();
+
     /**
      * @name Setters
      */
@@ -212,15 +554,21 @@ public:
      */
     void SetHtml5(bool html5) { m_html5 = html5; }
 
+    /**
+     * Setter for writing the SVG directly as a stream instead of building a DOM (false by default).
+     * It has to be called before drawing.
+     */
+    void SetStreaming(bool streaming);
+
     /**
      * Setter for indent of the SVG (default is 3, -1 for tabs)
      */
-    void SetIndent(int indent) { m_indent = indent; }
+    void SetIndent(int indent);
 
     /**
      * Set the SVG to have 'raw' formatting, with no extraneous whitespace or newlines.
      */
-    void SetFormatRaw(bool rawFormat) { m_formatRaw = rawFormat; }
+    void SetFormatRaw(bool rawFormat);
 
     /**
      * Removes the xlink: prefex on href attributes, necessary for some newer browsers.
@@ -252,6 +600,16 @@ public:
     void SetSmuflTextFont(option_SMUFLTEXTFONT smuflTextFont) { m_smuflTextFont = smuflTextFont; }
 
 private:
+    /**
+     * Create the writer for the streaming mode and start the root <svg> element
+     */
+    void CreateWriter();
+
+    /**
+     * Start the root <svg> element in the writer
+     */
+    void StartRootElement();
+
     /**
      * Copy the content of a file to the output stream.
      * This is used for copying <defs> items.
@@ -293,15 +651,23 @@ private:
 
     std::string GetColor(int color);
 
-    pugi::xml_node AddChild(std::string name);
+    /**
+     * Return where a child is inserted in the current element, that is before its first <g> child if any
+     */
+    SvgWriter::Position GetChildPosition() const;
 
     /**
-     * Transform pen properties into stroke attributes
+     * Start a leaf in the current element at the child position
+     */
+    void AddChild(const std::string &name);
+
+    /**
+     * Transform pen properties into stroke attributes of the leaf being written
      */
     ///@{
-    void AppendStrokeLineCap(pugi::xml_node node, const Pen &pen);
-    void AppendStrokeLineJoin(pugi::xml_node node, const Pen &pen);
-    void AppendStrokeDashArray(pugi::xml_node node, const Pen &pen);
+    void AppendStrokeLineCap(const Pen &pen);
+    void AppendStrokeLineJoin(const Pen &pen);
+    void AppendStrokeDashArray(const Pen &pen);
     ///@}
 
 public:
@@ -319,11 +685,10 @@ private:
      */
     bool m_vrvTextFontFallback;
 
-    // we use a std::stringstream because we want to prepend the <defs> which will know only when we reach the end of
-    // the page
+    // the <defs> are prepended once we reach the end of the page because
     // some viewer seem to support to have the <defs> at the end, but some do not (pdf2svg, for example)
-    // for this reason, the full svg is finally written a string from the destructor or when Flush() is called
-    std::ostringstream m_outdata;
+    // for this reason, the full svg is finally written to a string when Commit() is called
+    std::string m_outdata;
 
     bool m_committed; // did we flushed the file?
     int m_originX, m_originY;
@@ -332,12 +697,13 @@ private:
     // they will be added at the end of the file as <defs>
     std::set<const Glyph *> m_smuflGlyphs;
 
-    // pugixml data
-    pugi::xml_document m_svgDoc;
-    pugi::xml_node m_svgNode;
-    pugi::xml_node m_pageNode;
-    pugi::xml_node m_currentNode;
-    std::list<pugi::xml_node> m_svgNodeStack;
+    // the SVG markup written so far
+    std::unique_ptr<SvgWriter> m_writer;
+    // write the SVG as a stream instead of building a DOM
+    bool m_streaming;
+    // formatting
+    int m_indent;
+    bool m_formatRaw;
 
     // output as mm (for pdf generation with a 72 dpi)
     bool m_mmOutput;
@@ -352,12 +718,8 @@ private:
     std::string m_css;
     // copy additional attributes of given elements to the SVG, in the form "note@pname; layer@n"
     std::multimap<ClassId, std::string> m_svgAdditionalAttributes;
-    // format output as raw, stripping extraneous whitespace and non-content newlines
-    bool m_formatRaw;
     // remove xlink from href attributes
     bool m_removeXlink;
-    // indentation value (-1 for tabs)
-    int m_indent;
     // prefix to be added to font glyphs
     std::string m_glyphPostfixId;
     // embedding of the smufl text font
@@ -48,6 +48,15 @@ public:
     void AppendTextToCell(int index, TextElement *text);
     ///@}
 
+    /**
+     * @name Getter and setter for the vertical positions of the cell content.
+     * Used for restoring the positions of a running element shared between pages.
+     */
+    ///@{
+    std::vector<int> GetCellDrawingYRels() const;
+    void SetCellDrawingYRels(const std::vector<int> &drawingYRels);
+    ///@}
+
     /**
      * @name Setter and getter for the drawing scaling
      */
@@ -10,13 +10,16 @@
 
 #include <cassert>
 #include <map>
+#include <ostream>
 #include <string>
+#include <unordered_map>
 #include <vector>
 
 //----------------------------------------------------------------------------
 
 namespace vrv {
 
+class Measure;
 class Object;
 
 //----------------------------------------------------------------------------
@@ -66,8 +69,32 @@ public:
      */
     void ToJson(std::string &output, bool includetRests, bool includetMeasures);
 
+    /**
+     * @name Write the current timemap in the compact encoding.
+     * The values are stored in columns with one value per entry ("tstamp", "qstamp" and "tempo") and the IDs are
+     * interned in an "ids" table and referred to by their index. The "on", "off", "restsOn" and "restsOff"
+     * columns hold a list of indices per entry and "measureOn" an index per entry (-1 if none).
+     * The JSON is written to the stream as it is generated.
+     * The binary buffer is little-endian:
+     * - "VTM1", flags (uint32, 1 for rests and 2 for measures), entry count (uint32) and ID count (uint32)
+     * - the IDs, each as a length (uint32) followed by the UTF-8 bytes
+     * - the tstamp, qstamp and tempo columns (float64 each)
+     * - the on, off, and with rests restsOn and restsOff columns, each as the index counts per entry (uint32)
+     *   followed by all the indices (uint32)
+     * - with measures, the measureOn column (int32)
+     */
+    ///@{
+    void ToCompactJson(std::ostream &output, bool includeRests, bool includeMeasures) const;
+    void ToBinary(std::vector<unsigned char> &output, bool includeRests, bool includeMeasures) const;
+    ///@}
+
 private:
-    //
+    /**
+     * Intern the IDs in the order of their first appearance and return the list
+     */
+    std::vector<const std::string *> InternIDs(
+        std::unordered_map<std::string, int> &indices, bool includeRests, bool includeMeasures) const;
+
 public:
     //
 private:
@@ -76,6 +103,132 @@ private:
 
 }; // class Timemap
 
+//----------------------------------------------------------------------------
+// TimeIndexEntry
+//----------------------------------------------------------------------------
+
+/**
+ * Helper struct to store time index entries.
+ * Onset and offset values are absolute, i.e., they include the offset of the measure for the given repeat.
+ */
+struct TimeIndexEntry {
+    const Object *object;
+    const Measure *measure;
+    // The playing repeat (1-based)
+    int repeat;
+    // The position of the object in the document order
+    int order;
+    double realTimeOnset;
+    double realTimeOffset;
+    double scoreTimeOnset;
+    double scoreTimeOffset;
+};
+
+//----------------------------------------------------------------------------
+// TimeIndex
+//----------------------------------------------------------------------------
+
+/**
+ * This class holds an index of the measures, notes and rests by real time (in milliseconds) and
+ * by score time (in quarter notes).
+ * Entries are stored in sorted arrays augmented with the maximum offset of each implicit subtree,
+ * which makes it possible to find all the intervals enclosing a time or overlapping a time range in
+ * O(log n + k).
+ */
+class TimeIndex {
+public:
+    /**
+     * @name Constructors, destructors, and other standard methods
+     */
+    ///@{
+    TimeIndex();
+    virtual ~TimeIndex();
+    ///@}
+
+    /** Resets the time index */
+    void Reset();
+
+    /**
+     * Add an entry to the index.
+     * Measures are kept separately from the notes and rests.
+     * The index needs to be finalized with Build() once all entries are added.
+     */
+    void AddEntry(const TimeIndexEntry &entry);
+
+    /**
+     * Sort the entries and calculate the augmented values.
+     */
+    void Build();
+
+    /**
+     * Check if the index contains any entry.
+     */
+    bool IsEmpty() const { return m_measures.empty() && m_elements.empty(); }
+
+    /**
+     * @name Find the measures or the elements (notes and rests) with a time interval overlapping [from, to].
+     * Bounds are inclusive. Entries are returned in the document order and by repeat.
+     */
+    ///@{
+    void FindMeasuresByRealTime(double from, double to, std::vector<const TimeIndexEntry *> &entries) const;
+    void FindMeasuresByScoreTime(double from, double to, std::vector<const TimeIndexEntry *> &entries) const;
+    void FindElementsByRealTime(double from, double to, std::vector<const TimeIndexEntry *> &entries) const;
+    void FindElementsByScoreTime(double from, double to, std::vector<const TimeIndexEntry *> &entries) const;
+    ///@}
+
+    /**
+     * Return the entries for an object, one per repeat.
+     * Return an empty vector if the object is not in the index.
+     */
+    std::vector<const TimeIndexEntry *> GetEntries(const Object *object) const;
+
+private:
+    /**
+     * Helper class for one set of intervals in one time dimension.
+     */
+    class IntervalTree {
+    public:
+        void Clear();
+        void Build(const std::vector<TimeIndexEntry> &entries, bool scoreTime);
+        void Find(const std::vector<TimeIndexEntry> &entries, double from, double to,
+            std::vector<const TimeIndexEntry *> &results) const;
+
+    private:
+        double BuildMaxOffsets(int begin, int end);
+        void Find(const std::vector<TimeIndexEntry> &entries, int begin, int end, double from, double to,
+            std::vector<const TimeIndexEntry *> &results) const;
+
+    private:
+        // The entry positions sorted by onset
+        std::vector<int> m_positions;
+        std::vector<double> m_onsets;
+        std::vector<double> m_offsets;
+        // The maximum offset of the implicit subtree rooted at each position
+        std::vector<double> m_maxOffsets;
+    };
+
+    /**
+     * Find the entries in one of the trees and sort them by document order.
+     */
+    void Find(const std::vector<TimeIndexEntry> &entries, const IntervalTree &tree, double from, double to,
+        std::vector<const TimeIndexEntry *> &results) const;
+
+public:
+    //
+private:
+    /** The measure entries and the note and rest entries */
+    std::vector<TimeIndexEntry> m_measures;
+    std::vector<TimeIndexEntry> m_elements;
+    /** The trees for both time dimensions */
+    IntervalTree m_measuresByRealTime;
+    IntervalTree m_measuresByScoreTime;
+    IntervalTree m_elementsByRealTime;
+    IntervalTree m_elementsByScoreTime;
+    /** A map from the objects to their entry positions in m_measures or m_elements */
+    std::unordered_map<const Object *, std::vector<int>> m_objectEntries;
+
+}; // class TimeIndex
+
 } // namespace vrv
 
 #endif // __VRV_TIMEMAP_H__
@@ -8,6 +8,10 @@
 #ifndef __VRV_TOOLKIT_H__
 #define __VRV_TOOLKIT_H__
 
+#include <functional>
+#include <istream>
+#include <ostream>
+#include <memory>
 #include <string>
 
 //----------------------------------------------------------------------------
@@ -23,6 +27,23 @@ namespace vrv {
 
 class EditorToolkit;
 class RuntimeClock;
+class SvgDeviceContext;
+
+//----------------------------------------------------------------------------
+// PAEBatchRecord
+//----------------------------------------------------------------------------
+
+/**
+ * The input and the output of a record rendered by Toolkit::RenderPAEBatch.
+ */
+struct PAEBatchRecord {
+    std::string m_id;
+    std::string m_input;
+    bool m_valid = false;
+    std::string m_svg;
+    std::string m_mei;
+    std::vector<std::string> m_log;
+};
 
 /**
  * @defgroup nodoc Public methods that are not listed in the documentation
@@ -32,6 +53,18 @@ class RuntimeClock;
 // Toolkit
 //----------------------------------------------------------------------------
 
+/**
+ * The toolkit for loading, laying out and rendering a document.
+ *
+ * A toolkit can only be used by one thread at a time, but different toolkits can be used concurrently from
+ * different threads. The fonts and glyph definitions are shared between toolkits and are read-only once loaded, and
+ * the log buffer and the default resource path are kept per thread (a toolkit created in another thread has to be
+ * given its resource path). The global log settings should be set before the threads are started.
+ * Because humlib has global state, every call going through it is serialized with a mutex shared by all the
+ * toolkits: LoadData (and the methods calling it) for the Humdrum, MuseData, EsAC and MusicXML via Humdrum input
+ * formats, ConvertMEIToHumdrum, ConvertHumdrumToHumdrum, GetHumdrum and GetHumdrumFile. They can be called from
+ * different threads but do not run in parallel.
+ */
 class Toolkit {
 public:
     /**
@@ -91,11 +124,19 @@ public:
 
     /**
      * Get the log content for the latest operation.
+     * The log is buffered per thread, so the operation must have been run from the same thread.
      *
      * @return The log content as a string
      */
     std::string GetLog();
 
+    /**
+     * Set the user data given to the log callback for the messages of this toolkit.
+     * This replaces the user data passed to vrv::SetLogCallback, for example for knowing which toolkit is logging.
+     * NULL (the default) uses the one passed to vrv::SetLogCallback.
+     */
+    void SetLogCallbackUserData(void *userData) { m_logCallbackUserData = userData; }
+
     /**
      * Return the version number.
      *
@@ -368,6 +409,63 @@ public:
      */
     bool RenderToSVGFile(const std::string &filename, int pageNo = 1);
 
+    /**
+     * Render a range of pages to SVG.
+     *
+     * The pages are laid out one after the other and then drawn concurrently by the number of threads given by
+     * the "threads" option. The output is the same as rendering the pages one by one with RenderToSVG.
+     *
+     * @param firstPageNo The first page to render (1-based)
+     * @param lastPageNo The last page to render (1-based and included)
+     * @param xmlDeclaration True for including the xml declaration in the SVG output
+     * @return The SVG pages as a vector of strings
+     */
+    std::vector<std::string> RenderPagesToSVG(int firstPageNo, int lastPageNo, bool xmlDeclaration = false);
+
+    /**
+     * Render all the pages to SVG.
+     *
+     * See RenderPagesToSVG.
+     *
+     * @remark nojs
+     *
+     * @param xmlDeclaration True for including the xml declaration in the SVG output
+     * @return The SVG pages as a vector of strings
+     */
+    std::vector<std::string> RenderAllToSVG(bool xmlDeclaration = false);
+
+    /**
+     * Render a batch of Plaine & Easie incipits to SVG.
+     *
+     * The records are rendered concurrently by the number of threads given by the "threads" option with the
+     * current options. Each thread loads its records into the same document, so that the resources and the
+     * memory of the document are reused from one record to the next.
+     *
+     * @param records The records as a JSON array or as JSON Lines. A record is either a PAE JSON object with an
+     * optional "id" key or a PAE string.
+     * @param jsonOptions A stringified JSON object with the batch options ("mei": true for including the MEI of
+     * each record)
+     * @return A stringified JSON array with one object per record in the input order with the "id", "valid",
+     * "svg", "mei" and "log" of the record
+     */
+    std::string RenderPAEBatch(const std::string &records, const std::string &jsonOptions = "");
+
+    /**
+     * Render a stream of Plaine & Easie incipits given as JSON Lines to SVG.
+     *
+     * The records are read and rendered by chunks and passed to the callback in the input order, so that the
+     * memory used does not depend on the length of the stream. See RenderPAEBatch.
+     *
+     * @remark nojs
+     *
+     * @param records The input stream with one record per line
+     * @param callback The function called with each rendered record
+     * @param includeMEI True for including the MEI of each record
+     * @return The number of records rendered
+     */
+    int RenderPAEBatchStream(std::istream &records, const std::function<void(const PAEBatchRecord &)> &callback,
+        bool includeMEI = false);
+
     /**
      * Render the document to MIDI.
      *
@@ -375,6 +473,18 @@ public:
      */
     std::string RenderToMIDI();
 
+    /**
+     * Render the document to MIDI as raw bytes.
+     *
+     * The MIDI file is written directly into the buffer, without base64 encoding.
+     * In Python, the bytes are returned. In JavaScript, a Uint8Array over the memory of the module is returned,
+     * which is valid until the next call to the toolkit.
+     *
+     * @param output The buffer filled with the MIDI file
+     * @return True if the MIDI file was successfully written
+     */
+    bool RenderToMIDIBuffer(std::vector<unsigned char> &output);
+
     /**
      * Render a document to MIDI and save it to the file.
      *
@@ -409,11 +519,30 @@ public:
     /**
      * Render a document to a timemap.
      *
-     * @param jsonOptions A stringified JSON objects with the timemap options
+     * The format option selects the encoding: "json" (default) for an array with one object per onset, "compact"
+     * for columns of values with interned IDs, or "binary" for the compact encoding as a base64-encoded binary
+     * buffer (see Timemap::ToBinary).
+     *
+     * @param jsonOptions A stringified JSON objects with the timemap options;
+     * includeMeasures: true or false; false by default;
+     * includeRests: true or false; false by default;
+     * format: "json", "compact" or "binary"; "json" by default;
      * @return The timemap as a string
      */
     std::string RenderToTimemap(const std::string &jsonOptions = "");
 
+    /**
+     * Render a document to a timemap in the compact binary encoding.
+     *
+     * In Python, the bytes are returned. In JavaScript, a Uint8Array over the memory of the module is returned,
+     * which is valid until the next call to the toolkit.
+     *
+     * @param output The buffer filled with the timemap
+     * @param jsonOptions A stringified JSON objects with the timemap options (the format is ignored)
+     * @return True if the timemap was successfully generated
+     */
+    bool RenderToTimemapBuffer(std::vector<unsigned char> &output, const std::string &jsonOptions = "");
+
     /**
      * Render a document's expansionMap, if existing
      *
@@ -423,6 +552,7 @@ public:
 
     /**
      * Render a document to timemap and save it to the file.
+     * The compact encodings are written to the file as they are generated.
      *
      * @remark nojs
      *
@@ -508,6 +638,19 @@ public:
      */
     std::string GetMEI(const std::string &jsonOptions = "");
 
+    /**
+     * Write the MEI to an output stream.
+     *
+     * The MEI is written to the stream measure by measure and is never held as a whole in memory.
+     *
+     * @remark nojs
+     *
+     * @param output The output stream
+     * @param jsonOptions A stringified JSON object with the output options (see Toolkit::GetMEI)
+     * @return True if the MEI was successfully written
+     */
+    bool WriteMEI(std::ostream &output, const std::string &jsonOptions = "");
+
     /**
      * Get the MEI and save it to the file.
      *
@@ -546,6 +689,18 @@ public:
      */
     std::string GetElementsAtTime(int millisec);
 
+    /**
+     * Return array of IDs of elements being played within a time range.
+     *
+     * The range is given in milliseconds with "start" and "end", or in quarter notes when "scoreTime" is true.
+     * Elements are returned if they are played between start (inclusive) and end (exclusive).
+     * Elements are listed once even if they are played more than once in the range.
+     *
+     * @param jsonOptions A stringified JSON object with the time range
+     * @return A stringified JSON object with the notes, chords, rests and measures being played
+     */
+    std::string GetElementsInTimeRange(const std::string &jsonOptions);
+
     /**
      * Return the page on which the element is the ID (\@xml:id) is rendered
      *
@@ -607,12 +762,31 @@ public:
      *
      * Return scoreTimeOnset, scoreTimeOffset, scoreTimeTiedDuration,
      * realTimeOnsetMilliseconds, realTimeOffsetMilliseconds, realTimeTiedDurationMilliseconds.
+     * The real time values are the ones of the first playing of the measure. The ones of every playing repeat of the
+     * measure are given in repeatRealTimeOnsetMilliseconds and repeatRealTimeOffsetMilliseconds.
      *
      * @param xmlId the ID (\@xml:id) of the element being looked for
      * @return A stringified JSON object with the values
      */
     std::string GetTimesForElement(const std::string &xmlId);
 
+    /**
+     * @name Batch variants of the element query methods
+     *
+     * The query is a JSON array of IDs, or a JSON object with "ids" (an array of IDs) or "page" (the page
+     * number, 1-based, for querying all the notes on the page).
+     * The elements are looked up with the ID index of the document, or in a single traversal when it is not active.
+     *
+     * @param jsonQuery A stringified JSON array or object with the IDs of the elements being looked for
+     * @return A stringified JSON object with, for each ID, the value returned by the single element method
+     */
+    ///@{
+    std::string GetElementsAttr(const std::string &jsonQuery);
+    std::string GetPagesWithElements(const std::string &jsonQuery);
+    std::string GetMIDIValuesForElements(const std::string &jsonQuery);
+    std::string GetTimesForElements(const std::string &jsonQuery);
+    ///@}
+
     ///@}
 
     /**
@@ -625,6 +799,9 @@ public:
      *
      * This can be called once the rendering option were changed, for example with a new page (sceen) height or a new
      * zoom level.
+     * After editing the content with Edit(), resetCache can be set to false. Only the measures modified by the edits
+     * are then laid out again and the cached horizontal layout is reused for all the other ones.
+     * This is the case with the CMN editor only. With neume notation, the cache is always reset.
      *
      * @param jsonOptions A stringified JSON object with the action options
      * resetCache: true or false; true by default;
@@ -684,6 +861,13 @@ public:
      */
     const char *GetCString();
 
+    /**
+     * Return the internal byte buffer, used for returning binary output without copying it.
+     *
+     * @ingroup nodoc
+     */
+    std::vector<unsigned char> &GetCBuffer() { return m_cBuffer; }
+
     /**
      * Write the Humdrum buffer to the outputstream.
      *
@@ -758,18 +942,48 @@ protected:
     void PrintOptionUsageOutput(const vrv::Option *option, std::ostream &output) const;
 
     /**
-     * Resets the vrv::logBuffer.
+     * Resets the vrv::logBuffer of the calling thread.
+     * Also makes the log callback user data of the toolkit the one of the calling thread.
      */
     void ResetLogBuffer();
 
+    /**
+     * Make the log callback user data of the toolkit the one of the calling thread.
+     * Called at the beginning of the operations not resetting the log buffer.
+     */
+    void SetThreadLogUserData() const;
+
 private:
     bool SetFont(const std::string &fontName);
+    void SetSvgOptions(SvgDeviceContext &svg);
+    void RenderToDeviceContext(View &view, const DrawingPageContext &context, DeviceContext *deviceContext);
     bool IsUTF16(const std::string &filename);
     bool LoadUTF16File(const std::string &filename);
     bool IsZip(const std::string &filename);
     bool LoadZipFile(const std::string &filename);
     bool LoadZipData(const std::vector<unsigned char> &bytes);
     void GetClassIds(const std::vector<std::string> &classStrings, std::vector<ClassId> &classIds);
+    void ReadTimemapOptions(
+        const std::string &jsonOptions, std::string &format, bool &includeRests, bool &includeMeasures) const;
+
+    /**
+     * @name Methods for looking up the elements of a query
+     */
+    ///@{
+    bool FindElementsForQuery(const std::string &jsonQuery, ArrayOfIDObjectPairs &elements);
+    const Object *FindElementInLayerStaffDefs(const std::string &xmlId);
+    ///@}
+
+    /**
+     * @name Methods for rendering a batch of PAE records
+     */
+    ///@{
+    static bool ReadPAERecord(const std::string &line, PAEBatchRecord &record);
+    std::vector<std::unique_ptr<Toolkit>> CreatePAEWorkers(int recordCount) const;
+    void RenderPAERecords(std::vector<PAEBatchRecord> &records, int firstIndex,
+        std::vector<std::unique_ptr<Toolkit>> &workers, bool includeMEI);
+    void RenderPAERecord(PAEBatchRecord &record, int index, bool includeMEI);
+    ///@}
 
     /**
      * Return a dictionary of all the options
@@ -791,9 +1005,25 @@ private:
     Options *m_options;
 
     /**
-     * The C buffer string.
+     * The C buffer string and the byte buffer for binary output.
      */
     char *m_cString;
+    std::vector<unsigned char> m_cBuffer;
+
+    /**
+     * The Humdrum buffer, owned by each toolkit so that toolkits can be used concurrently.
+     */
+    char *m_humdrumBuffer;
+
+    /**
+     * The user data given to the log callback for the messages of the toolkit.
+     */
+    void *m_logCallbackUserData;
+
+    /**
+     * The SVG device context kept between the pages rendered when the memory is recycled.
+     */
+    SvgDeviceContext *m_svgDeviceContext;
 
     EditorToolkit *m_editorToolkit;
 
@@ -801,12 +1031,6 @@ private:
     /** Measuring runtime */
     RuntimeClock *m_runtimeClock;
 #endif
-
-    //----------------//
-    // Static members //
-    //----------------//
-
-    static char *m_humdrumBuffer;
 };
 
 } // namespace vrv
@@ -34,6 +34,11 @@ enum { LOG_OFF = 0, LOG_ERROR, LOG_WARNING, LOG_INFO, LOG_DEBUG };
 
 typedef int LogLevel;
 
+/**
+ * Callback receiving the formatted log messages with the user data passed to SetLogCallback
+ */
+typedef void (*LogCallback)(LogLevel level, const char *message, void *userData);
+
 /**
  * Functions defined here to be available in SWIG bindings
  */
@@ -50,6 +55,14 @@ void SetDefaultResourcePath(const std::string &path);
 
 void EnableLog(LogLevel level);
 void EnableLogToBuffer(bool value);
+/**
+ * Send the log messages to the callback instead of the buffer or the console.
+ * The callback can be called concurrently from any thread and has to be thread-safe. It is called without holding
+ * any lock, so it can still be called by another thread right after having been replaced. NULL disables it.
+ * The user data is given to the callback unless the toolkit logging has its own (see
+ * Toolkit::SetLogCallbackUserData).
+ */
+void SetLogCallback(LogCallback callback, void *userData = NULL);
 
 } // namespace vrv
 
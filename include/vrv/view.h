@@ -8,6 +8,7 @@
 #ifndef __VRV_RENDERER_H__
 #define __VRV_RENDERER_H__
 
+#include <mutex>
 #include <optional>
 
 #include "devicecontextbase.h"
@@ -95,6 +96,54 @@ class Verse;
 // Helper enums
 enum class SlurHandling { Ignore, Initialize, Drawing };
 
+//----------------------------------------------------------------------------
+// DrawingPageContext
+//----------------------------------------------------------------------------
+
+/**
+ * This class holds the drawing values of a page once Doc::SetDrawingPage has been called and the page laid out.
+ * It is used by a View for drawing the page without changing the drawing page of the document.
+ */
+class DrawingPageContext {
+public:
+    /**
+     * Return true if the page dimensions and margins are the same as in the other context
+     */
+    bool HasSameDimensions(const DrawingPageContext &context) const;
+
+public:
+    /** The page */
+    Page *m_page = NULL;
+    /** The page dimensions and margins */
+    ///@{
+    int m_pageHeight = 0;
+    int m_pageWidth = 0;
+    int m_pageContentHeight = 0;
+    int m_pageContentWidth = 0;
+    int m_pageMarginBottom = 0;
+    int m_pageMarginLeft = 0;
+    int m_pageMarginRight = 0;
+    int m_pageMarginTop = 0;
+    ///@}
+    /** The page width and height adjusted to the content (see Doc::GetAdjustedDrawingPageWidth) */
+    ///@{
+    int m_adjustedPageWidth = 0;
+    int m_adjustedPageHeight = 0;
+    ///@}
+    /** The vertical position of the header and of the footer (shared between pages) */
+    ///@{
+    int m_headerYRel = VRV_UNSET;
+    int m_footerYRel = VRV_UNSET;
+    std::vector<int> m_headerCellYRels;
+    std::vector<int> m_footerCellYRels;
+    ///@}
+    /**
+     * The id counter for the temporary objects created when drawing the page.
+     * It is derived from the id counter of the thread taking the context, which lays out the pages in order.
+     */
+    uint32_t m_idCounter = 0;
+};
+
 //----------------------------------------------------------------------------
 // View
 //----------------------------------------------------------------------------
@@ -168,16 +217,35 @@ public:
      */
     void SetPage(int pageIdx, bool doLayout = true);
 
+    /**
+     * Set the current page from a drawing page context taken from the document after the layout of the page.
+     * The drawing page of the document is then not changed when drawing the page, which makes it possible
+     * for several views to draw pages concurrently. In that case, a mutex shared by the views must be given
+     * for the elements drawn on several pages (time spanning elements, header and footer).
+     */
+    void SetPageContext(const DrawingPageContext &context, std::mutex *sharedElementMutex = NULL);
+
     /**
      * Method that actually draw the current page.
      * This is the only drawing method that is public and that can be called for drawing.
      * The method also takes care of setting the drawing page of the document by calling
-     * Doc::SetDrawingPage. It means that we have different views, each view can have a different
-     * current page and it will still work properly.
+     * Doc::SetDrawingPage (unless the page was set with SetPageContext). It means that we have
+     * different views, each view can have a different current page and it will still work properly.
      * Defined in view_page.cpp
      */
     void DrawCurrentPage(DeviceContext *dc, bool background = true);
 
+    /**
+     * @name Methods for drawing the current page by parts
+     * They are used for filling the bounding boxes when the systems of a page are laid out concurrently, each
+     * thread having its own view. The page elements are not drawn.
+     * Defined in view_page.cpp
+     */
+    ///@{
+    void DrawCurrentPageRunningElements(DeviceContext *dc);
+    void DrawCurrentPageSystem(DeviceContext *dc, System *system);
+    ///@}
+
     /**
      * Return the pixel per unit factor of the current page (if any, 1.0 otherwise)
      */
@@ -199,6 +267,11 @@ public:
     void SetSlurHandling(SlurHandling slurHandling) { m_slurHandling = slurHandling; }
     ///@}
 
+    /**
+     * Set filters for drawing only some of the measures (e.g., when laying them out again)
+     */
+    void SetMeasureFilters(Filters *filters) { m_measureFilters = filters; }
+
 protected:
     /**
      * @name Methods for drawing System, ScoreDef, StaffDef, Staff, and Layer.
@@ -687,6 +760,11 @@ protected:
      */
     SlurHandling m_slurHandling;
 
+    /**
+     * The filters for the measures to be drawn (all if NULL)
+     */
+    Filters *m_measureFilters;
+
     /**
      * The current drawing score def.
      * The is set when starting to draw a page in DrawCurrentPage and then
@@ -694,6 +772,22 @@ protected:
      */
     ScoreDef m_drawingScoreDef;
 
+    /**
+     * The drawing values of the current page.
+     * They are taken from the document in SetPage and DrawCurrentPage unless set with SetPageContext.
+     */
+    DrawingPageContext m_pageContext;
+
+    /**
+     * A flag indicating that the page was set with SetPageContext
+     */
+    bool m_hasOwnPageContext;
+
+    /**
+     * The mutex shared with the views drawing other pages concurrently (if any)
+     */
+    std::mutex *m_sharedElementMutex;
+
 private:
     //----------------//
     // Static members //
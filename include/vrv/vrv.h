@@ -8,9 +8,11 @@
 #ifndef __VRV_H__
 #define __VRV_H__
 
+#include <atomic>
 #include <cstdarg>
 #include <cstdio>
 #include <cstring>
+#include <functional>
 #include <map>
 #include <string>
 #include <unordered_map>
@@ -41,9 +43,21 @@ void LogWarning(const char *fmt, ...);
 
 /**
  * Member and functions specific to logging that uses a vector of string to buffer the logs.
+ * The buffer is specific to each thread and a message already in it is not added again.
  */
-extern std::vector<std::string> logBuffer;
+extern thread_local std::vector<std::string> logBuffer;
 bool LogBufferContains(const std::string &s);
+void LogBufferClear();
+void LogBufferAppend(const std::vector<std::string> &messages);
+
+/**
+ * The user data of the toolkit used on the calling thread, given to the log callback instead of the global one.
+ * NULL uses the global one.
+ */
+///@{
+void SetLogToolkitUserData(void *userData);
+void *GetLogToolkitUserData();
+///@}
 void LogString(std::string message, LogLevel level);
 
 /**
@@ -86,6 +100,12 @@ std::string UTF32to8(const std::u32string &in);
  */
 std::u32string UTF8to32(const std::string &in);
 
+/**
+ * Return the current local time.
+ * Thread-safe replacement for localtime(time(0))
+ */
+struct tm GetLocalTime();
+
 /**
  * Format a string using vsnprintf.
  * The maximum length is giving by STRING_FORMAT_MAX_LEN
@@ -110,6 +130,20 @@ std::string GetFilename(std::string fullpath);
  */
 std::string GetVersion();
 
+/**
+ * Return the number of threads to use for a value of the threads option (0 for the number of cores).
+ * This is always 1 when threads are not available, e.g., in a WebAssembly build without pthreads.
+ */
+int GetThreadCount(int threads);
+
+/**
+ * Run the task for each index from 0 to taskCount - 1 with at most threadCount threads, including the calling one.
+ * The other threads are taken from a pool shared by the whole process and started only once, with at most one
+ * worker less than the number of cores. The calling thread always runs tasks too, so they are all done even when
+ * the workers are busy with tasks from other threads. Return when all the tasks are done.
+ */
+void RunConcurrently(int taskCount, int threadCount, const std::function<void(int)> &task);
+
 /**
  * Encode the integer value using the specified base (max is 62)
  * Base 36 uses 0-9 and a-z, base 62 also A-Z.
@@ -129,8 +163,8 @@ std::string ToCamelCase(const std::string &s);
 /**
  *
  */
-extern LogLevel logLevel;
-extern bool loggingToBuffer;
+extern std::atomic<LogLevel> logLevel;
+extern std::atomic<bool> loggingToBuffer;
 
 /**
  * Functions for logging in milliseconds the elapsed time of an
@@ -9,6 +9,7 @@
 #define __VRV_DEF_H__
 
 #include <algorithm>
+#include <bitset>
 #include <functional>
 #include <list>
 #include <map>
@@ -298,7 +299,8 @@ enum InterfaceId {
     INTERFACE_SCOREDEF,
     INTERFACE_TEXT_DIR,
     INTERFACE_TIME_POINT,
-    INTERFACE_TIME_SPANNING
+    INTERFACE_TIME_SPANNING,
+    INTERFACE_max
 };
 
 //----------------------------------------------------------------------------
@@ -357,6 +359,8 @@ typedef std::map<std::string, Note *> MapOfNoteIDPairs;
 
 typedef std::vector<std::pair<PlistInterface *, std::string>> ArrayOfPlistInterfaceIDPairs;
 
+typedef std::vector<std::pair<std::string, Object *>> ArrayOfIDObjectPairs;
+
 typedef std::vector<CurveSpannedElement *> ArrayOfCurveSpannedElements;
 
 typedef std::list<std::pair<Object *, data_MEASUREBEAT>> ListOfObjectBeatPairs;
@@ -393,6 +397,8 @@ typedef std::map<std::string, std::function<Object *(void)>> MapOfStrConstructor
 
 typedef std::map<std::string, ClassId> MapOfStrClassIds;
 
+typedef std::bitset<UNSPECIFIED> ClassIdSet;
+
 typedef std::vector<std::pair<LayerElement *, LayerElement *>> MeasureTieEndpoints;
 
 typedef bool (*NotePredicate)(const Note *);
@@ -395,30 +395,53 @@ namespace {ns} {{
 CONVERTER_METHOD1_START_CPP = """
 std::string AttConverterBase::{fname}ToStr({type} data) const
 {{
-    std::string value;
-    switch (data) {{"""
+    static const char *const strings[{val_prefix}_MAX] = {{
+        "","""
 
 CONVERTER_METHOD2_START_CPP = """
 {type} AttConverterBase::StrTo{fname}(const std::string &value, bool logWarning) const
-{{"""
+{{
+    switch (value.size()) {{"""
 
 CONVERTER_METHOD1_CPP = """
-        case {val_prefix}_{value}: value = "{string}"; break;"""
+        "{string}","""
+
+CONVERTER_METHOD2_LENGTH_CPP = """
+        case {length}:"""
+
+CONVERTER_METHOD2_CHAR_START_CPP = """
+            switch (value[{index}]) {{"""
+
+CONVERTER_METHOD2_CHAR_CPP = """
+                case '{char}':"""
+
+CONVERTER_METHOD2_CHAR_VALUE_CPP = """
+                    if (value == "{string}") return {val_prefix}_{value};"""
+
+CONVERTER_METHOD2_CHAR_END_CPP = """
+                    break;"""
 
-CONVERTER_METHOD2_CPP = """
-    if (value == "{string}") return {val_prefix}_{value};"""
+CONVERTER_METHOD2_CHAR_SWITCH_END_CPP = """
+                default: break;
+            }}"""
+
+CONVERTER_METHOD2_VALUE_CPP = """
+            if (value == "{string}") return {val_prefix}_{value};"""
+
+CONVERTER_METHOD2_LENGTH_END_CPP = """
+            break;"""
 
 CONVERTER_METHOD1_END_CPP = """
-        default:
-            LogWarning("Unknown value '%d' for {type}", data);
-            value = "";
-            break;
-    }}
-    return value;
+    }};
+    if ((data > {prefix}_NONE) && (data < {prefix}_MAX)) return strings[data];
+    LogWarning("Unknown value '%d' for {type}", data);
+    return "";
 }}
 """
 
 CONVERTER_METHOD2_END_CPP = """
+        default: break;
+    }}
     if (logWarning && !value.empty())
         LogWarning("Unsupported value '%s' for {type}", value.c_str());
     return {prefix}_NONE;
@@ -579,6 +602,52 @@ def vrv_converter_cc(name: str) -> str:
     return left[0].upper() + left[1:] + rest
 
 
+def vrv_converter_from_str(val_prefix: str, values: list) -> str:
+    """
+    Generate the body of a StrTo converter. The values are dispatched with a switch on their length
+    and, when there are more than a few values with the same length, with a switch on the character
+    that discriminates them best. In most cases a single string comparison is then necessary.
+    """
+    by_length: dict = {}
+    for val, string in values:
+        by_length.setdefault(len(string.encode("utf-8")), []).append((val, string))
+
+    body: list = []
+    for length, candidates in sorted(by_length.items()):
+        body.append(CONVERTER_METHOD2_LENGTH_CPP.format(length=length))
+        if len(candidates) <= 3:
+            for val, string in candidates:
+                body.append(CONVERTER_METHOD2_VALUE_CPP.format(val_prefix=val_prefix, value=val, string=string))
+            body.append(CONVERTER_METHOD2_LENGTH_END_CPP)
+            continue
+
+        # the character position with the largest number of distinct values
+        encoded: list = [(val, string, string.encode("utf-8")) for val, string in candidates]
+        index: int = max(range(length), key=lambda i: (len({e[2][i] for e in encoded}), -i))
+        by_char: dict = {}
+        for val, string, enc in encoded:
+            by_char.setdefault(enc[index], []).append((val, string))
+
+        body.append(CONVERTER_METHOD2_CHAR_START_CPP.format(index=index))
+        for char, char_candidates in sorted(by_char.items()):
+            body.append(CONVERTER_METHOD2_CHAR_CPP.format(char=vrv_char_literal(char)))
+            for val, string in char_candidates:
+                body.append(CONVERTER_METHOD2_CHAR_VALUE_CPP.format(val_prefix=val_prefix, value=val, string=string))
+            body.append(CONVERTER_METHOD2_CHAR_END_CPP)
+        body.append(CONVERTER_METHOD2_CHAR_SWITCH_END_CPP.format())
+        body.append(CONVERTER_METHOD2_LENGTH_END_CPP)
+
+    return "".join(body)
+
+
+def vrv_char_literal(char: int) -> str:
+    if char in (ord("'"), ord("\\")):
+        return "\\" + chr(char)
+    if char < 32 or char > 126:
+        return f"\\x{char:02x}"
+    return chr(char)
+
+
 def vrv_get_att_config(module, gp, att) -> Optional[dict]:
     if module not in DATATYPES["modules"] or gp not in DATATYPES["modules"][module]:
         return None
@@ -881,13 +950,15 @@ def create_att_datatypes(cpp_ns: str, schema, outdir: Path):
         vrv_fname = vrv_converter_cc(vrv_type)
         converter_start_fmt = {
             "type": vrv_type,
-            "fname": vrv_fname
+            "fname": vrv_fname,
+            "val_prefix": val_prefix
         }
 
         att_converter_header_data_types.append(CONVERTER_METHODS_H.format_map(converter_start_fmt))
         att_converter_impl_from_converters.append(CONVERTER_METHOD1_START_CPP.format_map(converter_start_fmt))
         att_converter_impl_to_converters.append(CONVERTER_METHOD2_START_CPP.format_map(converter_start_fmt))
 
+        converter_values: list = []
         for v in values:
             val: str = re.sub(r"[\.\-\,]", "_", v)
             val = re.sub(r"\+", "plus", val)
@@ -899,7 +970,9 @@ def create_att_datatypes(cpp_ns: str, schema, outdir: Path):
 
             att_type_data_types.append(TYPE_VALUE.format_map(val_fmt))
             att_converter_impl_from_converters.append(CONVERTER_METHOD1_CPP.format_map(val_fmt))
-            att_converter_impl_to_converters.append(CONVERTER_METHOD2_CPP.format_map(val_fmt))
+            converter_values.append((val, v))
+
+        att_converter_impl_to_converters.append(vrv_converter_from_str(val_prefix, converter_values))
 
         att_type_data_types.append(TYPE_END.format(val_prefix=val_prefix))
 
@@ -937,12 +1010,14 @@ def create_att_datatypes(cpp_ns: str, schema, outdir: Path):
 
         converter_start_fmt = {
             "type": vrv_type,
-            "fname": vrv_fname
+            "fname": vrv_fname,
+            "val_prefix": val_prefix
         }
         att_converter_header_data_list.append(CONVERTER_METHODS_H.format_map(converter_start_fmt))
         att_converter_impl_from_converters.append(CONVERTER_METHOD1_START_CPP.format_map(converter_start_fmt))
         att_converter_impl_to_converters.append(CONVERTER_METHOD2_START_CPP.format_map(converter_start_fmt))
 
+        converter_values: list = []
         for v in values:
             val: str = re.sub(r"[\.\-\,]", "_", v)
             val = re.sub(r"\+", "plus", val)
@@ -953,7 +1028,9 @@ def create_att_datatypes(cpp_ns: str, schema, outdir: Path):
             }
             att_type_data_list.append(TYPE_VALUE.format_map(val_fmt))
             att_converter_impl_from_converters.append(CONVERTER_METHOD1_CPP.format_map(val_fmt))
-            att_converter_impl_to_converters.append(CONVERTER_METHOD2_CPP.format_map(val_fmt))
+            converter_values.append((val, v))
+
+        att_converter_impl_to_converters.append(vrv_converter_from_str(val_prefix, converter_values))
 
         att_type_data_list.append(TYPE_END.format(val_prefix=val_prefix))
         att_converter_impl_from_converters.append(CONVERTER_METHOD1_END_CPP.format(prefix=val_prefix, type=list_type))
@@ -24,6 +24,8 @@ namespace vrv {
 AdjustArpegFunctor::AdjustArpegFunctor(Doc *doc) : DocFunctor(doc)
 {
     m_measureAligner = NULL;
+
+    this->SetVisitedClasses({ ALIGNMENT, ARPEG, MEASURE });
 }
 
 FunctorCode AdjustArpegFunctor::VisitAlignment(Alignment *alignment)
@@ -413,6 +413,7 @@ AlignMeasuresFunctor::AlignMeasuresFunctor(Doc *doc) : DocFunctor(doc)
     m_justifiableWidth = 0;
     m_applySectionRestartShift = false;
     m_storeCastOffSystemWidths = false;
+    m_useCachedWidths = false;
 }
 
 FunctorCode AlignMeasuresFunctor::VisitDiv(Div *div)
@@ -433,7 +434,12 @@ FunctorCode AlignMeasuresFunctor::VisitMeasure(Measure *measure)
 
     measure->SetDrawingXRel(m_shift);
 
-    m_shift += measure->GetWidth();
+    if (m_useCachedWidths && measure->HasCachedHorizontalLayout()) {
+        m_shift += measure->GetCachedWidth();
+    }
+    else {
+        m_shift += measure->GetWidth();
+    }
     m_justifiableWidth += measure->GetRightBarLineXRel() - measure->GetLeftBarLineXRel();
 
     return FUNCTOR_SIBLINGS;
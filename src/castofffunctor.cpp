@@ -547,9 +547,7 @@ FunctorCode UnCastOffFunctor::VisitFloatingObject(FloatingObject *floatingObject
 FunctorCode UnCastOffFunctor::VisitMeasure(Measure *measure)
 {
     if (m_resetCache) {
-        measure->ResetCachedXRel();
-        measure->ResetCachedWidth();
-        measure->ResetCachedOverflow();
+        measure->ResetCachedHorizontalLayout();
     }
 
     return FUNCTOR_CONTINUE;
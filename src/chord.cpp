@@ -213,6 +213,7 @@ void Chord::AddChild(Object *child)
     else {
         children.push_back(child);
     }
+    this->IndexChild(child);
     Modify();
 }
 
@@ -9,6 +9,7 @@
 
 //----------------------------------------------------------------------------
 
+#include <algorithm>
 #include <cassert>
 #include <math.h>
 
@@ -68,6 +69,7 @@
 #include "transposefunctor.h"
 #include "transposition.h"
 #include "verse.h"
+#include "view.h"
 #include "vrv.h"
 #include "zone.h"
 
@@ -82,6 +84,10 @@ namespace vrv {
 // Doc
 //----------------------------------------------------------------------------
 
+thread_local FontInfo Doc::s_drawingSmuflFont;
+thread_local FontInfo Doc::s_drawingLyricFont;
+thread_local FontInfo Doc::s_fingeringFont;
+
 Doc::Doc() : Object(DOC, "doc-")
 {
     m_options = new Options();
@@ -90,6 +96,9 @@ Doc::Doc() : Object(DOC, "doc-")
     m_selectionPreceding = NULL;
     m_selectionFollowing = NULL;
 
+    m_idIndexSuspended = false;
+    m_idIndexRevision = 0;
+
     this->Reset();
 }
 
@@ -97,14 +106,28 @@ Doc::~Doc()
 {
     this->ClearSelectionPages();
 
+    // Delete the children before the index is destroyed
+    this->SuspendIDIndex();
+    this->ClearChildren();
+
     delete m_options;
 }
 
 void Doc::Reset()
 {
+    // No need to maintain the index while deleting the whole content
+    this->SuspendIDIndex();
     Object::Reset();
+    this->RebuildIDIndex();
 
     this->ClearSelectionPages();
+    // All the objects are deleted, so the memory can be released in bulk (or kept for the next load)
+    if (m_options->m_recycleMemory.GetValue()) {
+        m_arena.Recycle();
+    }
+    else {
+        m_arena.Release();
+    }
 
     m_type = Raw;
     m_notationType = NOTATIONTYPE_NONE;
@@ -128,6 +151,8 @@ void Doc::Reset()
     m_currentScoreDefDone = false;
     m_dataPreparationDone = false;
     m_timemapTempo = 0.0;
+    m_timeIndex.Reset();
+    m_timeIndexRevision = 0;
     m_markup = MARKUP_DEFAULT;
     m_isMensuralMusicOnly = false;
     m_isCastOff = false;
@@ -176,6 +201,52 @@ bool Doc::IsSupportedChild(Object *child)
     return true;
 }
 
+void Doc::RegisterID(Object *object)
+{
+    assert(object);
+
+    auto range = m_idIndex.equal_range(object->GetID());
+    for (auto iter = range.first; iter != range.second; ++iter) {
+        if (iter->second == object) return;
+    }
+    m_idIndex.insert({ object->GetID(), object });
+    ++m_idIndexRevision;
+}
+
+void Doc::UnregisterID(Object *object)
+{
+    assert(object);
+
+    auto range = m_idIndex.equal_range(object->GetID());
+    for (auto iter = range.first; iter != range.second;) {
+        if (iter->second == object) {
+            iter = m_idIndex.erase(iter);
+            ++m_idIndexRevision;
+        }
+        else {
+            ++iter;
+        }
+    }
+}
+
+void Doc::SuspendIDIndex()
+{
+    m_idIndex.clear();
+    m_idIndexSuspended = true;
+    ++m_idIndexRevision;
+}
+
+void Doc::RebuildIDIndex()
+{
+    m_idIndex.clear();
+    m_idIndexSuspended = false;
+    ++m_idIndexRevision;
+
+    for (Object *child : this->GetChildren()) {
+        if (child->GetParent() == this) child->AddToIDIndex(this);
+    }
+}
+
 bool Doc::GenerateDocumentScoreDef()
 {
     Measure *measure = vrv_cast<Measure *>(this->FindDescendantByType(MEASURE));
@@ -318,10 +389,9 @@ void Doc::GenerateMEIHeader(bool meiBasic)
     pugi::xml_node date = pubStmt.append_child("date");
 
     // date
-    time_t t = time(0); // get time now
-    struct tm *now = localtime(&t);
-    std::string dateStr = StringFormat("%d-%02d-%02d-%02d:%02d:%02d", now->tm_year + 1900, now->tm_mon + 1,
-        now->tm_mday, now->tm_hour, now->tm_min, now->tm_sec);
+    const struct tm now = GetLocalTime();
+    std::string dateStr = StringFormat("%d-%02d-%02d-%02d:%02d:%02d", now.tm_year + 1900, now.tm_mon + 1,
+        now.tm_mday, now.tm_hour, now.tm_min, now.tm_sec);
     date.append_attribute("isodate") = dateStr.c_str();
 
     if (!meiBasic) {
@@ -390,6 +460,31 @@ void Doc::CalculateTimemap()
     this->Process(initTimemapTies);
 
     m_timemapTempo = m_options->m_midiTempoAdjustment.GetValue();
+
+    this->BuildTimeIndex();
+}
+
+const TimeIndex &Doc::GetTimeIndex()
+{
+    if (!this->HasTimemap()) {
+        // generate MIDI timemap before progressing
+        this->CalculateTimemap();
+    }
+    else if (m_timeIndexRevision != m_idIndexRevision) {
+        this->BuildTimeIndex();
+    }
+    return m_timeIndex;
+}
+
+void Doc::BuildTimeIndex()
+{
+    m_timeIndex.Reset();
+    m_timeIndexRevision = m_idIndexRevision;
+
+    GenerateTimeIndexFunctor generateTimeIndex(&m_timeIndex);
+    this->Process(generateTimeIndex);
+
+    m_timeIndex.Build();
 }
 
 void Doc::ExportMIDI(smf::MidiFile *midiFile)
@@ -530,6 +625,19 @@ void Doc::ExportMIDI(smf::MidiFile *midiFile)
 }
 
 bool Doc::ExportTimemap(std::string &output, bool includeRests, bool includeMeasures)
+{
+    Timemap timemap;
+    if (!this->GenerateTimemap(timemap)) {
+        output = "{}";
+        return false;
+    }
+
+    timemap.ToJson(output, includeRests, includeMeasures);
+
+    return true;
+}
+
+bool Doc::GenerateTimemap(Timemap &timemap)
 {
     if (!this->HasTimemap()) {
         // generate MIDI timemap before progressing
@@ -537,16 +645,12 @@ bool Doc::ExportTimemap(std::string &output, bool includeRests, bool includeMeas
     }
     if (!this->HasTimemap()) {
         LogWarning("Calculation of the timemap failed, the timemap cannot be exported.");
-        output = "{}";
         return false;
     }
-    Timemap timemap;
     GenerateTimemapFunctor generateTimemap(&timemap);
     generateTimemap.SetCueExclusion(this->GetOptions()->m_midiNoCue.GetValue());
     this->Process(generateTimemap);
 
-    timemap.ToJson(output, includeRests, includeMeasures);
-
     return true;
 }
 
@@ -961,20 +1065,49 @@ void Doc::CastOffDocBase(bool useSb, bool usePb, bool smart)
 
     this->ScoreDefSetCurrentDoc();
 
+    // Content is moved around between pages, so rebuild the id index only once at the end
+    this->SuspendIDIndex();
+
     Page *unCastOffPage = this->SetDrawingPage(0);
     assert(unCastOffPage);
 
-    // Check if the the horizontal layout is cached by looking at the first measure
-    // The cache is not set the first time, or can be reset by Doc::UnCastOffDoc
-    Measure *firstMeasure = vrv_cast<Measure *>(unCastOffPage->FindDescendantByType(MEASURE));
-    if (!firstMeasure || !firstMeasure->HasCachedHorizontalLayout()) {
+    // Check if the the horizontal layout is cached by looking at the measures
+    // The cache is not set the first time, or can be reset by Doc::UnCastOffDoc or by editing a measure
+    ListOfObjects measures = unCastOffPage->FindAllDescendantsByType(MEASURE);
+    const int cachedCount = (int)std::count_if(measures.begin(), measures.end(),
+        [](Object *object) { return vrv_cast<Measure *>(object)->HasCachedHorizontalLayout(); });
+    if (cachedCount == 0) {
         // LogDebug("Performing the horizontal layout");
         unCastOffPage->LayOutHorizontally();
         unCastOffPage->LayOutHorizontallyWithCache();
     }
-    else {
+    else if (cachedCount == (int)measures.size()) {
         unCastOffPage->LayOutHorizontallyWithCache(true);
     }
+    else {
+        // LogDebug("Performing the horizontal layout of %d measures", measures.size() - cachedCount);
+        // Also lay out the first measure (for the scoreDef at the beginning of the system) and the measures next to
+        // the ones without cache, since the spacing of syllables and of overflowing content depends on them
+        std::vector<Measure *> neighbours = { vrv_cast<Measure *>(measures.front()) };
+        for (auto iter = measures.begin(); iter != measures.end(); ++iter) {
+            if (vrv_cast<Measure *>(*iter)->HasCachedHorizontalLayout()) continue;
+            if (iter != measures.begin()) neighbours.push_back(vrv_cast<Measure *>(*std::prev(iter)));
+            if (std::next(iter) != measures.end()) neighbours.push_back(vrv_cast<Measure *>(*std::next(iter)));
+        }
+        for (Measure *measure : neighbours) {
+            measure->ResetCachedHorizontalLayout();
+        }
+
+        CachedHorizontalLayoutComparison isCached;
+        Filters cachedFilters({ &isCached });
+        unCastOffPage->LayOutHorizontallyWithCache(true, &cachedFilters);
+
+        CachedHorizontalLayoutComparison isNotCached;
+        isNotCached.ReverseComparison();
+        Filters notCachedFilters({ &isNotCached });
+        unCastOffPage->LayOutHorizontally(&notCachedFilters);
+        unCastOffPage->LayOutHorizontallyWithCache();
+    }
 
     Page *castOffSinglePage = new Page();
 
@@ -1043,6 +1176,8 @@ void Doc::CastOffDocBase(bool useSb, bool usePb, bool smart)
     castOffSinglePage->Process(castOffPages);
     delete castOffSinglePage;
 
+    this->RebuildIDIndex();
+
     this->ScoreDefSetCurrentDoc(true);
     if (optimize) {
         this->ScoreDefOptimizeDoc();
@@ -1061,6 +1196,8 @@ void Doc::UnCastOffDoc(bool resetCache)
     Pages *pages = this->GetPages();
     assert(pages);
 
+    this->SuspendIDIndex();
+
     Page *unCastOffPage = new Page();
     UnCastOffFunctor unCastOff(unCastOffPage);
     unCastOff.SetResetCache(resetCache);
@@ -1070,6 +1207,8 @@ void Doc::UnCastOffDoc(bool resetCache)
 
     pages->AddChild(unCastOffPage);
 
+    this->RebuildIDIndex();
+
     // LogDebug("ContinuousLayout: %d pages", this->GetChildCount());
 
     // We need to reset the drawing page to NULL
@@ -1092,6 +1231,8 @@ void Doc::CastOffEncodingDoc()
     Pages *pages = this->GetPages();
     assert(pages);
 
+    this->SuspendIDIndex();
+
     Page *unCastOffPage = this->SetDrawingPage(0);
     assert(unCastOffPage);
     unCastOffPage->ResetAligners();
@@ -1107,6 +1248,8 @@ void Doc::CastOffEncodingDoc()
     unCastOffPage->Process(castOffEncoding);
     delete unCastOffPage;
 
+    this->RebuildIDIndex();
+
     // We need to reset the drawing page to NULL
     // because idx will still be 0 but contentPage is dead!
     this->ResetDataPage();
@@ -1810,23 +1953,23 @@ double Doc::GetCueScaling() const
 
 FontInfo *Doc::GetDrawingSmuflFont(int staffSize, bool graceSize)
 {
-    m_drawingSmuflFont.SetFaceName(m_options->m_font.GetValue().c_str());
+    s_drawingSmuflFont.SetFaceName(m_options->m_font.GetValue().c_str());
     int value = m_drawingSmuflFontSize * staffSize / 100;
     if (graceSize) value = value * m_options->m_graceFactor.GetValue();
-    m_drawingSmuflFont.SetPointSize(value);
-    return &m_drawingSmuflFont;
+    s_drawingSmuflFont.SetPointSize(value);
+    return &s_drawingSmuflFont;
 }
 
 FontInfo *Doc::GetDrawingLyricFont(int staffSize)
 {
-    m_drawingLyricFont.SetPointSize(m_drawingLyricFontSize * staffSize / 100);
-    return &m_drawingLyricFont;
+    s_drawingLyricFont.SetPointSize(m_drawingLyricFontSize * staffSize / 100);
+    return &s_drawingLyricFont;
 }
 
 FontInfo *Doc::GetFingeringFont(int staffSize)
 {
-    m_fingeringFont.SetPointSize(m_fingeringFontSize * staffSize / 100);
-    return &m_fingeringFont;
+    s_fingeringFont.SetPointSize(m_fingeringFontSize * staffSize / 100);
+    return &s_fingeringFont;
 }
 
 double Doc::GetMusicToLyricFontSizeRatio() const
@@ -2096,6 +2239,39 @@ int Doc::GetAdjustedDrawingPageHeight() const
     return (contentHeight + m_drawingPageMarginTop + m_drawingPageMarginBottom) / DEFINITION_FACTOR;
 }
 
+DrawingPageContext Doc::GetDrawingPageContext() const
+{
+    assert(m_drawingPage);
+
+    DrawingPageContext context;
+    context.m_page = m_drawingPage;
+    context.m_pageHeight = m_drawingPageHeight;
+    context.m_pageWidth = m_drawingPageWidth;
+    context.m_pageContentHeight = m_drawingPageContentHeight;
+    context.m_pageContentWidth = m_drawingPageContentWidth;
+    context.m_pageMarginBottom = m_drawingPageMarginBottom;
+    context.m_pageMarginLeft = m_drawingPageMarginLeft;
+    context.m_pageMarginRight = m_drawingPageMarginRight;
+    context.m_pageMarginTop = m_drawingPageMarginTop;
+    context.m_adjustedPageWidth = this->GetAdjustedDrawingPageWidth();
+    context.m_adjustedPageHeight = this->GetAdjustedDrawingPageHeight();
+    // Hashed so that the temporary ids do not overlap the ones generated next by the thread
+    context.m_idCounter = Object::Hash(Object::GetIDCounter(), true);
+
+    const RunningElement *header = m_drawingPage->GetHeader();
+    if (header) {
+        context.m_headerYRel = header->GetDrawingYRel();
+        context.m_headerCellYRels = header->GetCellDrawingYRels();
+    }
+    const RunningElement *footer = m_drawingPage->GetFooter();
+    if (footer) {
+        context.m_footerYRel = footer->GetDrawingYRel();
+        context.m_footerCellYRels = footer->GetCellDrawingYRels();
+    }
+
+    return context;
+}
+
 int Doc::GetAdjustedDrawingPageWidth() const
 {
     assert(m_drawingPage);
@@ -215,6 +215,7 @@ bool EditorToolkitCMN::Delete(std::string &elementId)
     if (!element) return false;
 
     if (element->Is(NOTE)) {
+        this->ResetCachedLayout(element);
         return this->DeleteNote(vrv_cast<Note *>(element));
     }
     return false;
@@ -234,6 +235,7 @@ bool EditorToolkitCMN::Drag(std::string &elementId, int x, int y)
             = (data_PITCHNAME)m_view->CalculatePitchCode(layer, m_view->ToLogicalY(y), element->GetDrawingX(), &oct);
         element->GetPitchInterface()->SetPname(pname);
         element->GetPitchInterface()->SetOct(oct);
+        this->ResetCachedLayout(element);
 
         return true;
     }
@@ -256,6 +258,7 @@ bool EditorToolkitCMN::KeyDown(std::string &elementId, int key, bool shiftKey, b
             default: step = 0;
         }
         interface->AdjustPitchByOffset(step);
+        this->ResetCachedLayout(element);
         return true;
     }
     return false;
@@ -306,6 +309,7 @@ bool EditorToolkitCMN::Insert(std::string &elementType, std::string const &start
     measure->AddChild(element);
     interface->SetStartid("#" + startid);
     interface->SetEndid("#" + endid);
+    measure->ResetCachedHorizontalLayout();
 
     m_chainedId = element->GetID();
     m_editInfo.import("uuid", element->GetID());
@@ -324,6 +328,7 @@ bool EditorToolkitCMN::Insert(std::string &elementType, std::string const &start
         return false;
     }
     if (elementType == "note") {
+        this->ResetCachedLayout(start);
         return this->InsertNote(start);
     }
     // Check if it is a LayerElement
@@ -352,6 +357,7 @@ bool EditorToolkitCMN::Insert(std::string &elementType, std::string const &start
     assert(interface);
     measure->AddChild(element);
     interface->SetStartid("#" + startid);
+    measure->ResetCachedHorizontalLayout();
 
     m_chainedId = element->GetID();
     m_editInfo.import("uuid", element->GetID());
@@ -394,6 +400,7 @@ bool EditorToolkitCMN::Set(std::string &elementId, std::string const &attribute,
     else if (AttModule::SetVisual(element, attribute, value))
         success = true;
     if (success) {
+        this->ResetCachedLayout(element);
         return true;
     }
     return false;
@@ -422,6 +429,14 @@ Object *EditorToolkitCMN::GetElement(std::string &elementId)
     return element;
 }
 
+void EditorToolkitCMN::ResetCachedLayout(Object *object)
+{
+    assert(object);
+
+    Measure *measure = vrv_cast<Measure *>(object->Is(MEASURE) ? object : object->GetFirstAncestor(MEASURE));
+    if (measure) measure->ResetCachedHorizontalLayout();
+}
+
 bool EditorToolkitCMN::InsertNote(Object *object)
 {
     assert(object);
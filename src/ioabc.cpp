@@ -915,10 +915,9 @@ void ABCInput::CreateHeader()
     appText.text().set("Transcoded from abc music");
 
     // isodate and version //
-    const time_t t = time(0); // get time now
-    struct tm *now = localtime(&t);
-    std::string dateStr = StringFormat("%d-%02d-%02dT%02d:%02d:%02d", now->tm_year + 1900, now->tm_mon + 1,
-        now->tm_mday, now->tm_hour, now->tm_min, now->tm_sec);
+    const struct tm now = GetLocalTime();
+    std::string dateStr = StringFormat("%d-%02d-%02dT%02d:%02d:%02d", now.tm_year + 1900, now.tm_mon + 1,
+        now.tm_mday, now.tm_hour, now.tm_min, now.tm_sec);
     app.append_attribute("isodate").set_value(dateStr.c_str());
     app.append_attribute("version").set_value(GetVersion().c_str());
 
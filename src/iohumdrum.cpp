@@ -5197,10 +5197,9 @@ bool HumdrumInput::anyReferenceItemsExist(const std::vector<std::string> &keys)
 
 std::string HumdrumInput::getDateString()
 {
-    time_t t = time(0); // get time now
-    struct tm *now = localtime(&t);
-    std::string dateStr = StringFormat("%d-%02d-%02dT%02d:%02d:%02d", now->tm_year + 1900, now->tm_mon + 1,
-        now->tm_mday, now->tm_hour, now->tm_min, now->tm_sec);
+    const struct tm now = GetLocalTime();
+    std::string dateStr = StringFormat("%d-%02d-%02dT%02d:%02d:%02d", now.tm_year + 1900, now.tm_mon + 1,
+        now.tm_mday, now.tm_hour, now.tm_min, now.tm_sec);
     return dateStr;
 }
 
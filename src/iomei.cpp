@@ -158,6 +158,11 @@ namespace vrv {
 const std::vector<std::string> MEIInput::s_editorialElementNames = { "abbr", "add", "app", "annot", "choice", "corr",
     "damage", "del", "expan", "orig", "ref", "reg", "restore", "sic", "subst", "supplied", "unclear" };
 
+const std::vector<std::string> MEIInput::s_streamedElementNames = { "measure", "staff", "surface" };
+
+// The attribute with the position of the content of an element not loaded yet in the streaming import
+const char *STREAMED_RANGE = "vrv-streamed-range";
+
 //----------------------------------------------------------------------------
 // MEIOutput
 //----------------------------------------------------------------------------
@@ -169,6 +174,8 @@ MEIOutput::MEIOutput(Doc *doc) : Output(doc)
     m_basic = false;
     m_ignoreHeader = false;
     m_removeIds = false;
+    m_stream = NULL;
+    m_outputFlags = pugi::format_default;
 
     this->Reset();
     this->ResetFilter();
@@ -177,6 +184,11 @@ MEIOutput::MEIOutput(Doc *doc) : Output(doc)
 MEIOutput::~MEIOutput() {}
 
 bool MEIOutput::Export()
+{
+    return this->Export(m_streamStringOutput);
+}
+
+bool MEIOutput::Export(std::ostream &output)
 {
 
     if (m_removeIds) {
@@ -250,6 +262,17 @@ bool MEIOutput::Export()
         if (this->GetBasic()) meiVersion = meiVersion_MEIVERSION_5_0plusbasic;
         m_mei.append_attribute("meiversion") = (converter.MeiVersionMeiversionToStr(meiVersion)).c_str();
 
+        m_stream = &output;
+        m_openNodes.clear();
+        m_outputFlags = pugi::format_default;
+        if (m_doc->GetOptions()->m_outputSmuflXmlEntities.GetValue()) {
+            m_outputFlags |= pugi::format_no_escapes;
+        }
+        if (m_doc->GetOptions()->m_outputFormatRaw.GetValue()) {
+            m_outputFlags |= pugi::format_raw;
+        }
+        m_indentString = (m_indent == -1) ? "\t" : std::string(m_indent, ' ');
+
         // If the document is mensural, we have to undo the mensural (segments) cast off
         m_doc->ConvertToCastOffMensuralDoc(false);
 
@@ -258,23 +281,23 @@ bool MEIOutput::Export()
 
         // Redo the mensural segment cast of if necessary
         m_doc->ConvertToCastOffMensuralDoc(true);
-        unsigned int output_flags = pugi::format_default;
-        if (m_doc->GetOptions()->m_outputSmuflXmlEntities.GetValue()) {
-            output_flags |= pugi::format_no_escapes;
-        }
-        if (m_doc->GetOptions()->m_outputFormatRaw.GetValue()) {
-            output_flags |= pugi::format_raw;
-        }
 
-        if (this->GetBasic()) {
-            this->PruneAttributes(m_mei.child("music"));
+        // Prune what has not been written yet, i.e., all if no measure or staff was written
+        pugi::xml_node music = m_mei.child("music");
+        if (this->GetBasic() && music && !this->IsOpenNode(music)) {
+            this->PruneAttributes(music);
         }
 
-        std::string indent = (m_indent == -1) ? "\t" : std::string(m_indent, ' ');
-        meiDoc.save(m_streamStringOutput, indent.c_str(), output_flags);
+        // Write the elements still in the tree and close the ones opened
+        while (!m_openNodes.empty()) {
+            this->CloseNode();
+        }
+        this->StreamChildren(meiDoc);
+        m_stream = NULL;
     }
     catch (char *str) {
         LogError("%s", str);
+        m_stream = NULL;
         return false;
     }
 
@@ -988,12 +1011,113 @@ bool MEIOutput::WriteObjectInternalEnd(Object *object)
     if (object->Is(DOC)) return true;
 
     assert(!m_nodeStack.empty());
+    pugi::xml_node node = m_nodeStack.back();
     m_nodeStack.pop_back();
     m_currentNode = m_nodeStack.back();
 
+    // Measures and staves are written with their ancestors
+    // Objects without an element of their own (e.g., text) have the node of their parent in the stack
+    if (node != m_currentNode) this->StreamNode(node, object->Is({ MEASURE, STAFF }));
+
     return true;
 }
 
+void MEIOutput::StreamNode(pugi::xml_node node, bool open)
+{
+    if (!m_stream) return;
+
+    // The node has already been opened for writing one of its descendants
+    if (!m_openNodes.empty() && (m_openNodes.back().first == node)) {
+        this->CloseNode();
+        return;
+    }
+
+    pugi::xml_node parent = node.parent();
+    if (!this->IsOpenNode(parent)) {
+        // Otherwise the node stays in the tree until one of its ancestors is written
+        if (!open) return;
+        // Open the ancestors from the first one not opened yet
+        std::vector<pugi::xml_node> ancestors;
+        for (pugi::xml_node ancestor = parent; !this->IsOpenNode(ancestor); ancestor = ancestor.parent()) {
+            ancestors.push_back(ancestor);
+        }
+        std::for_each(ancestors.rbegin(), ancestors.rend(), [this](pugi::xml_node ancestor) {
+            this->StreamChildren(ancestor.parent(), ancestor);
+            this->OpenNode(ancestor);
+        });
+    }
+    this->StreamChildren(parent, node.next_sibling());
+}
+
+void MEIOutput::StreamChildren(pugi::xml_node parent, pugi::xml_node until)
+{
+    assert(m_stream);
+
+    const bool prune = !m_openNodes.empty() && m_openNodes.back().second;
+    const int depth = (int)m_openNodes.size();
+    pugi::xml_node child = parent.first_child();
+    while (child && (child != until)) {
+        if (prune) this->PruneAttributes(child);
+        child.print(*m_stream, m_indentString.c_str(), m_outputFlags, pugi::encoding_utf8, depth);
+        pugi::xml_node next = child.next_sibling();
+        parent.remove_child(child);
+        child = next;
+    }
+}
+
+void MEIOutput::OpenNode(pugi::xml_node node)
+{
+    assert(m_stream);
+
+    // The attributes are pruned as for the children of the parent, or from <music> in MEI basic
+    const bool pruneParent = !m_openNodes.empty() && m_openNodes.back().second;
+    bool prune = false;
+    if (this->GetBasic() && (pruneParent || (node == m_mei.child("music")))) {
+        prune = this->PruneAttributes(node, false);
+    }
+
+    // Print a copy of the node without its children and keep the start tag
+    pugi::xml_document startTag;
+    pugi::xml_node copy = startTag.append_child(node.name());
+    for (pugi::xml_attribute attribute : node.attributes()) {
+        copy.append_copy(attribute);
+    }
+    std::ostringstream tag;
+    copy.print(tag, m_indentString.c_str(), m_outputFlags | pugi::format_no_empty_element_tags, pugi::encoding_utf8,
+        (int)m_openNodes.size());
+    std::string output = tag.str();
+    output.erase(output.rfind("</"));
+    if (!(m_outputFlags & pugi::format_raw)) output += "\n";
+    *m_stream << output;
+
+    m_openNodes.push_back({ node, prune });
+}
+
+void MEIOutput::CloseNode()
+{
+    assert(m_stream);
+    assert(!m_openNodes.empty());
+
+    pugi::xml_node node = m_openNodes.back().first;
+    this->StreamChildren(node);
+    m_openNodes.pop_back();
+
+    if (!(m_outputFlags & pugi::format_raw)) {
+        for (int i = 0; i < (int)m_openNodes.size(); ++i) *m_stream << m_indentString;
+    }
+    *m_stream << "</" << node.name() << ">";
+    if (!(m_outputFlags & pugi::format_raw)) *m_stream << "\n";
+
+    node.parent().remove_child(node);
+}
+
+bool MEIOutput::IsOpenNode(pugi::xml_node node) const
+{
+    if (node.type() == pugi::node_document) return true;
+    return std::any_of(m_openNodes.begin(), m_openNodes.end(),
+        [&node](const std::pair<pugi::xml_node, bool> &openNode) { return (openNode.first == node); });
+}
+
 bool MEIOutput::HasFilter() const
 {
     return m_hasFilter;
@@ -1245,12 +1369,12 @@ bool MEIOutput::ProcessScoreBasedFilterEnd(Object *object)
     return (m_filterMatchLocation == MatchLocation::Here);
 }
 
-void MEIOutput::PruneAttributes(pugi::xml_node node)
+bool MEIOutput::PruneAttributes(pugi::xml_node node, bool recursive)
 {
-    if (node.text()) return;
+    if (node.text()) return false;
     if (!MEIBasic::map.count(node.name())) {
         LogWarning("Element '%s' is not supported but will be preserved", node.name());
-        return;
+        return false;
     }
     std::list<std::string> unsupported;
     for (pugi::xml_attribute attribute : node.attributes()) {
@@ -1260,9 +1384,11 @@ void MEIOutput::PruneAttributes(pugi::xml_node node)
     }
     for (const std::string &attribute : unsupported) node.remove_attribute(attribute.c_str());
 
+    if (!recursive) return true;
     for (pugi::xml_node &child : node.children()) {
         this->PruneAttributes(child);
     }
+    return true;
 }
 
 void MEIOutput::WriteStackedObjects()
@@ -1528,10 +1654,9 @@ void MEIOutput::WriteRevisionDesc(pugi::xml_node meiHead)
     if (revisionDesc.empty()) revisionDesc = meiHead.append_child("revisionDesc");
     pugi::xml_node change = revisionDesc.append_child("change");
     // add isodate
-    const time_t t = time(0); // get time now
-    struct tm *now = localtime(&t);
-    std::string dateStr = StringFormat("%d-%02d-%02dT%02d:%02d:%02d", now->tm_year + 1900, now->tm_mon + 1,
-        now->tm_mday, now->tm_hour, now->tm_min, now->tm_sec);
+    const struct tm now = GetLocalTime();
+    std::string dateStr = StringFormat("%d-%02d-%02dT%02d:%02d:%02d", now.tm_year + 1900, now.tm_mon + 1,
+        now.tm_mday, now.tm_hour, now.tm_min, now.tm_sec);
     change.append_attribute("isodate").set_value(dateStr.c_str());
     pugi::xml_node changeDesc = change.append_child("changeDesc");
     pugi::xml_node p1 = changeDesc.append_child("p");
@@ -3352,6 +3477,7 @@ std::string MEIOutput::DocTypeToStr(DocType type)
 
 MEIInput::MEIInput(Doc *doc) : Input(doc)
 {
+    m_streamedData = NULL;
     m_hasScoreDef = false;
     m_readingScoreBased = false;
     m_meiversion = meiVersion_MEIVERSION_NONE;
@@ -3365,12 +3491,23 @@ bool MEIInput::Import(const std::string &mei)
         m_doc->Reset();
         m_doc->SetType(Raw);
         pugi::xml_document doc;
-        doc.load_string(mei.c_str(), (pugi::parse_comments | pugi::parse_default) & ~pugi::parse_eol);
+        const unsigned int options = (pugi::parse_comments | pugi::parse_default) & ~pugi::parse_eol;
+        if (m_doc->GetOptions()->m_meiStreaming.GetValue()) {
+            // The content of the measures is loaded only when they are read
+            m_streamedData = &mei;
+            doc.load_string(this->GetStreamedSkeleton(mei).c_str(), options);
+        }
+        else {
+            doc.load_string(mei.c_str(), options);
+        }
         pugi::xml_node root = doc.first_child();
-        return this->ReadDoc(root);
+        const bool success = this->ReadDoc(root);
+        m_streamedData = NULL;
+        return success;
     }
     catch (char *str) {
         LogError("%s", str);
+        m_streamedData = NULL;
         return false;
     }
 }
@@ -5343,6 +5480,10 @@ bool MEIInput::ReadLayerDefChildren(Object *parent, pugi::xml_node parentNode)
 
 bool MEIInput::ReadMeasure(Object *parent, pugi::xml_node measure)
 {
+    // With the streaming import, the content of the measure is loaded only now
+    pugi::xml_document subtree;
+    measure = this->LoadStreamedElement(measure, subtree);
+
     Measure *vrvMeasure = new Measure();
     if (m_doc->IsMensuralMusicOnly()) {
         LogWarning("Mixing mensural and non mensural music is not supported. Trying to go ahead...");
@@ -6043,6 +6184,10 @@ bool MEIInput::ReadFbChildren(Object *parent, pugi::xml_node parentNode)
 
 bool MEIInput::ReadStaff(Object *parent, pugi::xml_node staff)
 {
+    // With the streaming import, the content of the unmeasured staff is loaded only now
+    pugi::xml_document subtree;
+    staff = this->LoadStreamedElement(staff, subtree);
+
     Staff *vrvStaff = new Staff();
     this->SetMeiID(staff, vrvStaff);
 
@@ -8146,6 +8291,127 @@ void MEIInput::NormalizeAttributes(pugi::xml_node &xmlElement)
     }
 }
 
+std::string MEIInput::GetStreamedSkeleton(const std::string &mei) const
+{
+    std::string skeleton;
+    // The number of open <body> and <facsimile> elements, outside of which nothing is streamed
+    int streamedParents = 0;
+    size_t pos = 0;
+    while (pos < mei.size()) {
+        const size_t start = mei.find('<', pos);
+        const size_t end = (start == std::string::npos) ? std::string::npos : FindMarkupEnd(mei, start);
+        // Also for malformed data, which is then reported by pugixml
+        if (end == std::string::npos) {
+            skeleton.append(mei, pos, std::string::npos);
+            break;
+        }
+        skeleton.append(mei, pos, start - pos);
+        pos = end;
+
+        const char next = mei.at(start + 1);
+        const size_t nameEnd = mei.find_first_of(" \t\r\n/>", start + 1);
+        if (next == '/') {
+            const std::string name = mei.substr(start + 2, nameEnd - start - 2);
+            if ((name == "body") || (name == "facsimile")) --streamedParents;
+        }
+        else if ((next != '!') && (next != '?') && (mei.at(end - 2) != '/')) {
+            const std::string name = mei.substr(start + 1, nameEnd - start - 1);
+            if ((name == "body") || (name == "facsimile")) ++streamedParents;
+            const bool streamed = (streamedParents > 0)
+                && (std::find(s_streamedElementNames.begin(), s_streamedElementNames.end(), name)
+                    != s_streamedElementNames.end());
+            const size_t elementEnd = (streamed) ? FindElementEnd(mei, end) : std::string::npos;
+            if (elementEnd != std::string::npos) {
+                // Keep the start tag with its attributes and the range of the element
+                skeleton.append(mei, start, end - 1 - start);
+                skeleton += StringFormat(" %s=\"%zu %zu\"/>", STREAMED_RANGE, start, elementEnd - start);
+                pos = elementEnd;
+                continue;
+            }
+        }
+        skeleton.append(mei, start, end - start);
+    }
+    return skeleton;
+}
+
+pugi::xml_node MEIInput::LoadStreamedElement(pugi::xml_node element, pugi::xml_document &subtree)
+{
+    pugi::xml_attribute range = element.attribute(STREAMED_RANGE);
+    if (!m_streamedData || !range) return element;
+
+    size_t start = 0;
+    size_t length = 0;
+    if (sscanf(range.value(), "%zu %zu", &start, &length) != 2 || (start + length > m_streamedData->size())) {
+        LogError("Invalid range for the streamed <%s>", element.name());
+        return element;
+    }
+    subtree.load_buffer(m_streamedData->data() + start, length,
+        (pugi::parse_comments | pugi::parse_default) & ~pugi::parse_eol, pugi::encoding_utf8);
+    pugi::xml_node loaded = subtree.first_child();
+    if (!loaded) return element;
+    this->NormalizeAttributes(loaded);
+    return loaded;
+}
+
+size_t MEIInput::FindMarkupEnd(const std::string &mei, size_t pos)
+{
+    // Comments, CDATA sections and processing instructions
+    if (mei.compare(pos, 4, "<!--") == 0) {
+        const size_t end = mei.find("-->", pos + 4);
+        return (end == std::string::npos) ? end : end + 3;
+    }
+    if (mei.compare(pos, 9, "<![CDATA[") == 0) {
+        const size_t end = mei.find("]]>", pos + 9);
+        return (end == std::string::npos) ? end : end + 3;
+    }
+    if (mei.compare(pos, 2, "<?") == 0) {
+        const size_t end = mei.find("?>", pos + 2);
+        return (end == std::string::npos) ? end : end + 2;
+    }
+    // Tags and declarations, which can have an internal subset in brackets
+    char quote = 0;
+    int brackets = 0;
+    for (size_t i = pos + 1; i < mei.size(); ++i) {
+        const char c = mei[i];
+        if (quote) {
+            if (c == quote) quote = 0;
+        }
+        else if ((c == '"') || (c == '\'')) {
+            quote = c;
+        }
+        else if (c == '[') {
+            ++brackets;
+        }
+        else if (c == ']') {
+            --brackets;
+        }
+        else if ((c == '>') && (brackets <= 0)) {
+            return i + 1;
+        }
+    }
+    return std::string::npos;
+}
+
+size_t MEIInput::FindElementEnd(const std::string &mei, size_t pos)
+{
+    // The position is after the start tag of the element
+    int depth = 1;
+    while (pos < mei.size()) {
+        const size_t start = mei.find('<', pos);
+        if (start == std::string::npos) return start;
+        pos = FindMarkupEnd(mei, start);
+        if (pos == std::string::npos) return pos;
+        const char next = mei.at(start + 1);
+        if (next == '/') {
+            if (--depth == 0) return pos;
+        }
+        else if ((next != '!') && (next != '?') && (mei.at(pos - 2) != '/')) {
+            ++depth;
+        }
+    }
+    return std::string::npos;
+}
+
 void MEIInput::UpgradeKeySigTo_5_0(pugi::xml_node keySig)
 {
     InstKeySigLog keySigLog;
@@ -8508,6 +8774,10 @@ bool MEIInput::ReadGraphic(Object *parent, pugi::xml_node graphic)
 bool MEIInput::ReadSurface(Facsimile *parent, pugi::xml_node surface)
 {
     assert(parent);
+    // With the streaming import, the zones of the surface are loaded only now
+    pugi::xml_document subtree;
+    surface = this->LoadStreamedElement(surface, subtree);
+
     Surface *vrvSurface = new Surface();
     this->SetMeiID(surface, vrvSurface);
     vrvSurface->ReadCoordinated(surface);
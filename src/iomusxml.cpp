@@ -188,6 +188,91 @@ std::string MusicXmlInput::GetContentOfChild(const pugi::xml_node node, const st
     return "";
 }
 
+pugi::xml_node MusicXmlInput::GetPrintedChild(const pugi::xml_node node, const std::string &name) const
+{
+    for (pugi::xml_node child : node.children(name.c_str())) {
+        if (!HasAttributeWithValue(child, "print-object", "no")) return child;
+    }
+    return pugi::xml_node();
+}
+
+pugi::xml_node MusicXmlInput::GetUnnumberedChild(const pugi::xml_node node, const std::string &name) const
+{
+    for (pugi::xml_node child : node.children(name.c_str())) {
+        if (!child.attribute("number")) return child;
+    }
+    return pugi::xml_node();
+}
+
+pugi::xml_node MusicXmlInput::GetBeam(const pugi::xml_node node, const std::string &value, int number) const
+{
+    const std::string numberStr = (number > 0) ? std::to_string(number) : "";
+    for (pugi::xml_node beam : node.children("beam")) {
+        if (!numberStr.empty() && (beam.attribute("number").as_string() != numberStr)) continue;
+        if (HasContentWithValue(beam, value)) return beam;
+    }
+    return pugi::xml_node();
+}
+
+pugi::xml_node MusicXmlInput::GetGrandchild(
+    const pugi::xml_node node, const std::string &child, const std::string &grandchild) const
+{
+    for (pugi::xml_node childNode : node.children(child.c_str())) {
+        pugi::xml_node grandchildNode = childNode.child(grandchild.c_str());
+        if (grandchildNode) return grandchildNode;
+    }
+    return pugi::xml_node();
+}
+
+pugi::xml_node MusicXmlInput::GetGrandchildWithAttribute(const pugi::xml_node node, const std::string &child,
+    const std::string &grandchild, const std::string &attribute, const std::string &value) const
+{
+    for (pugi::xml_node childNode : node.children(child.c_str())) {
+        pugi::xml_node grandchildNode
+            = childNode.find_child_by_attribute(grandchild.c_str(), attribute.c_str(), value.c_str());
+        if (grandchildNode) return grandchildNode;
+    }
+    return pugi::xml_node();
+}
+
+pugi::xml_node MusicXmlInput::GetGrandchildWithSubstring(
+    const pugi::xml_node node, const std::string &child, const std::vector<std::string> &substrings) const
+{
+    for (pugi::xml_node childNode : node.children(child.c_str())) {
+        for (pugi::xml_node grandchildNode : childNode.children()) {
+            const std::string name = grandchildNode.name();
+            for (const std::string &substring : substrings) {
+                if (name.find(substring) != std::string::npos) return grandchildNode;
+            }
+        }
+    }
+    return pugi::xml_node();
+}
+
+pugi::xml_node MusicXmlInput::GetPrintedGrandchild(
+    const pugi::xml_node node, const std::string &child, const std::string &grandchild) const
+{
+    for (pugi::xml_node childNode : node.children(child.c_str())) {
+        pugi::xml_node grandchildNode = GetPrintedChild(childNode, grandchild);
+        if (grandchildNode) return grandchildNode;
+    }
+    return pugi::xml_node();
+}
+
+std::vector<pugi::xml_node> MusicXmlInput::GetGrandchildren(
+    const pugi::xml_node node, const std::string &child, const std::vector<std::string> &names) const
+{
+    std::vector<pugi::xml_node> grandchildren;
+    for (pugi::xml_node childNode : node.children(child.c_str())) {
+        for (pugi::xml_node grandchildNode : childNode.children()) {
+            if (std::find(names.begin(), names.end(), grandchildNode.name()) != names.end()) {
+                grandchildren.push_back(grandchildNode);
+            }
+        }
+    }
+    return grandchildren;
+}
+
 void MusicXmlInput::ProcessClefChangeQueue(Section *section)
 {
     while (!m_clefChangeQueue.empty()) {
@@ -656,10 +741,9 @@ std::string MusicXmlInput::GetWordsOrDynamicsText(const pugi::xml_node node) con
     return std::string();
 }
 
-void MusicXmlInput::TextRendition(const pugi::xpath_node_set words, ControlElement *element) const
+void MusicXmlInput::TextRendition(const std::vector<pugi::xml_node> &words, ControlElement *element) const
 {
-    for (pugi::xpath_node_set::const_iterator it = words.begin(); it != words.end(); ++it) {
-        pugi::xml_node textNode = it->node();
+    for (pugi::xml_node textNode : words) {
         pugi::xml_node soundNode = textNode.parent().next_sibling("sound");
         std::string textStr = GetWordsOrDynamicsText(textNode);
         std::string textColor = textNode.attribute("color").as_string();
@@ -1270,10 +1354,9 @@ void MusicXmlInput::ReadMusicXmlTitle(pugi::xml_node root)
     }
 
     // isodate and version
-    time_t t = time(0); // get time now
-    struct tm *now = localtime(&t);
-    std::string dateStr = StringFormat("%d-%02d-%02dT%02d:%02d:%02d", now->tm_year + 1900, now->tm_mon + 1,
-        now->tm_mday, now->tm_hour, now->tm_min, now->tm_sec);
+    const struct tm now = GetLocalTime();
+    std::string dateStr = StringFormat("%d-%02d-%02dT%02d:%02d:%02d", now.tm_year + 1900, now.tm_mon + 1,
+        now.tm_mday, now.tm_hour, now.tm_min, now.tm_sec);
     app.append_attribute("isodate").set_value(dateStr.c_str());
     app.append_attribute("version").set_value(GetVersion().c_str());
 }
@@ -1286,9 +1369,9 @@ short int MusicXmlInput::ReadMusicXmlPartAttributesAsStaffDef(
 
     // First get the number of staves in the part
     short int nbStaves = 1;
-    pugi::xpath_node staves = node.select_node("attributes[1]/staves");
+    pugi::xml_node staves = node.child("attributes").child("staves");
     if (staves) {
-        nbStaves = staves.node().text().as_int();
+        nbStaves = staves.text().as_int();
     }
     if (nbStaves > 1) {
         if (m_label) staffGrp->AddChild(m_label);
@@ -1316,9 +1399,9 @@ short int MusicXmlInput::ReadMusicXmlPartAttributesAsStaffDef(
             continue;
         }
 
-        std::string xpath;
         // Create as many staffDef
         for (int i = 0; i < nbStaves; ++i) {
+            const std::string staffNumber = std::to_string(i + 1);
             // Find or create the staffDef
             AttNIntegerComparison comparisonStaffDef(STAFFDEF, i + 1 + staffOffset);
             StaffDef *staffDef = vrv_cast<StaffDef *>(staffGrp->FindDescendantByComparison(&comparisonStaffDef, 1));
@@ -1340,14 +1423,13 @@ short int MusicXmlInput::ReadMusicXmlPartAttributesAsStaffDef(
             }
 
             // clef sign - first look if we have a clef-sign with the corresponding staff @number
-            std::string xpath = StringFormat("clef[@number='%d']", i + 1);
-            pugi::xpath_node clef = it->select_node(xpath.c_str());
+            pugi::xml_node clef = it->find_child_by_attribute("clef", "number", staffNumber.c_str());
             // if not, look at a common one
             if (!clef) {
-                clef = it->select_node("clef[not(@number)]");
-                if (nbStaves > 1) clef.node().remove_attribute("id");
+                clef = GetUnnumberedChild(*it, "clef");
+                if (nbStaves > 1) clef.remove_attribute("id");
             }
-            Clef *meiClef = ConvertClef(clef.node());
+            Clef *meiClef = ConvertClef(clef);
             if (meiClef) {
                 staffDef->AddChild(meiClef);
                 // if TAB assume guitar tablature until we examine <staff-details>, if any
@@ -1355,49 +1437,46 @@ short int MusicXmlInput::ReadMusicXmlPartAttributesAsStaffDef(
             }
 
             // key sig
-            xpath = StringFormat("key[@number='%d']", i + 1);
-            pugi::xpath_node key = it->select_node(xpath.c_str());
+            pugi::xml_node key = it->find_child_by_attribute("key", "number", staffNumber.c_str());
             if (!key) {
-                key = it->select_node("key[not(@number)]");
-                if (nbStaves > 1) key.node().remove_attribute("id");
+                key = GetUnnumberedChild(*it, "key");
+                if (nbStaves > 1) key.remove_attribute("id");
             }
             if (key) {
-                KeySig *meiKey = ConvertKey(key.node());
+                KeySig *meiKey = ConvertKey(key);
                 staffDef->AddChild(meiKey);
                 if (staffDef->GetNotationtype() == NOTATIONTYPE_tab_guitar) meiKey->IsAttribute(true);
             }
 
             // staff details
-            pugi::xpath_node staffDetails;
-            xpath = StringFormat("staff-details[@number='%d']", i + 1);
-            staffDetails = it->select_node(xpath.c_str());
+            pugi::xml_node staffDetails = it->find_child_by_attribute("staff-details", "number", staffNumber.c_str());
             if (!staffDetails) {
-                staffDetails = it->select_node("staff-details[not(@number)]");
+                staffDetails = GetUnnumberedChild(*it, "staff-details");
             }
-            short int staffLines = staffDetails.node().select_node("staff-lines").node().text().as_int();
+            short int staffLines = staffDetails.child("staff-lines").text().as_int();
             if (staffLines) {
                 staffDef->SetLines(staffLines);
             }
             else if (!staffDef->HasLines()) {
                 staffDef->SetLines(5);
             }
-            std::string scaleStr = staffDetails.node().select_node("staff-size").node().text().as_string();
+            std::string scaleStr = staffDetails.child("staff-size").text().as_string();
             if (!scaleStr.empty()) {
                 staffDef->SetScale(staffDef->AttScalable::StrToPercent(scaleStr + "%"));
             }
             // Tablature?
-            if (staffDetails.node().child("staff-tuning") || (staffDef->GetNotationtype() == NOTATIONTYPE_tab_guitar)) {
+            if (staffDetails.child("staff-tuning") || (staffDef->GetNotationtype() == NOTATIONTYPE_tab_guitar)) {
                 // tablature type.  MusicXML does not support German tablature.
-                if (HasAttributeWithValue(staffDetails.node(), "show-frets", "letters")) {
+                if (HasAttributeWithValue(staffDetails, "show-frets", "letters")) {
                     staffDef->SetNotationtype(NOTATIONTYPE_tab_lute_french);
                 }
                 else {
                     // Frets are notated with numbers.
                     // Italian tablature if the top staff line has a lower pitch than the bottom line
                     // else guitar tablature.
-                    pugi::xml_node topLine = staffDetails.node().find_child_by_attribute(
+                    pugi::xml_node topLine = staffDetails.find_child_by_attribute(
                         "staff-tuning", "line", std::to_string(staffLines).c_str());
-                    pugi::xml_node botLine = staffDetails.node().find_child_by_attribute("staff-tuning", "line", "1");
+                    pugi::xml_node botLine = staffDetails.find_child_by_attribute("staff-tuning", "line", "1");
                     if (topLine && botLine
                         && PitchToMidi(topLine.child("tuning-step").text().as_string(),
                                topLine.child("tuning-alter").text().as_int(),
@@ -1420,7 +1499,7 @@ short int MusicXmlInput::ReadMusicXmlPartAttributesAsStaffDef(
                 Tuning *tuning = new Tuning();
                 staffDef->AddChild(tuning);
 
-                for (pugi::xml_node staffTuning : staffDetails.node().children("staff-tuning")) {
+                for (pugi::xml_node staffTuning : staffDetails.children("staff-tuning")) {
                     Course *courseTuning = new Course();
                     tuning->AddChild(courseTuning);
 
@@ -1451,45 +1530,41 @@ short int MusicXmlInput::ReadMusicXmlPartAttributesAsStaffDef(
             }
 
             // time
-            pugi::xpath_node time;
-            xpath = StringFormat("time[@number='%d']", i + 1);
-            time = it->select_node(xpath.c_str());
+            pugi::xml_node time = it->find_child_by_attribute("time", "number", staffNumber.c_str());
             if (!time) {
-                time = it->select_node("time[not(@number)]");
-                if (nbStaves > 1) time.node().remove_attribute("id");
+                time = GetUnnumberedChild(*it, "time");
+                if (nbStaves > 1) time.remove_attribute("id");
             }
             if (time) {
-                ReadMusicXMLMeterSig(time.node(), staffDef);
+                ReadMusicXMLMeterSig(time, staffDef);
             }
             // add it if necessary
 
             // transpose
-            pugi::xpath_node transpose;
-            xpath = StringFormat("transpose[@number='%d']", i + 1);
-            transpose = it->select_node(xpath.c_str());
+            pugi::xml_node transpose = it->find_child_by_attribute("transpose", "number", staffNumber.c_str());
             if (!transpose) {
-                transpose = it->select_node("transpose");
+                transpose = it->child("transpose");
             }
             if (transpose) {
-                staffDef->SetTransDiat(transpose.node().child("diatonic").text().as_int());
-                staffDef->SetTransSemi(transpose.node().child("chromatic").text().as_int());
-                if (transpose.node().child("octave-change")) {
-                    staffDef->SetTransDiat(transpose.node().child("chromatic").text().as_int()
-                        + 7 * transpose.node().child("octave-change").text().as_int());
-                    staffDef->SetTransSemi(transpose.node().child("chromatic").text().as_int()
-                        + 12 * transpose.node().child("octave-change").text().as_int());
+                staffDef->SetTransDiat(transpose.child("diatonic").text().as_int());
+                staffDef->SetTransSemi(transpose.child("chromatic").text().as_int());
+                if (transpose.child("octave-change")) {
+                    staffDef->SetTransDiat(transpose.child("chromatic").text().as_int()
+                        + 7 * transpose.child("octave-change").text().as_int());
+                    staffDef->SetTransSemi(transpose.child("chromatic").text().as_int()
+                        + 12 * transpose.child("octave-change").text().as_int());
                 }
             }
             // ppq
-            pugi::xpath_node divisions = it->select_node("divisions");
+            pugi::xml_node divisions = it->child("divisions");
             if (divisions) {
-                m_ppq = divisions.node().text().as_int();
+                m_ppq = divisions.text().as_int();
                 staffDef->SetPpq(m_ppq);
             }
             // measure style
-            pugi::xpath_node measureSlash = it->select_node("measure-style/slash");
+            pugi::xml_node measureSlash = GetGrandchild(*it, "measure-style", "slash");
             if (measureSlash) {
-                m_slash = (HasAttributeWithValue(measureSlash.node(), "type", "start")) ? true : false;
+                m_slash = (HasAttributeWithValue(measureSlash, "type", "start")) ? true : false;
             }
         }
     }
@@ -1499,17 +1574,17 @@ short int MusicXmlInput::ReadMusicXmlPartAttributesAsStaffDef(
 
 void MusicXmlInput::ReadMusicXMLMeterSig(const pugi::xml_node &time, Object *parent)
 {
-    if ((time.select_nodes("beats").size() > 1) || time.select_node("interchangeable")) {
+    pugi::xml_node interchangeable = time.child("interchangeable");
+    if (time.child("beats").next_sibling("beats") || interchangeable) {
         MeterSigGrp *meterSigGrp = new MeterSigGrp();
         if (time.attribute("id")) {
             meterSigGrp->SetID(time.attribute("id").as_string());
         }
-        pugi::xpath_node interchangeable = time.select_node("interchangeable");
         meterSigGrp->SetFunc(interchangeable ? meterSigGrpLog_FUNC_interchanging : meterSigGrpLog_FUNC_mixed);
 
         std::tie(m_meterCount, m_meterUnit) = this->GetMeterSigGrpValues(time, meterSigGrp);
         if (interchangeable) {
-            std::tie(std::ignore, std::ignore) = this->GetMeterSigGrpValues(interchangeable.node(), meterSigGrp);
+            std::tie(std::ignore, std::ignore) = this->GetMeterSigGrpValues(interchangeable, meterSigGrp);
         }
         parent->AddChild(meterSigGrp);
     }
@@ -1556,19 +1631,17 @@ bool MusicXmlInput::ReadMusicXmlPart(pugi::xml_node node, Section *section, shor
     assert(node);
     assert(section);
 
-    pugi::xpath_node_set measures = node.select_nodes("measure");
-    if (measures.size() == 0) {
+    if (!node.child("measure")) {
         LogWarning("MusicXML import: No measure to load");
         return false;
     }
 
     int i = 0;
-    for (pugi::xpath_node_set::const_iterator it = measures.begin(); it != measures.end(); ++it) {
-        pugi::xpath_node xmlMeasure = *it;
+    for (pugi::xml_node xmlMeasure : node.children("measure")) {
         if (!IsMultirestMeasure(i)) {
             Measure *measure = new Measure();
             m_measureCounts[measure] = i;
-            ReadMusicXmlMeasure(xmlMeasure.node(), section, measure, nbStaves, staffOffset, i);
+            ReadMusicXmlMeasure(xmlMeasure, section, measure, nbStaves, staffOffset, i);
             // Add the measure to the system - if already there from a previous part we'll just merge the content
             AddMeasure(section, measure, i);
         }
@@ -1582,7 +1655,7 @@ bool MusicXmlInput::ReadMusicXmlPart(pugi::xml_node node, Section *section, shor
                     [lastElementIter](
                         const std::pair<Measure *, int> &elem) { return lastElementIter->first == elem.second; });
                 if (measureIter != m_measureCounts.end()) {
-                    for (auto it = xmlMeasure.node().begin(); it != xmlMeasure.node().end(); ++it) {
+                    for (auto it = xmlMeasure.begin(); it != xmlMeasure.end(); ++it) {
                         if (IsElement(*it, "barline")) {
                             ReadMusicXmlBarLine(*it, measureIter->first, std::to_string(lastElementIter->first));
                         }
@@ -1653,14 +1726,18 @@ bool MusicXmlInput::ReadMusicXmlMeasure(
     const auto mrestPositonIter = m_multiRests.find(index);
     bool isMRestInOtherSystem = (mrestPositonIter != m_multiRests.end());
     int multiRestStaffNumber = 1;
+    // print elements are read for the first part only
+    const bool isFirstPart = IsElement(node.parent(), "part") && !node.parent().previous_sibling("part");
 
     // read the content of the measure
     for (pugi::xml_node::iterator it = node.begin(); it != node.end(); ++it) {
-        // first check if there is a multi measure rest
-        if (it->select_node(".//multiple-rest")) {
-            const int multiRestLength = it->select_node(".//multiple-rest").node().text().as_int();
+        // first check if there is a multi measure rest - it can only appear in attributes/measure-style
+        pugi::xml_node multipleRest
+            = IsElement(*it, "attributes") ? GetGrandchild(*it, "measure-style", "multiple-rest") : pugi::xml_node();
+        if (multipleRest) {
+            const int multiRestLength = multipleRest.text().as_int();
             MultiRest *multiRest = new MultiRest;
-            if (it->select_node(".//multiple-rest[@use-symbols='yes']")) multiRest->SetBlock(BOOLEAN_false);
+            if (HasAttributeWithValue(multipleRest, "use-symbols", "yes")) multiRest->SetBlock(BOOLEAN_false);
             multiRest->SetNum(multiRestLength);
             Layer *layer = SelectLayer(1, measure);
             AddLayerElement(layer, multiRest);
@@ -1701,7 +1778,7 @@ bool MusicXmlInput::ReadMusicXmlMeasure(
             ReadMusicXmlNote(*it, measure, measureNum, staffOffset, section);
         }
         // for now only check first part
-        else if (IsElement(*it, "print") && node.select_node("parent::part[not(preceding-sibling::part)]")) {
+        else if (IsElement(*it, "print") && isFirstPart) {
             ReadMusicXmlPrint(*it, section);
         }
     }
@@ -1809,8 +1886,14 @@ void MusicXmlInput::ReadMusicXmlAttributes(
     pugi::xml_node time = node.child("time");
 
     // for now only read first key change in first part and update scoreDef
-    if ((key || time || divisionChange) && node.select_node("ancestor::part[not(preceding-sibling::part)]")
-        && !node.select_node("preceding-sibling::attributes/key")) {
+    const pugi::xml_node part = node.parent().parent();
+    bool hasPrecedingKey = false;
+    for (pugi::xml_node sibling = node.previous_sibling("attributes"); sibling && !hasPrecedingKey;
+         sibling = sibling.previous_sibling("attributes")) {
+        hasPrecedingKey = sibling.child("key");
+    }
+    if ((key || time || divisionChange) && IsElement(part, "part") && !part.previous_sibling("part")
+        && !hasPrecedingKey) {
         ScoreDef *scoreDef = new ScoreDef();
         if (key) {
             KeySig *meiKey = ConvertKey(key);
@@ -1828,13 +1911,13 @@ void MusicXmlInput::ReadMusicXmlAttributes(
         section->AddChild(scoreDef);
     }
 
-    pugi::xpath_node measureRepeat = node.select_node("measure-style/measure-repeat");
-    pugi::xpath_node measureSlash = node.select_node("measure-style/slash");
+    pugi::xml_node measureRepeat = GetGrandchild(node, "measure-style", "measure-repeat");
+    pugi::xml_node measureSlash = GetGrandchild(node, "measure-style", "slash");
     if (measureRepeat) {
-        m_mRpt = (HasAttributeWithValue(measureRepeat.node(), "type", "start")) ? true : false;
+        m_mRpt = (HasAttributeWithValue(measureRepeat, "type", "start")) ? true : false;
     }
     if (measureSlash) {
-        m_slash = (HasAttributeWithValue(measureSlash.node(), "type", "start")) ? true : false;
+        m_slash = (HasAttributeWithValue(measureSlash, "type", "start")) ? true : false;
     }
 }
 
@@ -1857,7 +1940,7 @@ void MusicXmlInput::ReadMusicXmlBarLine(pugi::xml_node node, Measure *measure, c
     assert(staff);
 
     const std::string barStyle = node.child("bar-style").text().as_string();
-    pugi::xpath_node repeat = node.select_node("repeat");
+    pugi::xml_node repeat = node.child("repeat");
     if (!barStyle.empty()) {
         data_BARRENDITION barRendition = ConvertStyleToRend(barStyle, repeat);
         if (HasAttributeWithValue(node, "location", "left")) {
@@ -1906,8 +1989,18 @@ void MusicXmlInput::ReadMusicXmlBarLine(pugi::xml_node node, Measure *measure, c
         // endingText.c_str());
         if (endingType == "start") {
             // check for corresponding stop points
-            std::string xpath = StringFormat("following::ending[@number='%s'][@type != 'start']", endingNumber.c_str());
-            pugi::xpath_node endingEnd = node.select_node(xpath.c_str());
+            // walk the following nodes in document order and stop at the first match
+            auto isEndingEnd = [this, &endingNumber](pugi::xml_node following) {
+                return IsElement(following, "ending") && HasAttributeWithValue(following, "number", endingNumber)
+                    && following.attribute("type") && !HasAttributeWithValue(following, "type", "start");
+            };
+            pugi::xml_node endingEnd;
+            for (pugi::xml_node ancestor = node; ancestor && !endingEnd; ancestor = ancestor.parent()) {
+                for (pugi::xml_node following = ancestor.next_sibling(); following && !endingEnd;
+                     following = following.next_sibling()) {
+                    endingEnd = isEndingEnd(following) ? following : following.find_node(isEndingEnd);
+                }
+            }
             if (endingEnd) {
                 m_currentEndingStart = musicxml::EndingInfo(endingNumber, endingType, endingText);
             }
@@ -1962,7 +2055,7 @@ void MusicXmlInput::ReadMusicXmlDirection(
     const std::string directionId = node.attribute("id").as_string();
 
     const pugi::xml_node typeNode = node.child("direction-type");
-    const pugi::xpath_node voice = node.select_node("voice");
+    const pugi::xml_node voice = node.child("voice");
     const short int offset = node.child("offset").text().as_int();
     const pugi::xml_node staffNode = node.child("staff");
     const pugi::xml_node soundNode = node.child("sound");
@@ -2028,13 +2121,14 @@ void MusicXmlInput::ReadMusicXmlDirection(
     }
 
     // Dashes (to be connected with previous <dir> or <dynam> as @extender and @tstamp2 attribute
-    pugi::xpath_node dashes = typeNode.select_node("bracket|dashes");
+    pugi::xml_node dashes = typeNode.find_child(
+        [this](pugi::xml_node child) { return IsElement(child, "bracket") || IsElement(child, "dashes"); });
     if (dashes) {
-        short int dashesNumber = dashes.node().attribute("number").as_int();
+        short int dashesNumber = dashes.attribute("number").as_int();
         dashesNumber = (dashesNumber < 1) ? 1 : dashesNumber;
         short int staffNum = 1;
         if (staffNode) staffNum = staffNode.text().as_int() + staffOffset;
-        if (HasAttributeWithValue(dashes.node(), "type", "stop")) {
+        if (HasAttributeWithValue(dashes, "type", "stop")) {
             std::vector<std::pair<ControlElement *, musicxml::OpenDashes>>::iterator iter = m_openDashesStack.begin();
             while (iter != m_openDashesStack.end()) {
                 if (iter->second.m_dirN == dashesNumber && iter->second.m_staffNum == staffNum) {
@@ -2054,7 +2148,7 @@ void MusicXmlInput::ReadMusicXmlDirection(
                 }
             }
         }
-        else if (std::strncmp(dashes.node().name(), "dashes", 6) == 0) {
+        else if (std::strncmp(dashes.name(), "dashes", 6) == 0) {
             ControlElement *controlElement = nullptr;
             // find last ControlElement of type dynam or dir and activate extender
             // this is bad MusicXML and shouldn't happen
@@ -2094,26 +2188,26 @@ void MusicXmlInput::ReadMusicXmlDirection(
         }
     }
 
-    pugi::xpath_node_set words = node.select_nodes("direction-type/words");
+    const std::vector<pugi::xml_node> words = GetGrandchildren(node, "direction-type", { "words" });
     const bool containsWords = !words.empty();
-    bool containsDynamics
-        = !node.select_node("direction-type/dynamics").node().empty() || soundNode.attribute("dynamics");
-    bool containsTempo = !node.select_node("direction-type/metronome").node().empty() || soundNode.attribute("tempo");
+    bool containsDynamics = GetGrandchild(node, "direction-type", "dynamics") || soundNode.attribute("dynamics");
+    bool containsTempo = GetGrandchild(node, "direction-type", "metronome") || soundNode.attribute("tempo");
 
     // Directive
     int defaultY = 0; // y position attribute, only for directives and dynamics
     if (containsWords && !containsTempo && !containsDynamics) {
-        pugi::xpath_node_set words = node.select_nodes("direction-type/*[self::words or self::coda or self::segno]");
-        defaultY = words.first().node().attribute("default-y").as_int();
-        defaultY = (defaultY * 10) + words.first().node().attribute("relative-y").as_int();
-        std::string wordStr = words.first().node().text().as_string();
+        const std::vector<pugi::xml_node> words
+            = GetGrandchildren(node, "direction-type", { "words", "coda", "segno" });
+        defaultY = words.front().attribute("default-y").as_int();
+        defaultY = (defaultY * 10) + words.front().attribute("relative-y").as_int();
+        std::string wordStr = words.front().text().as_string();
         if (wordStr.rfind("cresc", 0) == 0 || wordStr.rfind("dim", 0) == 0 || wordStr.rfind("decresc", 0) == 0) {
             containsDynamics = true;
         }
         else {
             Dir *dir = new Dir();
             if (words.size() == 1) {
-                dir->SetLang(words.first().node().attribute("xml:lang").as_string());
+                dir->SetLang(words.front().attribute("xml:lang").as_string());
             }
             dir->SetPlace(dir->AttPlacementRelStaff::StrToStaffrel(placeStr.c_str()));
             dir->SetTstamp(timeStamp);
@@ -2136,16 +2230,16 @@ void MusicXmlInput::ReadMusicXmlDirection(
             m_controlElements.push_back({ measureNum, dir });
             m_dirStack.push_back(dir);
 
-            pugi::xpath_node extender = (words.end() - 1)->parent().next_sibling("direction-type").first_child();
-            if (!strcmp(extender.node().name(), "bracket") || !strcmp(extender.node().name(), "dashes")) {
-                short int extNumber = extender.node().attribute("number").as_int();
+            pugi::xml_node extender = words.back().parent().next_sibling("direction-type").first_child();
+            if (!strcmp(extender.name(), "bracket") || !strcmp(extender.name(), "dashes")) {
+                short int extNumber = extender.attribute("number").as_int();
                 extNumber = (extNumber < 1) ? 1 : extNumber;
                 short int staffNum = staffNode.text().as_int() + staffOffset;
                 staffNum = (staffNum < 1) ? 1 : staffNum;
                 dir->SetExtender(BOOLEAN_true);
-                if (std::strncmp(extender.node().name(), "bracket", 7) == 0) {
+                if (std::strncmp(extender.name(), "bracket", 7) == 0) {
                     dir->SetLform(
-                        dir->AttLineRendBase::StrToLineform(extender.node().attribute("line-type").as_string()));
+                        dir->AttLineRendBase::StrToLineform(extender.attribute("line-type").as_string()));
                 }
                 else {
                     dir->SetLform(LINEFORM_dashed);
@@ -2158,10 +2252,9 @@ void MusicXmlInput::ReadMusicXmlDirection(
 
     // Dynamics
     if (containsDynamics) {
-        pugi::xpath_node_set dynamics = node.select_nodes(
-            containsWords ? "direction-type/dynamics|direction-type/words" : "direction-type/dynamics");
-
-        dynamics.sort();
+        const std::vector<pugi::xml_node> dynamics = containsWords
+            ? GetGrandchildren(node, "direction-type", { "dynamics", "words" })
+            : GetGrandchildren(node, "direction-type", { "dynamics" });
 
         Dynam *dynam = new Dynam();
         dynam->SetPlace(dynam->AttPlacementRelStaff::StrToStaffrel(placeStr.c_str()));
@@ -2186,9 +2279,9 @@ void MusicXmlInput::ReadMusicXmlDirection(
         }
 
         TextRendition(dynamics, dynam);
-        if (defaultY == 0) {
-            defaultY = dynamics.first().node().attribute("default-y").as_int();
-            defaultY = (defaultY * 10) + dynamics.first().node().attribute("relative-y").as_int();
+        if (defaultY == 0 && !dynamics.empty()) {
+            defaultY = dynamics.front().attribute("default-y").as_int();
+            defaultY = (defaultY * 10) + dynamics.front().attribute("relative-y").as_int();
         }
         // parse the default_y attribute and transform to vgrp value, to vertically align dynamics and directives
         defaultY = (defaultY < 0) ? std::abs(defaultY) : defaultY + 2000;
@@ -2197,16 +2290,16 @@ void MusicXmlInput::ReadMusicXmlDirection(
         m_dynamStack.push_back(dynam);
 
         if (!dynamics.empty()) {
-            pugi::xpath_node extender = (dynamics.end() - 1)->parent().next_sibling("direction-type").first_child();
-            if (!strcmp(extender.node().name(), "bracket") || !strcmp(extender.node().name(), "dashes")) {
-                short int extNumber = extender.node().attribute("number").as_int();
+            pugi::xml_node extender = dynamics.back().parent().next_sibling("direction-type").first_child();
+            if (!strcmp(extender.name(), "bracket") || !strcmp(extender.name(), "dashes")) {
+                short int extNumber = extender.attribute("number").as_int();
                 extNumber = (extNumber < 1) ? 1 : extNumber;
                 short int staffNum = staffNode.text().as_int() + staffOffset;
                 staffNum = (staffNum < 1) ? 1 : staffNum;
                 dynam->SetExtender(BOOLEAN_true);
-                if (std::strncmp(extender.node().name(), "bracket", 7) == 0) {
+                if (std::strncmp(extender.name(), "bracket", 7) == 0) {
                     dynam->SetLform(
-                        dynam->AttLineRendBase::StrToLineform(extender.node().attribute("line-type").as_string()));
+                        dynam->AttLineRendBase::StrToLineform(extender.attribute("line-type").as_string()));
                 }
                 else {
                     dynam->SetLform(LINEFORM_dashed);
@@ -2218,12 +2311,12 @@ void MusicXmlInput::ReadMusicXmlDirection(
     }
 
     // Hairpins
-    pugi::xpath_node_set wedges = node.select_nodes("direction-type/wedge");
-    for (pugi::xpath_node_set::const_iterator wedge = wedges.begin(); wedge != wedges.end(); ++wedge) {
-        short int hairpinNumber = wedge->node().attribute("number").as_int();
+    const std::vector<pugi::xml_node> wedges = GetGrandchildren(node, "direction-type", { "wedge" });
+    for (pugi::xml_node wedge : wedges) {
+        short int hairpinNumber = wedge.attribute("number").as_int();
         hairpinNumber = (hairpinNumber < 1) ? 1 : hairpinNumber;
         bool matchedWedge = false;
-        if (HasAttributeWithValue(wedge->node(), "type", "stop")) {
+        if (HasAttributeWithValue(wedge, "type", "stop")) {
             // match wedge type=stop to open hairpin
             std::vector<std::pair<Hairpin *, musicxml::OpenSpanner>>::iterator iter;
             for (iter = m_hairpinStack.begin(); iter != m_hairpinStack.end(); ++iter) {
@@ -2232,13 +2325,13 @@ void MusicXmlInput::ReadMusicXmlDirection(
                     if (measureDifference >= 0) {
                         iter->first->SetTstamp2(std::pair<int, double>(measureDifference, timeStamp));
                     }
-                    if (wedge->node().attribute("niente")) {
-                        iter->first->SetNiente(ConvertWordToBool(wedge->node().attribute("niente").as_string()));
+                    if (wedge.attribute("niente")) {
+                        iter->first->SetNiente(ConvertWordToBool(wedge.attribute("niente").as_string()));
                     }
                     if (iter->first->GetForm() == hairpinLog_FORM_cres) {
-                        if (wedge->node().attribute("spread")) {
+                        if (wedge.attribute("spread")) {
                             data_MEASUREMENTSIGNED opening;
-                            opening.SetVu(wedge->node().attribute("spread").as_double() / 5);
+                            opening.SetVu(wedge.attribute("spread").as_double() / 5);
                             iter->first->SetOpening(opening);
                         }
                     }
@@ -2255,14 +2348,14 @@ void MusicXmlInput::ReadMusicXmlDirection(
         else {
             Hairpin *hairpin = new Hairpin();
             musicxml::OpenSpanner openHairpin(hairpinNumber, m_measureCounts.at(measure));
-            if (HasAttributeWithValue(wedge->node(), "type", "crescendo")) {
+            if (HasAttributeWithValue(wedge, "type", "crescendo")) {
                 hairpin->SetForm(hairpinLog_FORM_cres);
             }
-            else if (HasAttributeWithValue(wedge->node(), "type", "diminuendo")) {
+            else if (HasAttributeWithValue(wedge, "type", "diminuendo")) {
                 hairpin->SetForm(hairpinLog_FORM_dim);
-                if (wedge->node().attribute("spread")) {
+                if (wedge.attribute("spread")) {
                     data_MEASUREMENTSIGNED opening;
-                    opening.SetVu(wedge->node().attribute("spread").as_double() / 5);
+                    opening.SetVu(wedge.attribute("spread").as_double() / 5);
                     hairpin->SetOpening(opening);
                 }
             }
@@ -2271,14 +2364,14 @@ void MusicXmlInput::ReadMusicXmlDirection(
                 return;
             }
             hairpin->SetLform(
-                hairpin->AttLineRendBase::StrToLineform(wedge->node().attribute("line-type").as_string()));
-            if (wedge->node().attribute("niente")) {
-                hairpin->SetNiente(ConvertWordToBool(wedge->node().attribute("niente").as_string()));
+                hairpin->AttLineRendBase::StrToLineform(wedge.attribute("line-type").as_string()));
+            if (wedge.attribute("niente")) {
+                hairpin->SetNiente(ConvertWordToBool(wedge.attribute("niente").as_string()));
             }
-            hairpin->SetColor(wedge->node().attribute("color").as_string());
+            hairpin->SetColor(wedge.attribute("color").as_string());
             hairpin->SetPlace(hairpin->AttPlacementRelStaff::StrToStaffrel(placeStr.c_str()));
             hairpin->SetTstamp(timeStamp);
-            if (wedge->node().attribute("id")) hairpin->SetID(wedge->node().attribute("id").as_string());
+            if (wedge.attribute("id")) hairpin->SetID(wedge.attribute("id").as_string());
             if (staffNode) {
                 hairpin->SetStaff(hairpin->AttStaffIdent::StrToXsdPositiveIntegerList(
                     std::to_string(staffNode.text().as_int() + staffOffset)));
@@ -2290,8 +2383,8 @@ void MusicXmlInput::ReadMusicXmlDirection(
             else {
                 hairpin->SetStaff(hairpin->AttStaffIdent::StrToXsdPositiveIntegerList(std::to_string(1 + staffOffset)));
             }
-            int defaultY = wedge->node().attribute("default-y").as_int();
-            defaultY = (defaultY * 10) + wedge->node().attribute("relative-y").as_int();
+            int defaultY = wedge.attribute("default-y").as_int();
+            defaultY = (defaultY * 10) + wedge.attribute("relative-y").as_int();
             // parse the default_y attribute and transform to vgrp value, to vertically align hairpins
             defaultY = (defaultY < 0) ? std::abs(defaultY) : defaultY + 2000;
             hairpin->SetVgrp(defaultY);
@@ -2482,15 +2575,15 @@ void MusicXmlInput::ReadMusicXmlDirection(
     if (containsTempo) {
         Tempo *tempo = new Tempo();
         if (!words.empty()) {
-            const std::string lang = words.first().node().attribute("xml:lang")
-                ? words.first().node().attribute("xml:lang").as_string()
+            const std::string lang = words.front().attribute("xml:lang")
+                ? words.front().attribute("xml:lang").as_string()
                 : "it";
             tempo->SetLang(lang);
         }
         tempo->SetPlace(tempo->AttPlacementRelStaff::StrToStaffrel(placeStr.c_str()));
         if (words.size() != 0) TextRendition(words, tempo);
-        pugi::xpath_node metronome = node.select_node("direction-type/metronome[not(@print-object='no')]");
-        if (metronome) PrintMetronome(metronome.node(), tempo);
+        pugi::xml_node metronome = GetPrintedGrandchild(node, "direction-type", "metronome");
+        if (metronome) PrintMetronome(metronome, tempo);
         if (soundNode.attribute("tempo")) {
             tempo->SetMidiBpm(soundNode.attribute("tempo").as_double());
         }
@@ -2578,9 +2671,9 @@ void MusicXmlInput::ReadMusicXmlHarmony(pugi::xml_node node, Measure *measure, c
 
     int durOffset = 0;
 
-    std::string harmText = GetContentOfChild(node, "root/root-step");
-    pugi::xpath_node alter = node.select_node("root/root-alter");
-    if (alter) harmText += ConvertAlterToSymbol(GetContent(alter.node()));
+    std::string harmText = node.child("root").child("root-step").text().as_string();
+    pugi::xml_node alter = node.child("root").child("root-alter");
+    if (alter) harmText += ConvertAlterToSymbol(GetContent(alter));
     pugi::xml_node kind = node.child("kind");
     if (kind) {
         if (HasAttributeWithValue(kind, "use-symbols", "yes")) {
@@ -2661,49 +2754,47 @@ void MusicXmlInput::ReadMusicXmlNote(
         return;
     }
 
-    const pugi::xpath_node notations = node.select_node("notations[not(@print-object='no')]");
+    const pugi::xml_node notations = GetPrintedChild(node, "notations");
 
-    const bool cue = (node.child("cue") || node.select_node("type[@size='cue']")) ? true : false;
+    const bool cue = (node.child("cue") || node.find_child_by_attribute("type", "size", "cue")) ? true : false;
     pugi::xml_node grace = node.child("grace");
 
     // duration string and dots
     const std::string typeStr = node.child("type").text().as_string();
-    const int dots = (int)node.select_nodes("dot").size();
+    const int dots = (int)std::distance(node.children("dot").begin(), node.children("dot").end());
 
     short int tremSlashNum = -1;
 
     const bool readBeamsAndTuplets = ReadMusicXmlBeamsAndTuplets(node, layer, isChord);
 
     // beam start
-    bool beamStart = node.select_node("beam[@number='1'][text()='begin']");
+    bool beamStart = GetBeam(node, "begin", 1);
     // tremolos
-    pugi::xpath_node tremolo = notations.node().select_node("ornaments/tremolo");
+    pugi::xml_node tremolo = GetGrandchild(notations, "ornaments", "tremolo");
 
     if (tremolo) {
-        if (HasAttributeWithValue(tremolo.node(), "type", "start")) {
+        if (HasAttributeWithValue(tremolo, "type", "start")) {
             if (!isChord) {
                 FTrem *fTrem = new FTrem();
                 AddLayerElement(layer, fTrem);
                 m_elementStackMap.at(layer).push_back(fTrem);
-                int beamFloatNum = tremolo.node().text().as_int(); // number of floating beams
+                int beamFloatNum = tremolo.text().as_int(); // number of floating beams
                 int beamAttachedNum = 0; // number of attached beams
                 while (beamStart && beamAttachedNum < 8) { // count number of (attached) beams, max 8
-                    std::ostringstream o;
-                    o << "beam[@number='" << ++beamAttachedNum + 1 << "'][text()='begin']";
-                    beamStart = node.select_node(o.str().c_str());
+                    beamStart = GetBeam(node, "begin", ++beamAttachedNum + 1);
                 }
                 fTrem->SetBeams(beamFloatNum + beamAttachedNum);
                 fTrem->SetBeamsFloat(beamFloatNum);
             }
         }
-        else if (!HasAttributeWithValue(tremolo.node(), "type", "stop")) {
+        else if (!HasAttributeWithValue(tremolo, "type", "stop")) {
             // this is default tremolo type in MusicXML
-            tremSlashNum = tremolo.node().text().as_int();
+            tremSlashNum = tremolo.text().as_int();
             if (!isChord) {
                 BTrem *bTrem = new BTrem();
                 AddLayerElement(layer, bTrem);
                 m_elementStackMap.at(layer).push_back(bTrem);
-                if (HasAttributeWithValue(tremolo.node(), "type", "unmeasured")) {
+                if (HasAttributeWithValue(tremolo, "type", "unmeasured")) {
                     bTrem->SetForm(tremForm_FORM_unmeas);
                     tremSlashNum = 0;
                 }
@@ -2823,7 +2914,7 @@ void MusicXmlInput::ReadMusicXmlNote(
         // accidental
         pugi::xml_node accidental = node.child("accidental");
         if (!accidental) {
-            accidental = node.select_node("notations/accidental-mark").node();
+            accidental = GetGrandchild(node, "notations", "accidental-mark");
         }
         if (accidental) {
             Accid *accid = new Accid();
@@ -2906,8 +2997,8 @@ void MusicXmlInput::ReadMusicXmlNote(
         if (node.child("notehead-text")) LogWarning("MusicXML import: notehead-text is not supported");
 
         // look at the next note to see if we are starting or ending a chord
-        pugi::xpath_node nextNote = node.select_node("./following-sibling::note");
-        if (nextNote.node().child("chord")) nextIsChord = true;
+        pugi::xml_node nextNote = node.next_sibling("note");
+        if (nextNote.child("chord")) nextIsChord = true;
         Chord *chord = NULL;
         TabGrp *tabGrp = NULL;
         if (isTablature) {
@@ -3124,9 +3215,7 @@ void MusicXmlInput::ReadMusicXmlNote(
         }
 
         // slurs
-        pugi::xpath_node_set slurs = node.select_nodes("notations/slur");
-        for (pugi::xpath_node_set::const_iterator it = slurs.begin(); it != slurs.end(); ++it) {
-            pugi::xml_node slur = it->node();
+        for (pugi::xml_node slur : GetGrandchildren(node, "notations", { "slur" })) {
             short int slurNumber = slur.attribute("number").as_int();
             slurNumber = (slurNumber < 1) ? 1 : slurNumber;
             const curvature_CURVEDIR dir = InferCurvedir(slur);
@@ -3148,11 +3237,11 @@ void MusicXmlInput::ReadMusicXmlNote(
         }
 
         // ties
-        ReadMusicXmlTies(notations.node(), layer, note, measureNum);
+        ReadMusicXmlTies(notations, layer, note, measureNum);
 
         // articulation
         std::vector<data_ARTICULATION> artics;
-        for (pugi::xml_node articulations : notations.node().children("articulations")) {
+        for (pugi::xml_node articulations : notations.children("articulations")) {
             for (pugi::xml_node articulation : articulations.children()) {
                 Artic *artic = new Artic();
                 artics.push_back(ConvertArticulations(articulation.name()));
@@ -3181,7 +3270,7 @@ void MusicXmlInput::ReadMusicXmlNote(
         }
 
         // technical
-        for (pugi::xml_node technical : notations.node().children("technical")) {
+        for (pugi::xml_node technical : notations.children("technical")) {
             for (pugi::xml_node technicalChild : technical.children()) {
                 const std::string technicalChildName = technicalChild.name();
 
@@ -3271,31 +3360,31 @@ void MusicXmlInput::ReadMusicXmlNote(
     m_ID = "#" + element->GetID();
 
     // breath marks
-    pugi::xpath_node xmlBreath = notations.node().select_node("articulations/breath-mark");
+    pugi::xml_node xmlBreath = GetGrandchild(notations, "articulations", "breath-mark");
     if (xmlBreath) {
         Breath *breath = new Breath();
         m_controlElements.push_back({ measureNum, breath });
         breath->SetStaff(staff->AttNInteger::StrToXsdPositiveIntegerList(std::to_string(staff->GetN())));
         breath->SetPlace(
-            breath->AttPlacementRelStaff::StrToStaffrel(xmlBreath.node().attribute("placement").as_string()));
-        breath->SetColor(xmlBreath.node().attribute("color").as_string());
+            breath->AttPlacementRelStaff::StrToStaffrel(xmlBreath.attribute("placement").as_string()));
+        breath->SetColor(xmlBreath.attribute("color").as_string());
         breath->SetTstamp((double)(m_durTotal) * (double)m_meterUnit / (double)(4 * m_ppq) + 0.5);
     }
 
     // caesura
-    pugi::xpath_node xmlCaesura = notations.node().select_node("articulations/caesura");
+    pugi::xml_node xmlCaesura = GetGrandchild(notations, "articulations", "caesura");
     if (xmlCaesura) {
         Caesura *caesura = new Caesura();
         m_controlElements.push_back({ measureNum, caesura });
         caesura->SetStaff(staff->AttNInteger::StrToXsdPositiveIntegerList(std::to_string(staff->GetN())));
         caesura->SetPlace(
-            caesura->AttPlacementRelStaff::StrToStaffrel(xmlCaesura.node().attribute("placement").as_string()));
-        caesura->SetColor(xmlCaesura.node().attribute("color").as_string());
+            caesura->AttPlacementRelStaff::StrToStaffrel(xmlCaesura.attribute("placement").as_string()));
+        caesura->SetColor(xmlCaesura.attribute("color").as_string());
         caesura->SetTstamp((double)(m_durTotal) * (double)m_meterUnit / (double)(4 * m_ppq) + 0.5);
     }
 
     // dynamics
-    pugi::xml_node xmlDynam = notations.node().child("dynamics");
+    pugi::xml_node xmlDynam = notations.child("dynamics");
     if (xmlDynam) {
         Dynam *dynam = new Dynam();
         m_controlElements.push_back({ measureNum, dynam });
@@ -3324,7 +3413,7 @@ void MusicXmlInput::ReadMusicXmlNote(
     }
 
     // fermatas
-    pugi::xml_node xmlFermata = notations.node().child("fermata");
+    pugi::xml_node xmlFermata = notations.child("fermata");
     if (xmlFermata) {
         Fermata *fermata = new Fermata();
         m_controlElements.push_back({ measureNum, fermata });
@@ -3335,9 +3424,9 @@ void MusicXmlInput::ReadMusicXmlNote(
     }
 
     // fingering
-    auto xmlFing = notations.node().select_node("technical/fingering");
+    pugi::xml_node xmlFing = GetGrandchild(notations, "technical", "fingering");
     if (xmlFing) {
-        const std::string fingText = xmlFing.node().text().as_string();
+        const std::string fingText = xmlFing.text().as_string();
         Fing *fing = new Fing();
         Text *text = new Text();
         text->SetText(UTF8to32(fingText));
@@ -3345,17 +3434,16 @@ void MusicXmlInput::ReadMusicXmlNote(
         const std::string startID = note ? ("#" + note->GetID()) : m_ID;
         fing->SetStartid(startID);
         fing->SetStaff(staff->AttNInteger::StrToXsdPositiveIntegerList(std::to_string(staff->GetN())));
-        fing->SetPlace(fing->AttPlacementRelStaff::StrToStaffrel(xmlFing.node().attribute("placement").as_string()));
+        fing->SetPlace(fing->AttPlacementRelStaff::StrToStaffrel(xmlFing.attribute("placement").as_string()));
         fing->AddChild(text);
     }
 
     // glissando and slide
-    pugi::xpath_node_set glissandi = notations.node().select_nodes("glissando|slide");
-    for (pugi::xpath_node_set::const_iterator it = glissandi.begin(); it != glissandi.end(); ++it) {
+    for (pugi::xml_node xmlGlissando : notations.children()) {
+        if (!IsElement(xmlGlissando, "glissando") && !IsElement(xmlGlissando, "slide")) continue;
         std::string noteID = m_ID;
         // prevent from using chords or tabGrps
         if (element->Is(CHORD) || element->Is(TABGRP)) noteID = "#" + element->GetChild(0)->GetID();
-        pugi::xml_node xmlGlissando = it->node();
         if (HasAttributeWithValue(xmlGlissando, "type", "start")) {
             Gliss *gliss = new Gliss();
             m_controlElements.push_back({ measureNum, gliss });
@@ -3384,25 +3472,25 @@ void MusicXmlInput::ReadMusicXmlNote(
     }
 
     // mordents
-    pugi::xpath_node xmlMordent = notations.node().select_node("ornaments/*[contains(name(), 'mordent')]");
+    pugi::xml_node xmlMordent = GetGrandchildWithSubstring(notations, "ornaments", { "mordent" });
     if (xmlMordent) {
         Mordent *mordent = new Mordent();
         m_controlElements.push_back({ measureNum, mordent });
         mordent->SetStaff(staff->AttNInteger::StrToXsdPositiveIntegerList(std::to_string(staff->GetN())));
         mordent->SetStartid(m_ID);
         // color
-        mordent->SetColor(xmlMordent.node().attribute("color").as_string());
+        mordent->SetColor(xmlMordent.attribute("color").as_string());
         // long
-        mordent->SetLong(ConvertWordToBool(xmlMordent.node().attribute("long").as_string()));
+        mordent->SetLong(ConvertWordToBool(xmlMordent.attribute("long").as_string()));
         // place
         mordent->SetPlace(
-            mordent->AttPlacementRelStaff::StrToStaffrel(xmlMordent.node().attribute("placement").as_string()));
+            mordent->AttPlacementRelStaff::StrToStaffrel(xmlMordent.attribute("placement").as_string()));
         // form
         mordent->SetForm(mordentLog_FORM_lower);
-        if (!std::strncmp(xmlMordent.node().name(), "inverted", 7)) {
+        if (!std::strncmp(xmlMordent.name(), "inverted", 7)) {
             mordent->SetForm(mordentLog_FORM_upper);
         }
-        for (pugi::xml_node xmlAccidMark : notations.node().children("accidental-mark")) {
+        for (pugi::xml_node xmlAccidMark : notations.children("accidental-mark")) {
             const data_ACCIDENTAL_WRITTEN accid = ConvertAccidentalToAccid(xmlAccidMark.text().as_string());
             if (HasAttributeWithValue(xmlAccidMark, "placement", "above")) {
                 mordent->SetAccidupper(accid);
@@ -3417,13 +3505,13 @@ void MusicXmlInput::ReadMusicXmlNote(
         }
         if (BOOLEAN_true == mordent->GetLong()) {
             int mordentFlags = (mordentLog_FORM_upper == mordent->GetForm()) ? FORM_Inverted : FORM_Normal;
-            if (xmlMordent.node().attribute("approach")) {
-                mordentFlags |= (std::string(xmlMordent.node().attribute("approach").as_string()) == "above")
+            if (xmlMordent.attribute("approach")) {
+                mordentFlags |= (std::string(xmlMordent.attribute("approach").as_string()) == "above")
                     ? APPR_Above
                     : APPR_Below;
             }
-            if (xmlMordent.node().attribute("departure")) {
-                mordentFlags |= (std::string(xmlMordent.node().attribute("departure").as_string()) == "above")
+            if (xmlMordent.attribute("departure")) {
+                mordentFlags |= (std::string(xmlMordent.attribute("departure").as_string()) == "above")
                     ? DEP_Above
                     : DEP_Below;
             }
@@ -3436,48 +3524,47 @@ void MusicXmlInput::ReadMusicXmlNote(
     }
 
     // schleifer/haydn (counts as mordent with different glyph)
-    pugi::xpath_node xmlExtOrnament
-        = notations.node().select_node("ornaments/*[contains(name(), 'schleifer') or contains(name(), 'haydn')]");
+    pugi::xml_node xmlExtOrnament = GetGrandchildWithSubstring(notations, "ornaments", { "schleifer", "haydn" });
     if (xmlExtOrnament) {
         Mordent *mordent = new Mordent();
         m_controlElements.push_back({ measureNum, mordent });
         mordent->SetStaff(staff->AttNInteger::StrToXsdPositiveIntegerList(std::to_string(staff->GetN())));
         mordent->SetStartid(m_ID);
         // color
-        mordent->SetColor(xmlExtOrnament.node().attribute("color").as_string());
+        mordent->SetColor(xmlExtOrnament.attribute("color").as_string());
         // place
         mordent->SetPlace(
-            mordent->AttPlacementRelStaff::StrToStaffrel(xmlExtOrnament.node().attribute("placement").as_string()));
-        const bool isHaydn = std::string(xmlExtOrnament.node().name()) == "haydn";
+            mordent->AttPlacementRelStaff::StrToStaffrel(xmlExtOrnament.attribute("placement").as_string()));
+        const bool isHaydn = std::string(xmlExtOrnament.name()) == "haydn";
         AttModule::SetExternalsymbols(mordent, "glyph.num", isHaydn ? "U+E56F" : "U+E587");
         AttModule::SetExternalsymbols(mordent, "glyph.auth", "smufl");
     }
 
     // trill
-    pugi::xpath_node xmlTrill = notations.node().select_node("ornaments/trill-mark");
-    pugi::xpath_node xmlTrillLine = notations.node().select_node("ornaments/wavy-line[@type='start']");
+    pugi::xml_node xmlTrill = GetGrandchild(notations, "ornaments", "trill-mark");
+    pugi::xml_node xmlTrillLine = GetGrandchildWithAttribute(notations, "ornaments", "wavy-line", "type", "start");
     if (xmlTrill || xmlTrillLine) {
         Trill *trill = new Trill();
         m_controlElements.push_back({ measureNum, trill });
         trill->SetStaff(staff->AttNInteger::StrToXsdPositiveIntegerList(std::to_string(staff->GetN())));
         trill->SetStartid(m_ID);
         // color
-        trill->SetColor(xmlTrill.node().attribute("color").as_string());
+        trill->SetColor(xmlTrill.attribute("color").as_string());
         // place
-        trill->SetPlace(trill->AttPlacementRelStaff::StrToStaffrel(xmlTrill.node().attribute("placement").as_string()));
+        trill->SetPlace(trill->AttPlacementRelStaff::StrToStaffrel(xmlTrill.attribute("placement").as_string()));
         if (xmlTrillLine) {
             trill->SetExtender(BOOLEAN_true);
-            trill->SetN(xmlTrillLine.node().attribute("number").as_string());
+            trill->SetN(xmlTrillLine.attribute("number").as_string());
             if (!xmlTrill) {
                 trill->SetLstartsym(LINESTARTENDSYMBOL_none);
-                trill->SetColor(xmlTrillLine.node().attribute("color").as_string());
+                trill->SetColor(xmlTrillLine.attribute("color").as_string());
                 trill->SetPlace(
-                    trill->AttPlacementRelStaff::StrToStaffrel(xmlTrillLine.node().attribute("placement").as_string()));
+                    trill->AttPlacementRelStaff::StrToStaffrel(xmlTrillLine.attribute("placement").as_string()));
             }
             musicxml::OpenSpanner openTrill(1, m_measureCounts.at(measure));
             m_trillStack.push_back({ trill, openTrill });
         }
-        for (pugi::xml_node xmlAccidMark = xmlTrill.node().next_sibling("accidental-mark"); xmlAccidMark;
+        for (pugi::xml_node xmlAccidMark = xmlTrill.next_sibling("accidental-mark"); xmlAccidMark;
              xmlAccidMark = xmlAccidMark.next_sibling("accidental-mark")) {
             if (HasAttributeWithValue(xmlAccidMark, "placement", "below")) {
                 trill->SetAccidlower(ConvertAccidentalToAccid(xmlAccidMark.text().as_string()));
@@ -3487,9 +3574,9 @@ void MusicXmlInput::ReadMusicXmlNote(
             }
         }
     }
-    if (!m_trillStack.empty() && notations.node().select_node("ornaments/wavy-line[@type='stop']")) {
-        short int extNumber
-            = notations.node().select_node("ornaments/wavy-line[@type='stop']").node().attribute("number").as_int();
+    pugi::xml_node xmlTrillLineStop = GetGrandchildWithAttribute(notations, "ornaments", "wavy-line", "type", "stop");
+    if (!m_trillStack.empty() && xmlTrillLineStop) {
+        short int extNumber = xmlTrillLineStop.attribute("number").as_int();
         std::vector<std::pair<Trill *, musicxml::OpenSpanner>>::iterator iter = m_trillStack.begin();
         while (iter != m_trillStack.end()) {
             const int measureDifference = m_measureCounts.at(measure) - iter->second.m_lastMeasureCount;
@@ -3506,16 +3593,16 @@ void MusicXmlInput::ReadMusicXmlNote(
     }
 
     // turns
-    pugi::xpath_node xmlTurn = notations.node().select_node("ornaments/*[contains(name(), 'turn')]");
+    pugi::xml_node xmlTurn = GetGrandchildWithSubstring(notations, "ornaments", { "turn" });
     if (xmlTurn) {
         Turn *turn = new Turn();
         m_controlElements.push_back({ measureNum, turn });
         turn->SetStaff(staff->AttNInteger::StrToXsdPositiveIntegerList(std::to_string(staff->GetN())));
         turn->SetStartid(m_ID);
-        turn->SetColor(xmlTurn.node().attribute("color").as_string());
-        turn->SetPlace(turn->AttPlacementRelStaff::StrToStaffrel(xmlTurn.node().attribute("placement").as_string()));
+        turn->SetColor(xmlTurn.attribute("color").as_string());
+        turn->SetPlace(turn->AttPlacementRelStaff::StrToStaffrel(xmlTurn.attribute("placement").as_string()));
         turn->SetForm(turnLog_FORM_upper);
-        for (pugi::xml_node xmlAccidMark = xmlTurn.node().next_sibling("accidental-mark"); xmlAccidMark;
+        for (pugi::xml_node xmlAccidMark = xmlTurn.next_sibling("accidental-mark"); xmlAccidMark;
              xmlAccidMark = xmlAccidMark.next_sibling("accidental-mark")) {
             if (HasAttributeWithValue(xmlAccidMark, "placement", "above")) {
                 turn->SetAccidupper(ConvertAccidentalToAccid(xmlAccidMark.text().as_string()));
@@ -3527,22 +3614,22 @@ void MusicXmlInput::ReadMusicXmlNote(
                 LogWarning("MusicXML import: Cannot add an accidental to a turn without placement");
             }
         }
-        if (xmlTurn.node().attribute("slash").as_bool()) {
+        if (xmlTurn.attribute("slash").as_bool()) {
             AttModule::SetExternalsymbols(turn, "glyph.auth", "smufl");
             AttModule::SetExternalsymbols(turn, "glyph.num", "U+E569");
         }
-        if (!std::strncmp(xmlTurn.node().name(), "inverted", 8)) {
+        if (!std::strncmp(xmlTurn.name(), "inverted", 8)) {
             turn->SetForm(turnLog_FORM_lower);
-            if (std::string(xmlTurn.node().name()).find("vertical") != std::string::npos) {
+            if (std::string(xmlTurn.name()).find("vertical") != std::string::npos) {
                 turn->SetType("vertical");
                 AttModule::SetExternalsymbols(turn, "glyph.auth", "smufl");
                 AttModule::SetExternalsymbols(turn, "glyph.num", "U+E56B");
             }
         }
-        if (!std::strncmp(xmlTurn.node().name(), "delayed", 7)) {
+        if (!std::strncmp(xmlTurn.name(), "delayed", 7)) {
             turn->SetDelayed(BOOLEAN_true);
         }
-        if (!std::strncmp(xmlTurn.node().name(), "vertical", 8)) {
+        if (!std::strncmp(xmlTurn.name(), "vertical", 8)) {
             turn->SetType("vertical");
             AttModule::SetExternalsymbols(turn, "glyph.auth", "smufl");
             AttModule::SetExternalsymbols(turn, "glyph.num", "U+E56A");
@@ -3550,11 +3637,12 @@ void MusicXmlInput::ReadMusicXmlNote(
     }
 
     // arpeggio
-    pugi::xpath_node xmlArpeggiate = notations.node().select_node("*[contains(name(), 'arpeggiate')]");
+    pugi::xml_node xmlArpeggiate = notations.find_child(
+        [](pugi::xml_node child) { return std::strstr(child.name(), "arpeggiate") != NULL; });
     if (xmlArpeggiate) {
-        short int arpegN = xmlArpeggiate.node().attribute("number").as_int();
+        short int arpegN = xmlArpeggiate.attribute("number").as_int();
         arpegN = (arpegN < 1) ? 1 : arpegN;
-        const std::string direction = xmlArpeggiate.node().attribute("direction").as_string();
+        const std::string direction = xmlArpeggiate.attribute("direction").as_string();
         bool added = false;
         if (!m_ArpeggioStack.empty()) { // check existing arpeggios
             for (auto iter = m_ArpeggioStack.begin(); iter != m_ArpeggioStack.end(); ++iter) {
@@ -3570,7 +3658,7 @@ void MusicXmlInput::ReadMusicXmlNote(
             Arpeg *arpeggio = new Arpeg();
             arpeggio->GetPlistInterface()->AddRef("#" + element->GetID());
             // color
-            arpeggio->SetColor(xmlArpeggiate.node().attribute("color").as_string());
+            arpeggio->SetColor(xmlArpeggiate.attribute("color").as_string());
             // direction (up/down) and in MEI arrow
             if (!direction.empty()) {
                 arpeggio->SetArrow(BOOLEAN_true);
@@ -3584,7 +3672,7 @@ void MusicXmlInput::ReadMusicXmlNote(
                     arpeggio->SetOrder(arpegLog_ORDER_NONE);
                 }
             }
-            if (!std::strncmp(xmlArpeggiate.node().name(), "non", 3)) {
+            if (!std::strncmp(xmlArpeggiate.name(), "non", 3)) {
                 arpeggio->SetOrder(arpegLog_ORDER_nonarp);
             }
             m_ArpeggioStack.push_back({ arpeggio, musicxml::OpenArpeggio(arpegN, onset) });
@@ -3594,24 +3682,27 @@ void MusicXmlInput::ReadMusicXmlNote(
 
     // tremolo end
     if (tremolo) {
-        if (HasAttributeWithValue(tremolo.node(), "type", "stop")) {
+        if (HasAttributeWithValue(tremolo, "type", "stop")) {
             RemoveLastFromStack(FTREM, layer);
         }
-        else if (!HasAttributeWithValue(tremolo.node(), "type", "start") && !isChord) {
+        else if (!HasAttributeWithValue(tremolo, "type", "start") && !isChord) {
             RemoveLastFromStack(BTREM, layer);
         }
     }
 
     // tuplet end
-    pugi::xpath_node tupletEnd = node.select_node("notations/tuplet[@type='stop']");
+    pugi::xml_node tupletEnd = GetGrandchildWithAttribute(node, "notations", "tuplet", "type", "stop");
     if (tupletEnd) {
         RemoveLastFromStack(TUPLET, layer);
     }
 
     // beam end
-    bool beamEnd = node.select_node("beam[text()='end']");
+    bool beamEnd = GetBeam(node, "end");
     if (beamEnd) {
-        int breakSec = (int)node.select_nodes("beam[text()='continue']").size();
+        int breakSec = 0;
+        for (pugi::xml_node beam : node.children("beam")) {
+            if (HasContentWithValue(beam, "continue")) ++breakSec;
+        }
         if (breakSec) {
             if (element->Is(NOTE)) {
                 Note *note = vrv_cast<Note *>(element);
@@ -3714,14 +3805,24 @@ void MusicXmlInput::ReadMusicXmlPrint(pugi::xml_node node, Section *section)
 
 bool MusicXmlInput::ReadMusicXmlBeamsAndTuplets(const pugi::xml_node &node, Layer *layer, bool isChord)
 {
-    pugi::xpath_node beamStart = node.select_node("beam[@number='1' and text()='begin']");
-    pugi::xpath_node tupletStart = node.select_node("notations/tuplet[@type='start']");
-    pugi::xpath_node currentMeasure = node.select_node("ancestor::measure");
+    pugi::xml_node beamStart = GetBeam(node, "begin", 1);
+    pugi::xml_node tupletStart = GetGrandchildWithAttribute(node, "notations", "tuplet", "type", "start");
+    if (!beamStart && !tupletStart) return true;
 
-    pugi::xml_node beamEnd = node.select_node("./following-sibling::note[beam[@number='1' and text()='end']]").node();
-    pugi::xml_node tupletEnd = node.select_node("./following-sibling::note[notations/tuplet[@type='stop']]").node();
+    pugi::xml_node currentMeasure = node.parent();
 
-    const auto measureNodeChildren = currentMeasure.node().children();
+    // look for the following notes ending the beam and the tuplet
+    pugi::xml_node beamEnd;
+    pugi::xml_node tupletEnd;
+    for (pugi::xml_node nextNote = node.next_sibling("note"); nextNote && (!beamEnd || !tupletEnd);
+         nextNote = nextNote.next_sibling("note")) {
+        if (!beamEnd && GetBeam(nextNote, "end", 1)) beamEnd = nextNote;
+        if (!tupletEnd && GetGrandchildWithAttribute(nextNote, "notations", "tuplet", "type", "stop")) {
+            tupletEnd = nextNote;
+        }
+    }
+
+    const auto measureNodeChildren = currentMeasure.children();
     std::vector<pugi::xml_node> currentMeasureNodes(measureNodeChildren.begin(), measureNodeChildren.end());
     // in case note is a start of both beam and tuplet - need to figure which one is longer
     if (beamStart && tupletStart) {
@@ -3732,20 +3833,23 @@ bool MusicXmlInput::ReadMusicXmlBeamsAndTuplets(const pugi::xml_node &node, Laye
         // Negative number - beam ends first, positive - tuplet, zero - both are of the same length
         const int distance = static_cast<int>(std::distance(beamEndIterator, tupletEndIterator));
         if (distance > 0) {
-            if (!isChord) ReadMusicXmlTupletStart(node, tupletStart.node(), layer);
-            ReadMusicXmlBeamStart(node, beamStart.node(), layer);
+            if (!isChord) ReadMusicXmlTupletStart(node, tupletStart, layer);
+            ReadMusicXmlBeamStart(node, beamStart, layer);
         }
         else {
-            ReadMusicXmlBeamStart(node, beamStart.node(), layer);
-            if (!isChord) ReadMusicXmlTupletStart(node, tupletStart.node(), layer);
+            ReadMusicXmlBeamStart(node, beamStart, layer);
+            if (!isChord) ReadMusicXmlTupletStart(node, tupletStart, layer);
         }
     }
     // If note is a start of the beam only - check if there is a tuplet starting/ending in the span of
     // the whole duration of this beam
     else if (beamStart) {
         // find whether there is a tuplet that starts during the span of the beam
-        pugi::xpath_node nextTupletStart
-            = node.select_node("./following-sibling::note[notations/tuplet[@type='start']]").node();
+        pugi::xml_node nextTupletStart = node.next_sibling("note");
+        while (nextTupletStart
+            && !GetGrandchildWithAttribute(nextTupletStart, "notations", "tuplet", "type", "start")) {
+            nextTupletStart = nextTupletStart.next_sibling("note");
+        }
 
         // find start and end of the beam
         const auto beamStartIterator = std::find(currentMeasureNodes.begin(), currentMeasureNodes.end(), node);
@@ -3753,36 +3857,36 @@ bool MusicXmlInput::ReadMusicXmlBeamsAndTuplets(const pugi::xml_node &node, Laye
 
         // find staff number for the corresponding elements - we do not want to match beam start on one staff with beam
         // end on another
-        pugi::xpath_node nodeStaff = node.select_node("staff");
-        pugi::xpath_node endBeamStaff = beamEnd.select_node("staff");
+        pugi::xml_node nodeStaff = node.child("staff");
+        pugi::xml_node endBeamStaff = beamEnd.child("staff");
 
         if (beamEndIterator == currentMeasureNodes.end()
             || (nodeStaff && endBeamStaff
-                && (nodeStaff.node().text().as_int() != endBeamStaff.node().text().as_int()))) {
-            std::string measureName = (currentMeasure.node().attribute("id"))
-                ? currentMeasure.node().attribute("id").as_string()
-                : currentMeasure.node().attribute("number").as_string();
+                && (nodeStaff.text().as_int() != endBeamStaff.text().as_int()))) {
+            std::string measureName = (currentMeasure.attribute("id"))
+                ? currentMeasure.attribute("id").as_string()
+                : currentMeasure.attribute("number").as_string();
             LogDebug("MusicXML import: Beam without end in measure %s treated as <beamSpan>", measureName.c_str());
             return false;
         }
         // form vector of the beam nodes and find whether there are tuplets that start or end within the beam
         std::vector<pugi::xml_node> beamNodes(beamStartIterator, beamEndIterator + 1);
         bool isTupletStartInBeam
-            = (beamNodes.end() != std::find(beamNodes.begin(), beamNodes.end(), nextTupletStart.node()));
+            = (beamNodes.end() != std::find(beamNodes.begin(), beamNodes.end(), nextTupletStart));
         bool isTupletEndInBeam = (beamNodes.end() != std::find(beamNodes.begin(), beamNodes.end(), tupletEnd));
         // in case if there is only start/end of the tuplet in the beam, then we need to use beamSpan instead
         if ((tupletEnd != beamEnd) && (isTupletStartInBeam != isTupletEndInBeam)) {
             // TODO: same call as in else-case is intentional. Proper beamSpan support will need to be implemented
             // before this case can be handled correctly
-            ReadMusicXmlBeamStart(node, beamStart.node(), layer);
+            ReadMusicXmlBeamStart(node, beamStart, layer);
         }
         else {
-            ReadMusicXmlBeamStart(node, beamStart.node(), layer);
+            ReadMusicXmlBeamStart(node, beamStart, layer);
         }
     }
     // no special logic needed if we have just tupletStart - just read it as is
     else if (tupletStart) {
-        if (!isChord) ReadMusicXmlTupletStart(node, tupletStart.node(), layer);
+        if (!isChord) ReadMusicXmlTupletStart(node, tupletStart, layer);
     }
 
     return true;
@@ -3797,11 +3901,11 @@ void MusicXmlInput::ReadMusicXmlTupletStart(const pugi::xml_node &node, const pu
     Tuplet *tuplet = new Tuplet();
     AddLayerElement(layer, tuplet);
     m_elementStackMap.at(layer).push_back(tuplet);
-    short int num = node.select_node("time-modification/actual-notes").node().text().as_int();
-    short int numbase = node.select_node("time-modification/normal-notes").node().text().as_int();
+    short int num = GetGrandchild(node, "time-modification", "actual-notes").text().as_int();
+    short int numbase = GetGrandchild(node, "time-modification", "normal-notes").text().as_int();
     if (tupletStart.first_child()) {
-        num = tupletStart.select_node("tuplet-actual/tuplet-number").node().text().as_int();
-        numbase = tupletStart.select_node("tuplet-normal/tuplet-number").node().text().as_int();
+        num = GetGrandchild(tupletStart, "tuplet-actual", "tuplet-number").text().as_int();
+        numbase = GetGrandchild(tupletStart, "tuplet-normal", "tuplet-number").text().as_int();
     }
     if (num) tuplet->SetNum(num);
     if (numbase) tuplet->SetNumbase(numbase);
@@ -3814,7 +3918,10 @@ void MusicXmlInput::ReadMusicXmlTupletStart(const pugi::xml_node &node, const pu
 
 void MusicXmlInput::ReadMusicXmlBeamStart(const pugi::xml_node &node, const pugi::xml_node &beamStart, Layer *layer)
 {
-    if (!beamStart || (node.select_node("notations/ornaments/tremolo[@type='start']"))) return;
+    if (!beamStart) return;
+    for (pugi::xml_node notations : node.children("notations")) {
+        if (GetGrandchildWithAttribute(notations, "ornaments", "tremolo", "type", "start")) return;
+    }
     if (m_elementStackMap.at(layer).size() > 0 && m_elementStackMap.at(layer).back()->Is(BEAM)) {
         LogDebug("MusicXML import: Adding a beam to a beam");
         if (!node.child("grace")) return;
@@ -4666,17 +4773,17 @@ bool MusicXmlInput::IsMultirestMeasure(int index) const
 
 std::pair<std::vector<int>, int> MusicXmlInput::GetMeterSigGrpValues(const pugi::xml_node &node, MeterSigGrp *parent)
 {
-    pugi::xpath_node_set beats = node.select_nodes("beats");
-    pugi::xpath_node_set beat_type = node.select_nodes("beat-type");
+    const auto beats = node.children("beats");
+    const auto beat_type = node.children("beat-type");
     int maxUnit = 0;
     std::vector<int> meterCounts;
     for (auto iter1 = beats.begin(), iter2 = beat_type.begin(); (iter1 != beats.end()) && (iter2 != beat_type.end());
          ++iter1, ++iter2) {
         // Process current beat/beat-type combination and add it to the meterSigGrp
         MeterSig *meterSig = new MeterSig();
-        data_METERCOUNT_pair count = meterSig->AttMeterSigLog::StrToMetercountPair(iter1->node().text().as_string());
+        data_METERCOUNT_pair count = meterSig->AttMeterSigLog::StrToMetercountPair(iter1->text().as_string());
         meterSig->SetCount(count);
-        int currentUnit = iter2->node().text().as_int();
+        int currentUnit = iter2->text().as_int();
         meterSig->SetUnit(currentUnit);
         parent->AddChild(meterSig);
         std::vector<int> currentCount;
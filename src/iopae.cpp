@@ -2778,7 +2778,7 @@ bool PAEInput::Import(const std::string &input)
 
     // Genereate the header and add a comment to the project description
     m_doc->GenerateMEIHeader(false);
-    pugi::xml_node projectDesc = m_doc->m_header.first_child().select_node("//projectDesc").node();
+    pugi::xml_node projectDesc = m_doc->m_header.first_child().child("encodingDesc").child("projectDesc");
     if (projectDesc) {
         pugi::xml_node p1 = projectDesc.append_child("p");
         p1.text().set("Converted from Plaine and Easie to MEI");
@@ -205,6 +205,7 @@ void Measure::AddChildBack(Object *child)
             }
         }
     }
+    this->IndexChild(child);
     Modify();
 }
 
@@ -246,12 +247,22 @@ void Measure::CacheXRel(bool restore)
         m_drawingXRel = m_cachedXRel;
     }
     else {
-        m_cachedWidth = this->GetWidth();
-        m_cachedOverflow = this->GetDrawingOverflow();
+        // A measure with a cached layout was not laid out again and only its position changed
+        if (!this->HasCachedHorizontalLayout()) {
+            m_cachedWidth = this->GetWidth();
+            m_cachedOverflow = this->GetDrawingOverflow();
+        }
         m_cachedXRel = m_drawingXRel;
     }
 }
 
+void Measure::ResetCachedHorizontalLayout()
+{
+    this->ResetCachedXRel();
+    this->ResetCachedWidth();
+    this->ResetCachedOverflow();
+}
+
 bool Measure::IsFirstInSystem() const
 {
     assert(this->GetParent());
@@ -493,8 +504,7 @@ const Staff *Measure::GetBottomVisibleStaff() const
 int Measure::EnclosesTime(int time) const
 {
     int repeat = 1;
-    double timeDuration
-        = m_measureAligner.GetRightAlignment()->GetTime() * DURATION_4 / DUR_MAX * 60.0 / m_currentTempo * 1000.0 + 0.5;
+    double timeDuration = this->GetRealTimeDurationMilliseconds();
     std::vector<double>::const_iterator iter;
     for (iter = m_realTimeOffsetMilliseconds.begin(); iter != m_realTimeOffsetMilliseconds.end(); ++iter) {
         if ((time >= *iter) && (time <= *iter + timeDuration)) return repeat;
@@ -509,6 +519,22 @@ double Measure::GetRealTimeOffsetMilliseconds(int repeat) const
     return m_realTimeOffsetMilliseconds.at(repeat - 1);
 }
 
+double Measure::GetScoreTimeOffset(int repeat) const
+{
+    if ((repeat < 1) || repeat > (int)m_scoreTimeOffset.size()) return 0;
+    return m_scoreTimeOffset.at(repeat - 1);
+}
+
+double Measure::GetScoreTimeDuration() const
+{
+    return m_measureAligner.GetRightAlignment()->GetTime() * DURATION_4 / DUR_MAX;
+}
+
+double Measure::GetRealTimeDurationMilliseconds() const
+{
+    return this->GetScoreTimeDuration() * 60.0 / m_currentTempo * 1000.0 + 0.5;
+}
+
 data_BARRENDITION Measure::GetDrawingLeftBarLineByStaffN(int staffN) const
 {
     auto elementIter = m_invisibleStaffBarlines.find(staffN);
@@ -994,6 +994,73 @@ void GenerateTimemapFunctor::AddTimemapEntry(const Object *object)
     }
 }
 
+//----------------------------------------------------------------------------
+// GenerateTimeIndexFunctor
+//----------------------------------------------------------------------------
+
+GenerateTimeIndexFunctor::GenerateTimeIndexFunctor(TimeIndex *timeIndex) : ConstFunctor()
+{
+    m_currentMeasure = NULL;
+    m_order = 0;
+    m_timeIndex = timeIndex;
+}
+
+FunctorCode GenerateTimeIndexFunctor::VisitMeasure(const Measure *measure)
+{
+    m_currentMeasure = measure;
+
+    this->AddTimeIndexEntries(measure);
+
+    return FUNCTOR_CONTINUE;
+}
+
+FunctorCode GenerateTimeIndexFunctor::VisitNote(const Note *note)
+{
+    this->AddTimeIndexEntries(note);
+
+    return FUNCTOR_CONTINUE;
+}
+
+FunctorCode GenerateTimeIndexFunctor::VisitRest(const Rest *rest)
+{
+    this->AddTimeIndexEntries(rest);
+
+    return FUNCTOR_CONTINUE;
+}
+
+void GenerateTimeIndexFunctor::AddTimeIndexEntries(const Object *object)
+{
+    assert(object);
+
+    if (!m_currentMeasure) return;
+
+    TimeIndexEntry entry;
+    entry.object = object;
+    entry.measure = m_currentMeasure;
+    entry.order = m_order++;
+
+    const int repeatCount = m_currentMeasure->GetRepeatCount();
+    for (entry.repeat = 1; entry.repeat <= repeatCount; ++entry.repeat) {
+        const double realTimeOffset = m_currentMeasure->GetRealTimeOffsetMilliseconds(entry.repeat);
+        const double scoreTimeOffset = m_currentMeasure->GetScoreTimeOffset(entry.repeat);
+        if (object->Is(MEASURE)) {
+            entry.realTimeOnset = realTimeOffset;
+            entry.realTimeOffset = realTimeOffset + m_currentMeasure->GetRealTimeDurationMilliseconds();
+            entry.scoreTimeOnset = scoreTimeOffset;
+            entry.scoreTimeOffset = scoreTimeOffset + m_currentMeasure->GetScoreTimeDuration();
+        }
+        else {
+            const DurationInterface *interface = object->GetDurationInterface();
+            assert(interface);
+            entry.realTimeOnset = realTimeOffset + interface->GetRealTimeOnsetMilliseconds();
+            entry.realTimeOffset = realTimeOffset + interface->GetRealTimeOffsetMilliseconds();
+            entry.scoreTimeOnset = scoreTimeOffset + interface->GetScoreTimeOnset();
+            entry.scoreTimeOffset = scoreTimeOffset + interface->GetScoreTimeOffset();
+        }
+        m_timeIndex->AddEntry(entry);
+    }
+}
+
 //----------------------------------------------------------------------------
 // GenerateFeaturesFunctor
 //----------------------------------------------------------------------------
@@ -67,6 +67,10 @@ namespace vrv {
 
 thread_local unsigned long Object::s_objectCounter = 0;
 thread_local uint32_t Object::s_xmlIDCounter = 0;
+AttClassSet Object::s_classAttClasses[UNSPECIFIED];
+InterfaceSet Object::s_classInterfaces[UNSPECIFIED];
+
+AttClassSet Interface::s_interfaceAttClasses[INTERFACE_max];
 
 Object::Object() : BoundingBox()
 {
@@ -92,6 +96,16 @@ Object::Object(ClassId classId, const std::string &classIdStr) : BoundingBox()
     this->Init(classId, classIdStr);
 }
 
+void *Object::operator new(size_t size)
+{
+    return ObjectArena::AllocateObject(size);
+}
+
+void Object::operator delete(void *ptr)
+{
+    ObjectArena::FreeObject(ptr);
+}
+
 Object *Object::Clone() const
 {
     // This should never happen because the method should be overridden
@@ -111,10 +125,8 @@ Object::Object(const Object &object) : BoundingBox(object)
     m_isAttribute = object.m_isAttribute;
     m_isModified = true;
     m_isReferenceObject = object.m_isReferenceObject;
+    m_isIDIndexed = false;
 
-    // Also copy attribute classes
-    m_attClasses = object.m_attClasses;
-    m_interfaces = object.m_interfaces;
     // New id
     this->GenerateID();
     // For now do not copy them
@@ -147,6 +159,10 @@ Object &Object::operator=(const Object &object)
 {
     // not self assignement
     if (this != &object) {
+        // The id and the children change, so remove them from the index and add them back at the end
+        Doc *doc = this->GetIDIndexDoc();
+        if (doc) this->RemoveFromIDIndex(doc);
+
         ClearChildren();
         this->ResetBoundingBox(); // It does not make sense to keep the values of the BBox
 
@@ -158,9 +174,6 @@ Object &Object::operator=(const Object &object)
         m_isModified = true;
         m_isReferenceObject = object.m_isReferenceObject;
 
-        // Also copy attribute classes
-        m_attClasses = object.m_attClasses;
-        m_interfaces = object.m_interfaces;
         // New id
         this->GenerateID();
         // For now do now copy them
@@ -180,6 +193,8 @@ Object &Object::operator=(const Object &object)
                 }
             }
         }
+
+        if (doc) this->AddToIDIndex(doc);
     }
     return *this;
 }
@@ -187,6 +202,11 @@ Object &Object::operator=(const Object &object)
 Object::~Object()
 {
     ClearChildren();
+
+    if (m_isIDIndexed) {
+        Doc *doc = this->GetIDIndexDoc();
+        if (doc) doc->UnregisterID(this);
+    }
 }
 
 void Object::Init(ClassId classId, const std::string &classIdStr)
@@ -200,6 +220,7 @@ void Object::Init(ClassId classId, const std::string &classIdStr)
     m_isAttribute = false;
     m_isModified = true;
     m_isReferenceObject = false;
+    m_isIDIndexed = false;
     // Comments
     m_comment = "";
     m_closingComment = "";
@@ -243,10 +264,10 @@ void Object::Reset()
     this->ResetBoundingBox();
 }
 
-void Object::RegisterInterface(std::vector<AttClassId> *attClasses, InterfaceId interfaceId)
+void Object::RegisterInterface(const AttClassSet &attClasses, InterfaceId interfaceId)
 {
-    m_attClasses.insert(m_attClasses.end(), attClasses->begin(), attClasses->end());
-    m_interfaces.push_back(interfaceId);
+    s_classAttClasses[m_classId].Set(attClasses);
+    s_classInterfaces[m_classId].Set(interfaceId);
 }
 
 bool Object::IsMilestoneElement()
@@ -306,9 +327,11 @@ void Object::ReplaceChild(Object *currentChild, Object *replacingChild)
     assert(this->GetChildIndex(replacingChild) == -1);
 
     int idx = this->GetChildIndex(currentChild);
+    this->UnindexChild(currentChild);
     currentChild->ResetParent();
     m_children.at(idx) = replacingChild;
     replacingChild->SetParent(this);
+    this->IndexChild(replacingChild);
     this->Modify();
 }
 
@@ -525,10 +548,12 @@ void Object::InsertChild(Object *element, int idx)
 
     if (idx >= (int)m_children.size()) {
         m_children.push_back(element);
-        return;
     }
-    ArrayOfObjects::iterator iter = m_children.begin();
-    m_children.insert(iter + (idx), element);
+    else {
+        ArrayOfObjects::iterator iter = m_children.begin();
+        m_children.insert(iter + (idx), element);
+    }
+    this->IndexChild(element);
 }
 
 Object *Object::DetachChild(int idx)
@@ -537,12 +562,27 @@ Object *Object::DetachChild(int idx)
         return NULL;
     }
     Object *child = m_children.at(idx);
+    this->UnindexChild(child);
     child->ResetParent();
     ArrayOfObjects::iterator iter = m_children.begin();
     m_children.erase(iter + (idx));
     return child;
 }
 
+void Object::AddDescendantClasses(ClassIdSet &classIds) const
+{
+    for (const Object *child : m_children) {
+        classIds.set(child->GetClassId());
+        const DescendantClassesInterface *interface = child->GetDescendantClassesInterface();
+        if (interface) {
+            classIds |= interface->GetDescendantClasses();
+        }
+        else {
+            child->AddDescendantClasses(classIds);
+        }
+    }
+}
+
 bool Object::HasDescendant(const Object *child, int deepness) const
 {
     ArrayOfObjects::const_iterator iter;
@@ -565,6 +605,7 @@ Object *Object::Relinquish(int idx)
         return NULL;
     }
     Object *child = m_children.at(idx);
+    this->UnindexChild(child);
     child->ResetParent();
     return child;
 }
@@ -589,6 +630,24 @@ Object *Object::FindDescendantByID(const std::string &id, int deepness, bool dir
 
 const Object *Object::FindDescendantByID(const std::string &id, int deepness, bool direction) const
 {
+    // Use the id index of the document when available - it does not support a depth limit
+    if (deepness == UNLIMITED_DEPTH) {
+        const Doc *doc = this->GetIDIndexDoc();
+        if (doc) {
+            const Object *element = NULL;
+            auto range = doc->FindInIDIndex(id);
+            for (auto iter = range.first; iter != range.second; ++iter) {
+                const Object *candidate = iter->second;
+                if (!this->IsVisibleDescendant(candidate)) continue;
+                // With duplicated ids, return the first (or last) one in the traversal order
+                if (!element || (Object::IsPreOrdered(candidate, element) == (direction == FORWARD))) {
+                    element = candidate;
+                }
+            }
+            return element;
+        }
+    }
+
     FindByIDFunctor findByID(id);
     findByID.SetDirection(direction);
     this->Process(findByID, deepness, true);
@@ -774,9 +833,20 @@ void Object::GenerateID()
     m_id = m_classIdStr.at(0) + Object::GenerateHashID();
 }
 
+void Object::SetID(const std::string &id)
+{
+    Doc *doc = this->GetIDIndexDoc();
+    if (doc) doc->UnregisterID(this);
+    m_id = id;
+    if (doc) doc->RegisterID(this);
+}
+
 void Object::ResetID()
 {
+    Doc *doc = this->GetIDIndexDoc();
+    if (doc) doc->UnregisterID(this);
     GenerateID();
+    if (doc) doc->RegisterID(this);
 }
 
 void Object::SetParent(Object *parent)
@@ -820,6 +890,7 @@ void Object::AddChild(Object *child)
         i = std::min(i, (int)m_children.size());
         m_children.insert(m_children.begin() + i, child);
     }
+    this->IndexChild(child);
     Modify();
 }
 
@@ -894,6 +965,86 @@ void Object::Modify(bool modified) const
     m_isModified = modified;
 }
 
+void Object::AddToIDIndex(Doc *doc)
+{
+    assert(doc);
+
+    doc->RegisterID(this);
+    m_isIDIndexed = true;
+    for (Object *child : m_children) {
+        // Skip relinquished children and children of reference objects
+        if (child->GetParent() == this) child->AddToIDIndex(doc);
+    }
+}
+
+void Object::RemoveFromIDIndex(Doc *doc)
+{
+    assert(doc);
+
+    doc->UnregisterID(this);
+    m_isIDIndexed = false;
+    for (Object *child : m_children) {
+        if (child->GetParent() == this) child->RemoveFromIDIndex(doc);
+    }
+}
+
+void Object::IndexChild(Object *child)
+{
+    assert(child);
+
+    // Invalidate the descendant classes up to the first ancestor for which they are already invalid
+    for (const Object *object = this; object; object = object->m_parent) {
+        const DescendantClassesInterface *interface = object->GetDescendantClassesInterface();
+        if (interface && !interface->ResetDescendantClasses()) break;
+    }
+
+    Doc *doc = this->GetIDIndexDoc();
+    if (doc) child->AddToIDIndex(doc);
+}
+
+void Object::UnindexChild(Object *child)
+{
+    assert(child);
+
+    if (!child->m_isIDIndexed) return;
+    Doc *doc = child->GetIDIndexDoc();
+    if (doc) child->RemoveFromIDIndex(doc);
+}
+
+Doc *Object::GetIDIndexDoc()
+{
+    return const_cast<Doc *>(std::as_const(*this).GetIDIndexDoc());
+}
+
+const Doc *Object::GetIDIndexDoc() const
+{
+    if (!this->Is(DOC) && !m_isIDIndexed) return NULL;
+
+    const Object *current = this;
+    while (current->m_parent) {
+        current = current->m_parent;
+    }
+    if (!current->Is(DOC)) return NULL;
+
+    const Doc *doc = vrv_cast<const Doc *>(current);
+    assert(doc);
+    return (doc->IsIDIndexActive()) ? doc : NULL;
+}
+
+bool Object::IsVisibleDescendant(const Object *descendant) const
+{
+    assert(descendant);
+
+    if (descendant == this) return false;
+    const Object *ancestor = descendant->m_parent;
+    while (ancestor) {
+        if (ancestor->SkipChildren(true)) return false;
+        if (ancestor == this) return true;
+        ancestor = ancestor->m_parent;
+    }
+    return false;
+}
+
 void Object::FillFlatList(ListOfConstObjects &flatList) const
 {
     AddToFlatListFunctor addToFlatList(&flatList);
@@ -1038,7 +1189,7 @@ void Object::Process(Functor &functor, int deepness, bool skipFirst)
     }
     --deepness;
 
-    if (!this->SkipChildren(functor.VisibleOnly())) {
+    if (!this->SkipChildren(functor.VisibleOnly()) && !this->SkipDescendants(functor)) {
         // We need a pointer to the array for the option to work on a reversed copy
         ArrayOfObjects *children = &m_children;
         Filters *filters = functor.GetFilters();
@@ -1092,7 +1243,7 @@ void Object::Process(ConstFunctor &functor, int deepness, bool skipFirst) const
     }
     --deepness;
 
-    if (!this->SkipChildren(functor.VisibleOnly())) {
+    if (!this->SkipChildren(functor.VisibleOnly()) && !this->SkipDescendants(functor)) {
         // We need a pointer to the array for the option to work on a reversed copy
         const ArrayOfObjects *children = &m_children;
         Filters *filters = functor.GetFilters();
@@ -1168,6 +1319,13 @@ bool Object::SkipChildren(bool visibleOnly) const
     return false;
 }
 
+bool Object::SkipDescendants(const FunctorBase &functor) const
+{
+    const DescendantClassesInterface *interface = this->GetDescendantClassesInterface();
+    if (!interface) return false;
+    return !functor.VisitsAnyOf(interface->GetDescendantClasses());
+}
+
 bool Object::FiltersApply(const Filters *filters, Object *object) const
 {
     return filters ? filters->Apply(object) : true;
@@ -1217,6 +1375,15 @@ void Object::SeedID(uint32_t seed)
         // Deterministic start ID
         s_xmlIDCounter = Hash(seed);
     }
+    // Do not seed again randomly with the first object created in the thread
+    if (s_objectCounter == 0) s_objectCounter = 1;
+}
+
+void Object::SetIDCounter(uint32_t counter)
+{
+    s_xmlIDCounter = counter;
+    // Do not seed again randomly with the first object created in the thread
+    if (s_objectCounter == 0) s_objectCounter = 1;
 }
 
 std::string Object::GenerateHashID()
@@ -1500,6 +1667,52 @@ const Object *ObjectListInterface::GetInterfaceOwner() const
     return m_owner;
 }
 
+//----------------------------------------------------------------------------
+// DescendantClassesInterface
+//----------------------------------------------------------------------------
+
+DescendantClassesInterface::DescendantClassesInterface(const DescendantClassesInterface &interface)
+{
+    // actually nothing to do, we just don't want the set to be copied
+    m_hasDescendantClasses = false;
+}
+
+DescendantClassesInterface &DescendantClassesInterface::operator=(const DescendantClassesInterface &interface)
+{
+    // actually nothing to do, we just don't want the set to be copied
+    if (this != &interface) {
+        m_hasDescendantClasses = false;
+    }
+    return *this;
+}
+
+const ClassIdSet &DescendantClassesInterface::GetDescendantClasses() const
+{
+    if (m_hasDescendantClasses) return m_descendantClasses;
+
+    m_descendantClasses.reset();
+    this->GetInterfaceOwner()->AddDescendantClasses(m_descendantClasses);
+    m_hasDescendantClasses = true;
+
+    return m_descendantClasses;
+}
+
+bool DescendantClassesInterface::ResetDescendantClasses() const
+{
+    const bool wasValid = m_hasDescendantClasses;
+    m_hasDescendantClasses = false;
+    return wasValid;
+}
+
+const Object *DescendantClassesInterface::GetInterfaceOwner() const
+{
+    if (!m_owner) {
+        m_owner = dynamic_cast<const Object *>(this);
+        assert(m_owner);
+    }
+    return m_owner;
+}
+
 //----------------------------------------------------------------------------
 // TextListInterface
 //----------------------------------------------------------------------------
@@ -1553,6 +1766,178 @@ void TextListInterface::FilterList(ListOfConstObjects &childList) const
     }
 }
 
+//----------------------------------------------------------------------------
+// ObjectArena
+//----------------------------------------------------------------------------
+
+// Each object is preceded by a header with the arena owning it (NULL when allocated on the heap) and its size
+struct ObjectHeader {
+    ObjectArena *m_arena;
+    size_t m_size;
+};
+static const size_t OBJECT_HEADER_SIZE = 16;
+static_assert(sizeof(ObjectHeader) <= OBJECT_HEADER_SIZE, "The object header does not fit");
+// Objects are grouped by size classes in the free lists, larger ones are allocated on the heap
+static const size_t OBJECT_SIZE_CLASS = 16;
+static const size_t OBJECT_ARENA_MAX_SIZE = 4096;
+static const size_t OBJECT_ARENA_BLOCK_SIZE = 256 * 1024;
+
+thread_local ObjectArena *ObjectArena::s_current = NULL;
+std::atomic<long> ObjectArena::s_heapAllocations(0);
+
+ObjectArena::ObjectArena()
+{
+    m_blockIdx = 0;
+    m_blockCurrent = NULL;
+    m_blockEnd = NULL;
+    m_freeLists.resize(OBJECT_ARENA_MAX_SIZE / OBJECT_SIZE_CLASS + 1, NULL);
+    m_liveCount = 0;
+}
+
+ObjectArena::~ObjectArena()
+{
+    // If objects are still alive, the blocks are leaked rather than leaving dangling objects
+    this->Release();
+}
+
+bool ObjectArena::Release()
+{
+    if (m_liveCount != 0) return false;
+
+    for (char *block : m_blocks) {
+        ::operator delete(block);
+    }
+    if (!m_blocks.empty()) ++m_stats.m_releases;
+    m_blocks.clear();
+    m_blockIdx = 0;
+    m_blockCurrent = NULL;
+    m_blockEnd = NULL;
+    m_freeLists.assign(m_freeLists.size(), NULL);
+
+    return true;
+}
+
+bool ObjectArena::Recycle()
+{
+    if (m_liveCount != 0) return false;
+
+    if (!m_blocks.empty()) ++m_stats.m_recycles;
+    m_blockIdx = 0;
+    m_blockCurrent = (m_blocks.empty()) ? NULL : m_blocks.front();
+    m_blockEnd = (m_blocks.empty()) ? NULL : m_blocks.front() + OBJECT_ARENA_BLOCK_SIZE;
+    m_freeLists.assign(m_freeLists.size(), NULL);
+
+    return true;
+}
+
+void *ObjectArena::Allocate(size_t size)
+{
+    const size_t sizeClass = (size + OBJECT_SIZE_CLASS - 1) / OBJECT_SIZE_CLASS;
+    ++m_liveCount;
+    ++m_stats.m_allocations;
+
+    // Reuse the memory of a deleted object of the same size class
+    void *ptr = m_freeLists.at(sizeClass);
+    if (ptr) {
+        m_freeLists.at(sizeClass) = *static_cast<void **>(ptr);
+        ++m_stats.m_reuses;
+        return ptr;
+    }
+
+    const size_t allocSize = sizeClass * OBJECT_SIZE_CLASS;
+    if ((size_t)(m_blockEnd - m_blockCurrent) < allocSize) {
+        // Move to the next block kept when recycling, or allocate a new one
+        if (m_blockCurrent && (m_blockIdx + 1 < m_blocks.size())) {
+            ++m_blockIdx;
+        }
+        else {
+            m_blocks.push_back(static_cast<char *>(::operator new(OBJECT_ARENA_BLOCK_SIZE)));
+            m_blockIdx = m_blocks.size() - 1;
+            ++m_stats.m_blocks;
+            m_stats.m_blockBytes += OBJECT_ARENA_BLOCK_SIZE;
+        }
+        m_blockCurrent = m_blocks.at(m_blockIdx);
+        m_blockEnd = m_blockCurrent + OBJECT_ARENA_BLOCK_SIZE;
+    }
+    ptr = m_blockCurrent;
+    m_blockCurrent += allocSize;
+    return ptr;
+}
+
+void ObjectArena::Deallocate(void *ptr, size_t size)
+{
+    const size_t sizeClass = (size + OBJECT_SIZE_CLASS - 1) / OBJECT_SIZE_CLASS;
+    assert(m_liveCount > 0);
+    --m_liveCount;
+    ++m_stats.m_deallocations;
+
+    *static_cast<void **>(ptr) = m_freeLists.at(sizeClass);
+    m_freeLists.at(sizeClass) = ptr;
+}
+
+void *ObjectArena::AllocateObject(size_t size)
+{
+    const size_t allocSize = size + OBJECT_HEADER_SIZE;
+    ObjectArena *arena = s_current;
+    char *ptr = NULL;
+    if (arena && (allocSize <= OBJECT_ARENA_MAX_SIZE)) {
+        ptr = static_cast<char *>(arena->Allocate(allocSize));
+    }
+    else {
+        ptr = static_cast<char *>(::operator new(allocSize));
+        arena = NULL;
+        s_heapAllocations.fetch_add(1, std::memory_order_relaxed);
+    }
+    ObjectHeader *header = reinterpret_cast<ObjectHeader *>(ptr);
+    header->m_arena = arena;
+    header->m_size = allocSize;
+    return ptr + OBJECT_HEADER_SIZE;
+}
+
+void ObjectArena::FreeObject(void *ptr)
+{
+    if (!ptr) return;
+
+    char *allocPtr = static_cast<char *>(ptr) - OBJECT_HEADER_SIZE;
+    ObjectHeader *header = reinterpret_cast<ObjectHeader *>(allocPtr);
+    if (header->m_arena) {
+        header->m_arena->Deallocate(allocPtr, header->m_size);
+    }
+    else {
+        ::operator delete(allocPtr);
+    }
+}
+
+//----------------------------------------------------------------------------
+// ObjectArenaScope
+//----------------------------------------------------------------------------
+
+ObjectArenaScope::ObjectArenaScope(ObjectArena *arena)
+{
+    m_previous = ObjectArena::s_current;
+    ObjectArena::s_current = arena;
+}
+
+ObjectArenaScope::~ObjectArenaScope()
+{
+    ObjectArena::s_current = m_previous;
+}
+
+//----------------------------------------------------------------------------
+// IDCounterScope
+//----------------------------------------------------------------------------
+
+IDCounterScope::IDCounterScope(uint32_t counter)
+{
+    m_previous = Object::GetIDCounter();
+    Object::SetIDCounter(counter);
+}
+
+IDCounterScope::~IDCounterScope()
+{
+    Object::SetIDCounter(m_previous);
+}
+
 //----------------------------------------------------------------------------
 // ObjectFactory methods
 //----------------------------------------------------------------------------
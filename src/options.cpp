@@ -1047,6 +1047,11 @@ Options::Options()
     m_landscape.Init(false);
     this->Register(&m_landscape, "landscape", &m_general);
 
+    m_meiStreaming.SetInfo("MEI streaming import",
+        "Load the MEI measures one by one instead of loading the whole XML tree in memory");
+    m_meiStreaming.Init(false);
+    this->Register(&m_meiStreaming, "meiStreaming", &m_general);
+
     m_minLastJustification.SetInfo("Minimum last-system-justification width",
         "The last system is only justified if the unjustified width is greater than this percent");
     m_minLastJustification.Init(0.8, 0.0, 1.0);
@@ -1123,6 +1128,13 @@ Options::Options()
     m_preserveAnalyticalMarkup.Init(false);
     this->Register(&m_preserveAnalyticalMarkup, "preserveAnalyticalMarkup", &m_general);
 
+    m_recycleMemory.SetInfo("Recycle memory",
+        "Keep the arena blocks of the objects when the document is reset and reuse them for the next data loaded, "
+        "and keep the SVG device context between the pages rendered. Only the objects themselves are recycled, the "
+        "memory of their content (attribute values, strings and lists) is allocated again for each load");
+    m_recycleMemory.Init(false);
+    this->Register(&m_recycleMemory, "recycleMemory", &m_general);
+
     m_removeIds.SetInfo("Remove IDs in MEI", "Remove XML IDs in the MEI output that are not referenced");
     m_removeIds.Init(false);
     this->Register(&m_removeIds, "removeIds", &m_general);
@@ -1171,6 +1183,11 @@ Options::Options()
     m_svgFormatRaw.Init(false);
     this->Register(&m_svgFormatRaw, "svgFormatRaw", &m_general);
 
+    m_svgStreaming.SetInfo("SVG streaming output",
+        "Write the SVG directly as a stream instead of building the whole XML tree in memory");
+    m_svgStreaming.Init(false);
+    this->Register(&m_svgStreaming, "svgStreaming", &m_general);
+
     m_svgRemoveXlink.SetInfo("Remove xlink: from href attributes",
         "Removes the xlink: prefix on href attributes for compatibility with some newer browsers");
     m_svgRemoveXlink.Init(false);
@@ -1182,6 +1199,11 @@ Options::Options()
     m_svgAdditionalAttribute.Init();
     this->Register(&m_svgAdditionalAttribute, "svgAdditionalAttribute", &m_general);
 
+    m_threads.SetInfo(
+        "Threads", "The number of threads for laying out and rendering pages (0 for the number of cores)");
+    m_threads.Init(1, 0, 256);
+    this->Register(&m_threads, "threads", &m_general);
+
     m_unit.SetInfo("Unit", "The MEI unit (1⁄2 of the distance between the staff lines)");
     m_unit.Init(9.0, 4.5, 12.0, true);
     this->Register(&m_unit, "unit", &m_general);
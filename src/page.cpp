@@ -9,7 +9,9 @@
 
 //----------------------------------------------------------------------------
 
+#include <atomic>
 #include <cassert>
+#include <mutex>
 
 //----------------------------------------------------------------------------
 
@@ -52,6 +54,7 @@
 #include "functor.h"
 #include "justifyfunctor.h"
 #include "libmei.h"
+#include "linkinginterface.h"
 #include "miscfunctor.h"
 #include "pageelement.h"
 #include "pages.h"
@@ -61,6 +64,8 @@
 #include "score.h"
 #include "staff.h"
 #include "system.h"
+#include "systemmilestone.h"
+#include "timeinterface.h"
 #include "view.h"
 #include "vrv.h"
 
@@ -277,7 +282,7 @@ void Page::LayOutTranscription(bool force)
     m_layoutDone = true;
 }
 
-void Page::ResetAligners()
+void Page::ResetAligners(Filters *filters)
 {
     Doc *doc = vrv_cast<Doc *>(this->GetFirstAncestor(DOC));
     assert(doc);
@@ -288,22 +293,26 @@ void Page::ResetAligners()
 
     // Reset the horizontal alignment
     ResetHorizontalAlignmentFunctor resetHorizontalAlignment;
+    resetHorizontalAlignment.SetFilters(filters);
     this->Process(resetHorizontalAlignment);
 
     // Reset the vertical alignment
     ResetVerticalAlignmentFunctor resetVerticalAlignment;
+    resetVerticalAlignment.SetFilters(filters);
     this->Process(resetVerticalAlignment);
 
     // Align the content of the page using measure aligners
     // After this:
     // - each LayerElement object will have its Alignment pointer initialized
     AlignHorizontallyFunctor alignHorizontally(doc);
+    alignHorizontally.SetFilters(filters);
     this->Process(alignHorizontally);
 
     // Align the content of the page using system aligners
     // After this:
     // - each Staff object will then have its StaffAlignment pointer initialized
     AlignVerticallyFunctor alignVertically(doc);
+    alignVertically.SetFilters(filters);
     this->Process(alignVertically);
 
     // Unless duration-based spacing is disabled, set the X position of each Alignment.
@@ -326,39 +335,48 @@ void Page::ResetAligners()
 
         CalcAlignmentXPosFunctor calcAlignmentXPos(doc);
         calcAlignmentXPos.SetLongestActualDur(longestActualDur);
+        calcAlignmentXPos.SetFilters(filters);
         this->Process(calcAlignmentXPos);
     }
 
     // Set the pitch / pos alignment
     CalcAlignmentPitchPosFunctor calcAlignmentPitchPos(doc);
+    calcAlignmentPitchPos.SetFilters(filters);
     this->Process(calcAlignmentPitchPos);
 
     if (IsMensuralType(doc->m_notationType)) {
         CalcLigatureNotePosFunctor calcLigatureNotePos(doc);
+        calcLigatureNotePos.SetFilters(filters);
         this->Process(calcLigatureNotePos);
     }
 
     CalcStemFunctor calcStem(doc);
+    calcStem.SetFilters(filters);
     this->Process(calcStem);
 
     CalcChordNoteHeadsFunctor calcChordNoteHeads(doc);
+    calcChordNoteHeads.SetFilters(filters);
     this->Process(calcChordNoteHeads);
 
     CalcDotsFunctor calcDots(doc);
+    calcDots.SetFilters(filters);
     this->Process(calcDots);
 
     // Adjust the position of outside articulations
     CalcArticFunctor calcArtic(doc);
+    calcArtic.SetFilters(filters);
     this->Process(calcArtic);
 
     CalcSlurDirectionFunctor calcSlurDirection(doc);
+    calcSlurDirection.SetFilters(filters);
     this->Process(calcSlurDirection);
 
     CalcSpanningBeamSpansFunctor calcSpanningBeamSpans(doc);
+    calcSpanningBeamSpans.SetFilters(filters);
     this->Process(calcSpanningBeamSpans);
 }
 
-void Page::LayOutHorizontally()
+void Page::LayOutHorizontally(Filters *filters)
 {
     Doc *doc = vrv_cast<Doc *>(this->GetFirstAncestor(DOC));
     assert(doc);
@@ -367,12 +385,13 @@ void Page::LayOutHorizontally()
     // Make sure we have the correct page
     assert(this == doc->GetDrawingPage());
 
-    this->ResetAligners();
+    this->ResetAligners(filters);
 
     // Render it for filling the bounding box
     View view;
     view.SetDoc(doc);
     view.SetSlurHandling(SlurHandling::Ignore);
+    view.SetMeasureFilters(filters);
     BBoxDeviceContext bBoxDC(&view, 0, 0, BBOX_HORIZONTAL_ONLY);
     // Do not do the layout in this view - otherwise we will loop...
     view.SetPage(this->GetIdx(), false);
@@ -383,32 +402,38 @@ void Page::LayOutHorizontally()
 
     // Adjust the position of outside articulations
     AdjustArticFunctor adjustArtic(doc);
+    adjustArtic.SetFilters(filters);
     this->Process(adjustArtic);
 
     // Adjust the x position of the LayerElement where multiple layers collide
     // Look at each LayerElement and change the m_xShift if the bounding box is overlapping
     // For the first iteration align elements without taking dots into consideration
     AdjustLayersFunctor adjustLayers(doc, scoreDef->GetStaffNs());
+    adjustLayers.SetFilters(filters);
     this->Process(adjustLayers);
 
     // Adjust dots for the multiple layers. Try to align dots that can be grouped together when layers collide,
     // otherwise keep their relative positioning
     AdjustDotsFunctor adjustDots(doc, scoreDef->GetStaffNs());
+    adjustDots.SetFilters(filters);
     this->Process(adjustDots);
 
     // Adjust layers again, this time including dots positioning
     AdjustLayersFunctor adjustLayersWithDots(doc, scoreDef->GetStaffNs());
     adjustLayersWithDots.IgnoreDots(false);
+    adjustLayersWithDots.SetFilters(filters);
     this->Process(adjustLayersWithDots);
 
     // Adjust the X position of the accidentals, including in chords
     AdjustAccidXFunctor adjustAccidX(doc);
+    adjustAccidX.SetFilters(filters);
     this->Process(adjustAccidX);
 
     // Adjust the X shift of the Alignment looking at the bounding boxes
     // Look at each LayerElement and change the m_xShift if the bounding box is overlapping
     AdjustXPosFunctor adjustXPos(doc, scoreDef->GetStaffNs());
     adjustXPos.SetExcluded({ TABDURSYM });
+    adjustXPos.SetFilters(filters);
     this->Process(adjustXPos);
 
     // Adjust tabRhythm separately
@@ -420,51 +445,62 @@ void Page::LayOutHorizontally()
     // Adjust the X shift of the Alignment looking at the bounding boxes
     // Look at each LayerElement and change the m_xShift if the bounding box is overlapping
     AdjustGraceXPosFunctor adjustGraceXPos(doc, scoreDef->GetStaffNs());
+    adjustGraceXPos.SetFilters(filters);
     this->Process(adjustGraceXPos);
 
     // Adjust the spacing of clef changes since they are skipped in AdjustXPos
     // Look at each clef change and  move them to the left and add space if necessary
     AdjustClefChangesFunctor adjustClefChanges(doc);
+    adjustClefChanges.SetFilters(filters);
     this->Process(adjustClefChanges);
 
     // We need to populate processing lists for processing the document by Layer (for matching @tie) and
     // by Verse (for matching syllable connectors)
     InitProcessingListsFunctor initProcessingLists;
+    initProcessingLists.SetFilters(filters);
     this->Process(initProcessingLists);
 
-    this->AdjustSylSpacingByVerse(initProcessingLists.GetVerseTree(), doc);
+    this->AdjustSylSpacingByVerse(initProcessingLists.GetVerseTree(), doc, filters);
 
     AdjustHarmGrpsSpacingFunctor adjustHarmGrpsSpacing(doc);
+    adjustHarmGrpsSpacing.SetFilters(filters);
     this->Process(adjustHarmGrpsSpacing);
 
     // Adjust the arpeg
     AdjustArpegFunctor adjustArpeg(doc);
+    adjustArpeg.SetFilters(filters);
     this->Process(adjustArpeg);
 
     // Adjust the tempo
     AdjustTempoFunctor adjustTempo(doc);
+    adjustTempo.SetFilters(filters);
     this->Process(adjustTempo);
 
     // Adjust the position of the tuplets
     AdjustTupletsXFunctor adjustTupletsX(doc);
+    adjustTupletsX.SetFilters(filters);
     this->Process(adjustTupletsX);
 
     // Prevent a margin overflow
     AdjustXOverflowFunctor adjustXOverflow(doc->GetDrawingUnit(100));
+    adjustXOverflow.SetFilters(filters);
     this->Process(adjustXOverflow);
 
     // Adjust measure X position
+    // All the measures are positioned, the ones filtered out above with their cached width
     AlignMeasuresFunctor alignMeasures(doc);
+    alignMeasures.UseCachedWidths(filters != NULL);
     this->Process(alignMeasures);
 }
 
-void Page::LayOutHorizontallyWithCache(bool restore)
+void Page::LayOutHorizontallyWithCache(bool restore, Filters *filters)
 {
     Doc *doc = vrv_cast<Doc *>(this->GetFirstAncestor(DOC));
     assert(doc);
 
     CacheHorizontalLayoutFunctor cacheHorizontalLayout(doc);
     cacheHorizontalLayout.SetRestore(restore);
+    cacheHorizontalLayout.SetFilters(filters);
     this->Process(cacheHorizontalLayout);
 }
 
@@ -496,63 +532,70 @@ void Page::LayOutVertically()
     view.SetDoc(doc);
     // Do not do the layout in this view - otherwise we will loop...
     view.SetPage(this->GetIdx(), false);
-    view.DrawCurrentPage(&bBoxDC, false);
 
-    // Adjust the position of outside articulations with slurs end and start positions
-    AdjustArticWithSlursFunctor adjustArticWithSlurs(doc);
-    this->Process(adjustArticWithSlurs);
+    // With several threads, the systems are laid out concurrently until they are aligned on the page
+    if (GetThreadCount(doc->GetOptions()->m_threads.GetValue()) > 1) {
+        this->LayOutSystemsVerticallyConcurrently(doc, view, bBoxDC);
+    }
+    else {
+        view.DrawCurrentPage(&bBoxDC, false);
 
-    // Adjust the position of the beams in regards of layer elements
-    AdjustBeamsFunctor adjustBeams(doc);
-    this->Process(adjustBeams);
+        // Adjust the position of outside articulations with slurs end and start positions
+        AdjustArticWithSlursFunctor adjustArticWithSlurs(doc);
+        this->Process(adjustArticWithSlurs);
 
-    // Adjust the position of the tuplets
-    AdjustTupletsYFunctor adjustTupletsY(doc);
-    this->Process(adjustTupletsY);
+        // Adjust the position of the beams in regards of layer elements
+        AdjustBeamsFunctor adjustBeams(doc);
+        this->Process(adjustBeams);
 
-    // Adjust the position of the slurs
-    AdjustSlursFunctor adjustSlurs(doc);
-    this->Process(adjustSlurs);
+        // Adjust the position of the tuplets
+        AdjustTupletsYFunctor adjustTupletsY(doc);
+        this->Process(adjustTupletsY);
 
-    // At this point slurs must not be reinitialized, otherwise the adjustment we just did was in vain
-    view.SetSlurHandling(SlurHandling::Drawing);
-    view.SetPage(this->GetIdx(), false);
-    view.DrawCurrentPage(&bBoxDC, false);
+        // Adjust the position of the slurs
+        AdjustSlursFunctor adjustSlurs(doc);
+        this->Process(adjustSlurs);
 
-    // Adjust the position of tuplets by slurs
-    AdjustTupletWithSlursFunctor adjustTupletWithSlurs(doc);
-    this->Process(adjustTupletWithSlurs);
+        // At this point slurs must not be reinitialized, otherwise the adjustment we just did was in vain
+        view.SetSlurHandling(SlurHandling::Drawing);
+        view.SetPage(this->GetIdx(), false);
+        view.DrawCurrentPage(&bBoxDC, false);
 
-    // Fill the arrays of bounding boxes (above and below) for each staff alignment for which the box overflows.
-    CalcBBoxOverflowsFunctor calcBBoxOverflows(doc);
-    this->Process(calcBBoxOverflows);
+        // Adjust the position of tuplets by slurs
+        AdjustTupletWithSlursFunctor adjustTupletWithSlurs(doc);
+        this->Process(adjustTupletWithSlurs);
 
-    // Adjust the positioners of floating elements (slurs, hairpin, dynam, etc)
-    AdjustFloatingPositionersFunctor adjustFloatingPositioners(doc);
-    this->Process(adjustFloatingPositioners);
+        // Fill the arrays of bounding boxes (above and below) for each staff alignment for which the box overflows.
+        CalcBBoxOverflowsFunctor calcBBoxOverflows(doc);
+        this->Process(calcBBoxOverflows);
 
-    // Adjust the overlap of the staff alignments by looking at the overflow bounding boxes
-    AdjustStaffOverlapFunctor adjustStaffOverlap(doc);
-    this->Process(adjustStaffOverlap);
+        // Adjust the positioners of floating elements (slurs, hairpin, dynam, etc)
+        AdjustFloatingPositionersFunctor adjustFloatingPositioners(doc);
+        this->Process(adjustFloatingPositioners);
 
-    // Set the Y position of each StaffAlignment
-    // Adjust the Y shift to make sure there is a minimal space (staffMargin) between each staff
-    AdjustYPosFunctor adjustYPos(doc);
-    this->Process(adjustYPos);
+        // Adjust the overlap of the staff alignments by looking at the overflow bounding boxes
+        AdjustStaffOverlapFunctor adjustStaffOverlap(doc);
+        this->Process(adjustStaffOverlap);
 
-    // Adjust the positioners of floating elements placed between staves
-    AdjustFloatingPositionersBetweenFunctor adjustFloatingPositionersBetween(doc);
-    this->Process(adjustFloatingPositionersBetween);
+        // Set the Y position of each StaffAlignment
+        // Adjust the Y shift to make sure there is a minimal space (staffMargin) between each staff
+        AdjustYPosFunctor adjustYPos(doc);
+        this->Process(adjustYPos);
 
-    AdjustCrossStaffYPosFunctor adjustCrossStaffYPos(doc);
-    this->Process(adjustCrossStaffYPos);
+        // Adjust the positioners of floating elements placed between staves
+        AdjustFloatingPositionersBetweenFunctor adjustFloatingPositionersBetween(doc);
+        this->Process(adjustFloatingPositionersBetween);
 
-    // Redraw are re-adjust the position of the slurs when we have cross-staff ones
-    if (adjustSlurs.HasCrossStaffSlurs()) {
-        view.SetSlurHandling(SlurHandling::Initialize);
-        view.SetPage(this->GetIdx(), false);
-        view.DrawCurrentPage(&bBoxDC, false);
-        this->Process(adjustSlurs);
+        AdjustCrossStaffYPosFunctor adjustCrossStaffYPos(doc);
+        this->Process(adjustCrossStaffYPos);
+
+        // Redraw are re-adjust the position of the slurs when we have cross-staff ones
+        if (adjustSlurs.HasCrossStaffSlurs()) {
+            view.SetSlurHandling(SlurHandling::Initialize);
+            view.SetPage(this->GetIdx(), false);
+            view.DrawCurrentPage(&bBoxDC, false);
+            this->Process(adjustSlurs);
+        }
     }
 
     if (this->GetHeader()) {
@@ -570,6 +613,198 @@ void Page::LayOutVertically()
     this->Process(alignSystems);
 }
 
+void Page::LayOutSystemsVerticallyConcurrently(Doc *doc, View &view, BBoxDeviceContext &bBoxDC)
+{
+    // Render the running elements for filling their bounding box
+    view.DrawCurrentPageRunningElements(&bBoxDC);
+
+    // Until they are aligned on the page, the systems are laid out independently from each other
+    std::atomic<bool> hasCrossStaffSlurs = false;
+    auto layOutSystem = [doc, &hasCrossStaffSlurs](System *system, View &view, BBoxDeviceContext &bBoxDC) {
+        // Render it for filling the bounding box
+        view.SetSlurHandling(SlurHandling::Initialize);
+        view.DrawCurrentPageSystem(&bBoxDC, system);
+
+        // Adjust the position of outside articulations with slurs end and start positions
+        AdjustArticWithSlursFunctor adjustArticWithSlurs(doc);
+        system->Process(adjustArticWithSlurs);
+
+        // Adjust the position of the beams in regards of layer elements
+        AdjustBeamsFunctor adjustBeams(doc);
+        system->Process(adjustBeams);
+
+        // Adjust the position of the tuplets
+        AdjustTupletsYFunctor adjustTupletsY(doc);
+        system->Process(adjustTupletsY);
+
+        // Adjust the position of the slurs
+        AdjustSlursFunctor adjustSlurs(doc);
+        system->Process(adjustSlurs);
+        if (adjustSlurs.HasCrossStaffSlurs()) hasCrossStaffSlurs = true;
+
+        // At this point slurs must not be reinitialized, otherwise the adjustment we just did was in vain
+        view.SetSlurHandling(SlurHandling::Drawing);
+        view.DrawCurrentPageSystem(&bBoxDC, system);
+
+        // Adjust the position of tuplets by slurs
+        AdjustTupletWithSlursFunctor adjustTupletWithSlurs(doc);
+        system->Process(adjustTupletWithSlurs);
+
+        // Fill the arrays of bounding boxes (above and below) for each staff alignment for which the box overflows.
+        CalcBBoxOverflowsFunctor calcBBoxOverflows(doc);
+        system->Process(calcBBoxOverflows);
+
+        // Adjust the positioners of floating elements (slurs, hairpin, dynam, etc)
+        AdjustFloatingPositionersFunctor adjustFloatingPositioners(doc);
+        system->Process(adjustFloatingPositioners);
+
+        // Adjust the overlap of the staff alignments by looking at the overflow bounding boxes
+        AdjustStaffOverlapFunctor adjustStaffOverlap(doc);
+        system->Process(adjustStaffOverlap);
+
+        // Set the Y position of each StaffAlignment
+        // Adjust the Y shift to make sure there is a minimal space (staffMargin) between each staff
+        AdjustYPosFunctor adjustYPos(doc);
+        system->Process(adjustYPos);
+
+        // Adjust the positioners of floating elements placed between staves
+        AdjustFloatingPositionersBetweenFunctor adjustFloatingPositionersBetween(doc);
+        system->Process(adjustFloatingPositionersBetween);
+
+        AdjustCrossStaffYPosFunctor adjustCrossStaffYPos(doc);
+        system->Process(adjustCrossStaffYPos);
+    };
+    this->ProcessSystemsConcurrently(doc, layOutSystem);
+
+    // Redraw are re-adjust the position of the slurs when we have cross-staff ones
+    if (hasCrossStaffSlurs) {
+        auto adjustSystemSlurs = [doc](System *system, View &view, BBoxDeviceContext &bBoxDC) {
+            view.SetSlurHandling(SlurHandling::Initialize);
+            view.DrawCurrentPageSystem(&bBoxDC, system);
+            AdjustSlursFunctor adjustSlurs(doc);
+            system->Process(adjustSlurs);
+        };
+        this->ProcessSystemsConcurrently(doc, adjustSystemSlurs);
+    }
+}
+
+void Page::ProcessSystemsConcurrently(Doc *doc, const SystemLayOutFunction &layOutSystem)
+{
+    const std::vector<std::vector<System *>> systemGroups = this->GetDependentSystemGroups(doc);
+    const int groupCount = (int)systemGroups.size();
+
+    // Each group is drawn with its own view and bounding box device context using the page context
+    // - The objects of a group, with their bounding boxes and positioners, are written only by the thread of the group,
+    //   since the spanning elements and the endings are in the group of all the systems they span over
+    // - The running elements are drawn by the calling thread beforehand
+    // - The Doc itself is only read: the drawing page is not changed since the views have their own page context, and
+    //   the drawing fonts returned by the Doc are per thread
+    // - The temporary objects created when drawing have their ids from the page context (see IDCounterScope)
+    const DrawingPageContext context = doc->GetDrawingPageContext();
+    std::mutex sharedElementMutex;
+    std::vector<std::vector<std::string>> groupLogs(groupCount);
+
+    auto layOutGroup = [&](int groupIdx) {
+        // The view creates objects too
+        IDCounterScope idCounterScope(context.m_idCounter);
+        View view;
+        view.SetDoc(doc);
+        view.SetPageContext(context, &sharedElementMutex);
+        BBoxDeviceContext bBoxDC(&view, 0, 0);
+        // The resources hold the current text style - each group is drawn with its own copy
+        const Resources resources = doc->GetResources();
+        bBoxDC.SetResources(&resources);
+        // The log buffer is per thread - collect what the group adds to it
+        const std::vector<std::string> previousLog = logBuffer;
+        LogBufferClear();
+        for (System *system : systemGroups.at(groupIdx)) {
+            layOutSystem(system, view, bBoxDC);
+        }
+        groupLogs.at(groupIdx) = logBuffer;
+        LogBufferClear();
+        LogBufferAppend(previousLog);
+    };
+
+    RunConcurrently(groupCount, doc->GetOptions()->m_threads.GetValue(), layOutGroup);
+
+    for (const std::vector<std::string> &messages : groupLogs) {
+        LogBufferAppend(messages);
+    }
+}
+
+std::vector<std::vector<System *>> Page::GetDependentSystemGroups(const Doc *doc)
+{
+    std::vector<System *> systems;
+    for (Object *child : this->GetChildren()) {
+        if (child->Is(SYSTEM)) systems.push_back(vrv_cast<System *>(child));
+    }
+
+    auto getSystemIdx = [&systems](const Object *object) {
+        const Object *system = (object) ? object->GetFirstAncestor(SYSTEM) : NULL;
+        const auto it = std::find(systems.begin(), systems.end(), system);
+        return (it == systems.end()) ? VRV_UNSET : (int)(it - systems.begin());
+    };
+
+    // For each system, whether it depends on the previous one
+    std::vector<bool> dependsOnPrevious(systems.size(), false);
+    auto addDependency = [&dependsOnPrevious, &getSystemIdx](int idx, const std::vector<const Object *> &objects) {
+        int firstIdx = idx;
+        int lastIdx = idx;
+        for (const Object *object : objects) {
+            const int objectIdx = getSystemIdx(object);
+            if (objectIdx == VRV_UNSET) continue;
+            firstIdx = std::min(firstIdx, objectIdx);
+            lastIdx = std::max(lastIdx, objectIdx);
+        }
+        for (int i = firstIdx + 1; i <= lastIdx; ++i) {
+            dependsOnPrevious.at(i) = true;
+        }
+    };
+
+    const int systemDivider = doc->GetOptions()->m_systemDivider.GetValue();
+    for (int i = 0; i < (int)systems.size(); ++i) {
+        System *system = systems.at(i);
+
+        // The system divider is placed according to the bottom staff of the previous system
+        if ((i > 0) && (systemDivider != SYSTEMDIVIDER_none) && !system->IsFirstOfMdiv()) {
+            if (system->IsDrawingOptimized() || (systemDivider > SYSTEMDIVIDER_auto)) dependsOnPrevious.at(i) = true;
+        }
+
+        // Spanning elements are drawn and adjusted in each system they span over
+        ListOfObjects spanningElements;
+        InterfaceComparison timeSpanningComparison(INTERFACE_TIME_SPANNING);
+        system->FindAllDescendantsByComparison(&spanningElements, &timeSpanningComparison);
+        for (Object *object : spanningElements) {
+            TimeSpanningInterface *interface = object->GetTimeSpanningInterface();
+            assert(interface);
+            std::vector<const Object *> objects = { interface->GetStart(), interface->GetEnd() };
+            if (object->HasInterface(INTERFACE_LINKING) && object->GetLinkingInterface()->GetNextLink()) {
+                objects.push_back(object->GetLinkingInterface()->GetNextLink());
+            }
+            addDependency(i, objects);
+        }
+
+        // Same for the endings
+        ListOfObjects milestoneEnds;
+        ClassIdComparison milestoneEndComparison(SYSTEM_MILESTONE_END);
+        system->FindAllDescendantsByComparison(&milestoneEnds, &milestoneEndComparison, 1);
+        for (Object *object : milestoneEnds) {
+            SystemMilestoneEnd *milestoneEnd = vrv_cast<SystemMilestoneEnd *>(object);
+            assert(milestoneEnd);
+            if (milestoneEnd->GetStart() && milestoneEnd->GetStart()->Is(ENDING)) {
+                addDependency(i, { milestoneEnd->GetStart() });
+            }
+        }
+    }
+
+    std::vector<std::vector<System *>> systemGroups;
+    for (int i = 0; i < (int)systems.size(); ++i) {
+        if (!dependsOnPrevious.at(i) || systemGroups.empty()) systemGroups.push_back({});
+        systemGroups.back().push_back(systems.at(i));
+    }
+    return systemGroups;
+}
+
 void Page::JustifyHorizontally()
 {
     Doc *doc = vrv_cast<Doc *>(this->GetFirstAncestor(DOC));
@@ -737,7 +972,7 @@ int Page::GetContentWidth() const
     return maxWidth;
 }
 
-void Page::AdjustSylSpacingByVerse(const IntTree &verseTree, Doc *doc)
+void Page::AdjustSylSpacingByVerse(const IntTree &verseTree, Doc *doc, Filters *filters)
 {
     IntTree_t::const_iterator staves;
     IntTree_t::const_iterator layers;
@@ -745,7 +980,7 @@ void Page::AdjustSylSpacingByVerse(const IntTree &verseTree, Doc *doc)
 
     if (verseTree.child.empty()) return;
 
-    Filters filters;
+    Filters verseFilters;
 
     // Same for the lyrics, but Verse by Verse since Syl are TimeSpanningInterface elements for handling connectors
     for (staves = verseTree.child.begin(); staves != verseTree.child.end(); ++staves) {
@@ -755,10 +990,12 @@ void Page::AdjustSylSpacingByVerse(const IntTree &verseTree, Doc *doc)
                 AttNIntegerComparison matchStaff(STAFF, staves->first);
                 AttNIntegerComparison matchLayer(LAYER, layers->first);
                 AttNIntegerComparison matchVerse(VERSE, verses->first);
-                filters = { &matchStaff, &matchLayer, &matchVerse };
+                verseFilters = { &matchStaff, &matchLayer, &matchVerse };
+                // Also apply the filters for the measures to lay out
+                if (filters) verseFilters.Append(*filters);
 
                 AdjustSylSpacingFunctor adjustSylSpacing(doc);
-                adjustSylSpacing.SetFilters(&filters);
+                adjustSylSpacing.SetFilters(&verseFilters);
                 this->Process(adjustSylSpacing);
             }
         }
@@ -876,7 +876,10 @@ FunctorCode PrepareTimestampsFunctor::VisitMeasureEnd(Measure *measure)
 // PreparePedalsFunctor
 //----------------------------------------------------------------------------
 
-PreparePedalsFunctor::PreparePedalsFunctor(Doc *doc) : DocFunctor(doc) {}
+PreparePedalsFunctor::PreparePedalsFunctor(Doc *doc) : DocFunctor(doc)
+{
+    this->SetVisitedClasses({ MEASURE, PEDAL });
+}
 
 FunctorCode PreparePedalsFunctor::VisitMeasureEnd(Measure *measure)
 {
@@ -9,8 +9,22 @@
 
 //----------------------------------------------------------------------------
 
+#include <algorithm>
+#include <cassert>
+#include <cstdint>
+#include <cstring>
+#include <fstream>
+#include <sstream>
 #include <string>
 
+#ifndef _WIN32
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <sys/types.h>
+#include <unistd.h>
+#endif
+
 //----------------------------------------------------------------------------
 
 #include "smufl.h"
@@ -30,6 +44,9 @@ namespace vrv {
 thread_local std::string Resources::s_defaultPath = VRV_RESOURCE_DIR;
 const Resources::StyleAttributes Resources::k_defaultStyle{ data_FONTWEIGHT::FONTWEIGHT_normal,
     data_FONTSTYLE::FONTSTYLE_normal };
+std::map<std::string, std::unique_ptr<pugi::xml_document>> Resources::s_glyphDefinitions;
+std::map<std::string, std::string> Resources::s_cssFonts;
+std::mutex Resources::s_fileCacheMutex;
 
 //----------------------------------------------------------------------------
 // Function defined in toolkitdef.h
@@ -41,127 +58,262 @@ void SetDefaultResourcePath(const std::string &path)
 }
 
 //----------------------------------------------------------------------------
-// Resources
+// FontPack
 //----------------------------------------------------------------------------
 
-Resources::Resources()
+/**
+ * This class provides read-only access to a binary font pack generated by fonts/generate_pack.py.
+ * The file is memory-mapped when possible and read into memory otherwise.
+ * See the script for a description of the (little-endian) layout.
+ */
+class FontPack {
+public:
+    struct Header {
+        char magic[8];
+        uint32_t version;
+        uint32_t unitsPerEm;
+        uint32_t glyphCount;
+        uint32_t anchorCount;
+        uint32_t stringsOffset;
+        uint32_t stringsSize;
+        uint32_t sourceSize;
+        uint32_t sourceHash;
+    };
+
+    struct GlyphRecord {
+        uint32_t code;
+        float x;
+        float y;
+        float width;
+        float height;
+        float horizAdvX;
+        uint32_t flags;
+        uint32_t codeStrOffset;
+        uint32_t codeStrLength;
+        uint32_t nameOffset;
+        uint32_t nameLength;
+        uint32_t xmlOffset;
+        uint32_t xmlLength;
+        uint32_t firstAnchor;
+        uint32_t anchorCount;
+    };
+
+    struct AnchorRecord {
+        uint32_t nameOffset;
+        uint32_t nameLength;
+        float x;
+        float y;
+    };
+
+    static_assert(sizeof(Header) == 40 && sizeof(GlyphRecord) == 60 && sizeof(AnchorRecord) == 16);
+
+    static constexpr uint32_t VERSION = 3;
+    static constexpr uint32_t FLAG_HORIZ_ADV_X = 0x1;
+
+    FontPack() = default;
+    ~FontPack();
+    FontPack(const FontPack &) = delete;
+    FontPack &operator=(const FontPack &) = delete;
+
+    /**
+     * Open the pack and check its header and its size.
+     * The pack is out of date if the size or the content hash of the source XML file differ from the ones it was
+     * generated from. The source file is not checked if it does not exist.
+     */
+    bool Open(const std::string &filename, const std::string &sourceFilename);
+
+    /**
+     * @name Read the content of a source file and hash it as fonts/generate_pack.py does (32-bit FNV-1a).
+     */
+    ///@{
+    static bool ReadFile(const std::string &filename, std::string &content);
+    static uint32_t Hash(std::string_view content);
+    ///@}
+
+    int GetUnitsPerEm() const { return m_header.unitsPerEm; }
+    uint32_t GetGlyphCount() const { return m_header.glyphCount; }
+
+    /**
+     * @name Read a record or a string.
+     * Records are copied since the data is not guaranteed to be aligned.
+     * Strings point to the pack data and are empty if out of bounds.
+     */
+    ///@{
+    GlyphRecord GetGlyph(uint32_t idx) const;
+    AnchorRecord GetAnchor(uint32_t idx) const;
+    std::string_view GetString(uint32_t offset, uint32_t length) const;
+    ///@}
+
+private:
+    Header m_header;
+    const char *m_data = NULL;
+    size_t m_size = 0;
+    bool m_isMapped = false;
+    std::vector<char> m_buffer;
+};
+
+FontPack::~FontPack()
 {
-    m_path = s_defaultPath;
-    m_currentStyle = k_defaultStyle;
+#ifndef _WIN32
+    if (m_isMapped) munmap(const_cast<char *>(m_data), m_size);
+#endif
 }
 
-bool Resources::InitFonts()
+bool FontPack::Open(const std::string &filename, const std::string &sourceFilename)
 {
-    // We will need to rethink this for adding the option to add custom fonts
-    // Font Bravura first since it is expected to have always all symbols
-    if (!LoadFont("Bravura", false)) LogError("Bravura font could not be loaded.");
-    // The Leipzig as the default font
-    if (!LoadFont("Leipzig", false)) LogError("Leipzig font could not be loaded.");
+#ifndef _WIN32
+    int fd = open(filename.c_str(), O_RDONLY);
+    if (fd < 0) return false;
+    struct stat fileStat;
+    if ((fstat(fd, &fileStat) == 0) && (fileStat.st_size > 0)) {
+        void *data = mmap(NULL, fileStat.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+        if (data != MAP_FAILED) {
+            m_data = static_cast<const char *>(data);
+            m_size = fileStat.st_size;
+            m_isMapped = true;
+        }
+    }
+    close(fd);
+#endif
+    // Fallback on reading the file into memory
+    if (!m_isMapped) {
+        std::ifstream file(filename, std::ios::binary);
+        if (!file.is_open()) return false;
+        m_buffer.assign(std::istreambuf_iterator<char>(file), std::istreambuf_iterator<char>());
+        m_data = m_buffer.data();
+        m_size = m_buffer.size();
+    }
 
-    if (m_fontGlyphTable.size() < SMUFL_COUNT) {
-        LogError("Expected %d default SMuFL glyphs but could load only %d.", SMUFL_COUNT, m_fontGlyphTable.size());
+    if (m_size < sizeof(Header)) return false;
+    std::memcpy(&m_header, m_data, sizeof(Header));
+    if ((std::memcmp(m_header.magic, "VRVFONT", 8) != 0) || (m_header.version != VERSION)) {
+        LogWarning("Font pack '%s' is not valid or has an unsupported version", filename.c_str());
         return false;
     }
-
-    struct TextFontInfo_type {
-        const StyleAttributes m_style;
-        const std::string m_fileName;
-        bool m_isMandatory;
-    };
-
-    static const TextFontInfo_type textFontInfos[]
-        = { { k_defaultStyle, "Times", true }, { { FONTWEIGHT_bold, FONTSTYLE_normal }, "Times-bold", false },
-              { { FONTWEIGHT_bold, FONTSTYLE_italic }, "Times-bold-italic", false },
-              { { FONTWEIGHT_normal, FONTSTYLE_italic }, "Times-italic", false } };
-
-    for (const auto &textFontInfo : textFontInfos) {
-        if (!InitTextFont(textFontInfo.m_fileName, textFontInfo.m_style) && textFontInfo.m_isMandatory) {
-            LogError("Text font could not be initialized.");
+    const uint64_t recordsEnd = sizeof(Header) + (uint64_t)m_header.glyphCount * sizeof(GlyphRecord)
+        + (uint64_t)m_header.anchorCount * sizeof(AnchorRecord);
+    if ((recordsEnd > m_header.stringsOffset)
+        || ((uint64_t)m_header.stringsOffset + m_header.stringsSize > m_size)) {
+        LogWarning("Font pack '%s' is truncated", filename.c_str());
+        return false;
+    }
+    // The source file is read but not parsed, which is what takes time
+    // The glyph definitions are checked when they are used (see Resources::GetGlyphDefinition)
+    std::string content;
+    if (ReadFile(sourceFilename, content)) {
+        if ((content.size() != m_header.sourceSize) || (Hash(content) != m_header.sourceHash)) {
+            LogWarning(
+                "Font pack '%s' is out of date and '%s' is used instead", filename.c_str(), sourceFilename.c_str());
             return false;
         }
     }
-
-    m_currentStyle = k_defaultStyle;
-
     return true;
 }
 
-bool Resources::SetFont(const std::string &fontName)
+bool FontPack::ReadFile(const std::string &filename, std::string &content)
 {
-    return LoadFont(fontName);
+    std::ifstream file(filename, std::ios::binary | std::ios::ate);
+    const std::streamoff size = file.tellg();
+    if (!file.is_open() || (size < 0)) return false;
+    content.resize(size);
+    file.seekg(0);
+    return (bool)file.read(content.data(), content.size());
 }
 
-const Glyph *Resources::GetGlyph(char32_t smuflCode) const
+uint32_t FontPack::Hash(std::string_view content)
 {
-    return m_fontGlyphTable.count(smuflCode) ? &m_fontGlyphTable.at(smuflCode) : NULL;
+    uint32_t hash = 2166136261u;
+    for (const char c : content) {
+        hash = (hash ^ (unsigned char)c) * 16777619u;
+    }
+    return hash;
 }
 
-const Glyph *Resources::GetGlyph(const std::string &smuflName) const
+FontPack::GlyphRecord FontPack::GetGlyph(uint32_t idx) const
 {
-    return m_glyphNameTable.count(smuflName) ? &m_fontGlyphTable.at(m_glyphNameTable.at(smuflName)) : NULL;
+    assert(idx < m_header.glyphCount);
+
+    GlyphRecord record;
+    std::memcpy(&record, m_data + sizeof(Header) + idx * sizeof(GlyphRecord), sizeof(GlyphRecord));
+    return record;
 }
 
-char32_t Resources::GetGlyphCode(const std::string &smuflName) const
+FontPack::AnchorRecord FontPack::GetAnchor(uint32_t idx) const
 {
-    return m_glyphNameTable.count(smuflName) ? m_glyphNameTable.at(smuflName) : 0;
+    AnchorRecord record = { 0, 0, 0.0, 0.0 };
+    if (idx >= m_header.anchorCount) return record;
+
+    const size_t offset = sizeof(Header) + m_header.glyphCount * sizeof(GlyphRecord) + idx * sizeof(AnchorRecord);
+    std::memcpy(&record, m_data + offset, sizeof(AnchorRecord));
+    return record;
 }
 
-bool Resources::IsSmuflFallbackNeeded(const std::u32string &text) const
+std::string_view FontPack::GetString(uint32_t offset, uint32_t length) const
 {
-    for (char32_t c : text) {
-        const Glyph *glyph = this->GetGlyph(c);
-        if (glyph && glyph->GetFallback()) return true;
-    }
-    return false;
+    if ((uint64_t)offset + length > m_header.stringsSize) return std::string_view();
+    return std::string_view(m_data + m_header.stringsOffset + offset, length);
 }
 
-void Resources::SelectTextFont(data_FONTWEIGHT fontWeight, data_FONTSTYLE fontStyle) const
+//----------------------------------------------------------------------------
+// FontData
+//----------------------------------------------------------------------------
+
+std::map<std::string, std::weak_ptr<const FontData>> FontData::s_fonts;
+std::mutex FontData::s_fontsMutex;
+
+std::shared_ptr<const FontData> FontData::GetFont(const std::string &path, const std::string &fontName)
 {
-    if (fontWeight == FONTWEIGHT_NONE) {
-        fontWeight = FONTWEIGHT_normal;
-    }
+    const std::string filename = path + "/" + fontName;
 
-    if (fontStyle == FONTSTYLE_NONE) {
-        fontStyle = FONTSTYLE_normal;
-    }
+    const std::lock_guard<std::mutex> lock(s_fontsMutex);
 
-    m_currentStyle = { fontWeight, fontStyle };
-    if (m_textFont.count(m_currentStyle) == 0) {
-        LogWarning("Text font for style (%d, %d) is not loaded. Use default", fontWeight, fontStyle);
-        m_currentStyle = k_defaultStyle;
+    std::shared_ptr<const FontData> fontData = s_fonts[filename].lock();
+    if (!fontData) {
+        std::shared_ptr<FontData> newFontData = std::make_shared<FontData>();
+        if (!newFontData->LoadFont(path, fontName)) return NULL;
+        fontData = newFontData;
+        s_fonts[filename] = fontData;
     }
+    return fontData;
 }
 
-const Glyph *Resources::GetTextGlyph(char32_t code) const
+std::shared_ptr<const FontData> FontData::GetTextFont(const std::string &path, const std::string &fontName)
 {
-    const StyleAttributes style = (m_textFont.count(m_currentStyle) != 0) ? m_currentStyle : k_defaultStyle;
-    if (m_textFont.count(style) == 0) return NULL;
+    const std::string filename = path + "/text/" + fontName;
+
+    const std::lock_guard<std::mutex> lock(s_fontsMutex);
 
-    const GlyphTable &currentTable = m_textFont.at(style);
-    if (currentTable.count(code) == 0) {
-        return NULL;
+    std::shared_ptr<const FontData> fontData = s_fonts[filename].lock();
+    if (!fontData) {
+        std::shared_ptr<FontData> newFontData = std::make_shared<FontData>();
+        if (!newFontData->LoadTextFont(path, fontName)) return NULL;
+        fontData = newFontData;
+        s_fonts[filename] = fontData;
     }
+    return fontData;
+}
 
-    return &currentTable.at(code);
+const Glyph *FontData::GetGlyph(char32_t code) const
+{
+    auto it = m_glyphTable.find(code);
+    return (it != m_glyphTable.end()) ? &it->second : NULL;
 }
 
-char32_t Resources::GetSmuflGlyphForUnicodeChar(const char32_t unicodeChar)
+bool FontData::GetGlyphCode(const std::string &name, char32_t &code) const
 {
-    char32_t smuflChar = unicodeChar;
-    switch (unicodeChar) {
-        case UNICODE_DAL_SEGNO: smuflChar = SMUFL_E045_dalSegno; break;
-        case UNICODE_DA_CAPO: smuflChar = SMUFL_E046_daCapo; break;
-        case UNICODE_SEGNO: smuflChar = SMUFL_E047_segno; break;
-        case UNICODE_CODA: smuflChar = SMUFL_E048_coda; break;
-        default: break;
-    }
-    return smuflChar;
+    auto it = m_glyphNameTable.find(name);
+    if (it == m_glyphNameTable.end()) return false;
+    code = it->second;
+    return true;
 }
 
-bool Resources::LoadFont(const std::string &fontName, bool withFallback)
+bool FontData::LoadFont(const std::string &path, const std::string &fontName)
 {
+    // Use the binary font pack when available
+    if (this->LoadFontPack(path, fontName)) return true;
+
     pugi::xml_document doc;
-    const std::string filename = Resources::GetPath() + "/" + fontName + ".xml";
+    const std::string filename = path + "/" + fontName + ".xml";
     pugi::xml_parse_result parseResult = doc.load_file(filename.c_str());
     if (!parseResult) {
         // File not found, default bounding boxes will be used
@@ -174,12 +326,6 @@ bool Resources::LoadFont(const std::string &fontName, bool withFallback)
         return false;
     }
 
-    if (withFallback) {
-        for (auto &glyph : m_fontGlyphTable) {
-            glyph.second.SetFallback(true);
-        }
-    }
-
     const int unitsPerEm = atoi(root.attribute("units-per-em").value());
 
     for (pugi::xml_node current = root.child("g"); current; current = current.next_sibling("g")) {
@@ -196,7 +342,7 @@ bool Resources::LoadFont(const std::string &fontName, bool withFallback)
         if (current.attribute("w")) width = current.attribute("w").as_float();
         if (current.attribute("h")) height = current.attribute("h").as_float();
         glyph.SetBoundingBox(x, y, width, height);
-        glyph.SetPath(Resources::GetPath() + "/" + fontName + "/" + c_attribute.value() + ".xml");
+        glyph.SetPath(path + "/" + fontName + "/" + c_attribute.value() + ".xml");
         if (current.attribute("h-a-x")) glyph.SetHorizAdvX(current.attribute("h-a-x").as_float());
 
         // load anchors
@@ -211,22 +357,23 @@ bool Resources::LoadFont(const std::string &fontName, bool withFallback)
         }
 
         const char32_t smuflCode = (char32_t)strtol(c_attribute.value(), NULL, 16);
-        glyph.SetFallback(false);
-        m_fontGlyphTable[smuflCode] = glyph;
+        m_glyphTable[smuflCode] = glyph;
         m_glyphNameTable[n_attribute.value()] = smuflCode;
     }
 
-    m_fontName = fontName;
     return true;
 }
 
-bool Resources::InitTextFont(const std::string &fontName, const StyleAttributes &style)
+bool FontData::LoadTextFont(const std::string &path, const std::string &fontName)
 {
+    // Use the binary font pack when available
+    if (this->LoadTextFontPack(path, fontName)) return true;
+
     // For the text font, we load the bounding boxes only
     pugi::xml_document doc;
     // For now, we have only Times bounding boxes for ASCII chars
     // For any other char, we currently use 'o' bounding box
-    std::string filename = GetPath() + "/text/" + fontName + ".xml";
+    std::string filename = path + "/text/" + fontName + ".xml";
     pugi::xml_parse_result result = doc.load_file(filename.c_str());
     if (!result) {
         // File not found, default bounding boxes will be used
@@ -240,10 +387,6 @@ bool Resources::InitTextFont(const std::string &fontName, const StyleAttributes
     }
     const int unitsPerEm = root.attribute("units-per-em").as_int();
     pugi::xml_node current;
-    if (m_textFont.count(style) == 0) {
-        m_textFont[style] = {};
-    }
-    GlyphTable &currentTable = m_textFont.at(style);
     for (current = root.child("g"); current; current = current.next_sibling("g")) {
         if (current.attribute("c")) {
             char32_t code = (char32_t)strtol(current.attribute("c").value(), NULL, 16);
@@ -259,13 +402,295 @@ bool Resources::InitTextFont(const std::string &fontName, const StyleAttributes
             glyph.SetBoundingBox(x, y, width, height);
 
             if (current.attribute("h-a-x")) glyph.SetHorizAdvX(current.attribute("h-a-x").as_float());
-            if (currentTable.count(code) > 0) {
+            if (m_glyphTable.count(code) > 0) {
                 LogDebug("Redefining %d with %s", code, fontName.c_str());
             }
-            currentTable[code] = glyph;
+            m_glyphTable[code] = glyph;
+        }
+    }
+    return true;
+}
+
+bool FontData::LoadFontPack(const std::string &path, const std::string &fontName)
+{
+    std::shared_ptr<FontPack> fontPack = std::make_shared<FontPack>();
+    if (!fontPack->Open(path + "/" + fontName + ".vrvfont", path + "/" + fontName + ".xml")) return false;
+    // Keep the pack since the glyphs point to the XML definitions it contains
+    m_fontPack = fontPack;
+
+    const int unitsPerEm = fontPack->GetUnitsPerEm();
+
+    for (uint32_t i = 0; i < fontPack->GetGlyphCount(); ++i) {
+        const FontPack::GlyphRecord record = fontPack->GetGlyph(i);
+        const std::string codeStr(fontPack->GetString(record.codeStrOffset, record.codeStrLength));
+
+        Glyph glyph;
+        glyph.SetUnitsPerEm(unitsPerEm * 10);
+        glyph.SetCodeStr(codeStr);
+        glyph.SetBoundingBox(record.x, record.y, record.width, record.height);
+        glyph.SetPath(path + "/" + fontName + "/" + codeStr + ".xml");
+        glyph.SetXML(fontPack->GetString(record.xmlOffset, record.xmlLength));
+        if (record.flags & FontPack::FLAG_HORIZ_ADV_X) glyph.SetHorizAdvX(record.horizAdvX);
+
+        // load anchors
+        for (uint32_t j = record.firstAnchor; j < record.firstAnchor + record.anchorCount; ++j) {
+            const FontPack::AnchorRecord anchor = fontPack->GetAnchor(j);
+            glyph.SetAnchor(std::string(fontPack->GetString(anchor.nameOffset, anchor.nameLength)), anchor.x, anchor.y);
+        }
+
+        const char32_t smuflCode = (char32_t)record.code;
+        m_glyphTable[smuflCode] = glyph;
+        m_glyphNameTable[std::string(fontPack->GetString(record.nameOffset, record.nameLength))] = smuflCode;
+    }
+
+    return true;
+}
+
+bool FontData::LoadTextFontPack(const std::string &path, const std::string &fontName)
+{
+    // Text font packs only have bounding boxes and do not need to be kept
+    FontPack fontPack;
+    if (!fontPack.Open(path + "/text/" + fontName + ".vrvfont", path + "/text/" + fontName + ".xml")) return false;
+
+    const int unitsPerEm = fontPack.GetUnitsPerEm();
+    for (uint32_t i = 0; i < fontPack.GetGlyphCount(); ++i) {
+        const FontPack::GlyphRecord record = fontPack.GetGlyph(i);
+        const char32_t code = (char32_t)record.code;
+        Glyph glyph(unitsPerEm);
+        glyph.SetBoundingBox(record.x, record.y, record.width, record.height);
+        if (record.flags & FontPack::FLAG_HORIZ_ADV_X) glyph.SetHorizAdvX(record.horizAdvX);
+        if (m_glyphTable.count(code) > 0) {
+            LogDebug("Redefining %d with %s", code, fontName.c_str());
         }
+        m_glyphTable[code] = glyph;
     }
     return true;
 }
 
+//----------------------------------------------------------------------------
+// Resources
+//----------------------------------------------------------------------------
+
+Resources::Resources()
+{
+    m_path = s_defaultPath;
+    m_fallbackFontCount = 0;
+    m_currentStyle = k_defaultStyle;
+}
+
+bool Resources::InitFonts()
+{
+    m_fonts.clear();
+    m_fallbackFontCount = 0;
+
+    // We will need to rethink this for adding the option to add custom fonts
+    // Font Bravura first since it is expected to have always all symbols
+    if (!LoadFont("Bravura", false)) LogError("Bravura font could not be loaded.");
+    // The Leipzig as the default font
+    if (!LoadFont("Leipzig", false)) LogError("Leipzig font could not be loaded.");
+
+    const int glyphCount = this->GetGlyphCount();
+    if (glyphCount < SMUFL_COUNT) {
+        LogError("Expected %d default SMuFL glyphs but could load only %d.", SMUFL_COUNT, glyphCount);
+        return false;
+    }
+
+    struct TextFontInfo_type {
+        const StyleAttributes m_style;
+        const std::string m_fileName;
+        bool m_isMandatory;
+    };
+
+    static const TextFontInfo_type textFontInfos[]
+        = { { k_defaultStyle, "Times", true }, { { FONTWEIGHT_bold, FONTSTYLE_normal }, "Times-bold", false },
+              { { FONTWEIGHT_bold, FONTSTYLE_italic }, "Times-bold-italic", false },
+              { { FONTWEIGHT_normal, FONTSTYLE_italic }, "Times-italic", false } };
+
+    for (const auto &textFontInfo : textFontInfos) {
+        if (!InitTextFont(textFontInfo.m_fileName, textFontInfo.m_style) && textFontInfo.m_isMandatory) {
+            LogError("Text font could not be initialized.");
+            return false;
+        }
+    }
+
+    m_currentStyle = k_defaultStyle;
+
+    return true;
+}
+
+bool Resources::InitTextFont(const std::string &fontName, const StyleAttributes &style)
+{
+    // For the text font, we load the bounding boxes only
+    std::shared_ptr<const FontData> fontData = FontData::GetTextFont(m_path, fontName);
+    if (!fontData) return false;
+
+    m_textFonts[style] = fontData;
+    return true;
+}
+
+bool Resources::SetFont(const std::string &fontName)
+{
+    return LoadFont(fontName);
+}
+
+const Glyph *Resources::GetGlyph(char32_t smuflCode) const
+{
+    int fontIdx;
+    return this->FindGlyph(smuflCode, fontIdx);
+}
+
+const Glyph *Resources::GetGlyph(const std::string &smuflName) const
+{
+    for (auto it = m_fonts.rbegin(); it != m_fonts.rend(); ++it) {
+        char32_t smuflCode;
+        if ((*it)->GetGlyphCode(smuflName, smuflCode)) return this->GetGlyph(smuflCode);
+    }
+    return NULL;
+}
+
+char32_t Resources::GetGlyphCode(const std::string &smuflName) const
+{
+    for (auto it = m_fonts.rbegin(); it != m_fonts.rend(); ++it) {
+        char32_t smuflCode;
+        if ((*it)->GetGlyphCode(smuflName, smuflCode)) return smuflCode;
+    }
+    return 0;
+}
+
+bool Resources::IsSmuflFallbackNeeded(const std::u32string &text) const
+{
+    for (char32_t c : text) {
+        int fontIdx;
+        const Glyph *glyph = this->FindGlyph(c, fontIdx);
+        if (glyph && (fontIdx < m_fallbackFontCount)) return true;
+    }
+    return false;
+}
+
+void Resources::SelectTextFont(data_FONTWEIGHT fontWeight, data_FONTSTYLE fontStyle) const
+{
+    if (fontWeight == FONTWEIGHT_NONE) {
+        fontWeight = FONTWEIGHT_normal;
+    }
+
+    if (fontStyle == FONTSTYLE_NONE) {
+        fontStyle = FONTSTYLE_normal;
+    }
+
+    m_currentStyle = { fontWeight, fontStyle };
+    if (m_textFonts.count(m_currentStyle) == 0) {
+        LogWarning("Text font for style (%d, %d) is not loaded. Use default", fontWeight, fontStyle);
+        m_currentStyle = k_defaultStyle;
+    }
+}
+
+const Glyph *Resources::GetTextGlyph(char32_t code) const
+{
+    const StyleAttributes style = (m_textFonts.count(m_currentStyle) != 0) ? m_currentStyle : k_defaultStyle;
+    if (m_textFonts.count(style) == 0) return NULL;
+
+    return m_textFonts.at(style)->GetGlyph(code);
+}
+
+char32_t Resources::GetSmuflGlyphForUnicodeChar(const char32_t unicodeChar)
+{
+    char32_t smuflChar = unicodeChar;
+    switch (unicodeChar) {
+        case UNICODE_DAL_SEGNO: smuflChar = SMUFL_E045_dalSegno; break;
+        case UNICODE_DA_CAPO: smuflChar = SMUFL_E046_daCapo; break;
+        case UNICODE_SEGNO: smuflChar = SMUFL_E047_segno; break;
+        case UNICODE_CODA: smuflChar = SMUFL_E048_coda; break;
+        default: break;
+    }
+    return smuflChar;
+}
+
+const pugi::xml_document &Resources::GetGlyphDefinition(const Glyph *glyph)
+{
+    assert(glyph);
+
+    const std::lock_guard<std::mutex> lock(s_fileCacheMutex);
+
+    std::unique_ptr<pugi::xml_document> &definition = s_glyphDefinitions[glyph->GetPath()];
+    if (!definition) {
+        definition = std::make_unique<pugi::xml_document>();
+        const std::string_view xml = glyph->GetXML();
+        // The file is preferred to a definition of a font pack that differs from it
+        std::string content;
+        if (FontPack::ReadFile(glyph->GetPath(), content)) {
+            if (!xml.empty() && (xml != content)) {
+                LogWarning("Glyph definition '%s' differs from the font pack and the file is used instead",
+                    glyph->GetPath().c_str());
+            }
+            definition->load_buffer(content.data(), content.size());
+        }
+        else if (!xml.empty()) {
+            definition->load_buffer(xml.data(), xml.size());
+        }
+    }
+    // Map values are not moved when other entries are added, so the reference remains valid
+    return *definition;
+}
+
+bool Resources::GetCSSFont(const std::string &fontName, std::string &cssContent) const
+{
+    const std::string cssFontPath = StringFormat("%s/%s.css", m_path.c_str(), fontName.c_str());
+
+    const std::lock_guard<std::mutex> lock(s_fileCacheMutex);
+
+    auto it = s_cssFonts.find(cssFontPath);
+    if (it == s_cssFonts.end()) {
+        std::ifstream cssFontFile(cssFontPath);
+        if (!cssFontFile.is_open()) return false;
+        std::stringstream cssFontStream;
+        cssFontStream << cssFontFile.rdbuf();
+        it = s_cssFonts.insert({ cssFontPath, cssFontStream.str() }).first;
+    }
+    cssContent = it->second;
+    return true;
+}
+
+bool Resources::LoadFont(const std::string &fontName, bool withFallback)
+{
+    std::shared_ptr<const FontData> fontData = FontData::GetFont(m_path, fontName);
+    if (!fontData) return false;
+
+    // A font loaded again is moved to the top
+    auto it = std::find(m_fonts.begin(), m_fonts.end(), fontData);
+    if (it != m_fonts.end()) {
+        if (std::distance(m_fonts.begin(), it) < m_fallbackFontCount) --m_fallbackFontCount;
+        m_fonts.erase(it);
+    }
+    m_fonts.push_back(fontData);
+
+    // All the glyphs of the previous fonts become a fallback
+    if (withFallback) m_fallbackFontCount = (int)m_fonts.size() - 1;
+
+    m_fontName = fontName;
+    return true;
+}
+
+const Glyph *Resources::FindGlyph(char32_t smuflCode, int &fontIdx) const
+{
+    for (fontIdx = (int)m_fonts.size() - 1; fontIdx >= 0; --fontIdx) {
+        const Glyph *glyph = m_fonts.at(fontIdx)->GetGlyph(smuflCode);
+        if (glyph) return glyph;
+    }
+    return NULL;
+}
+
+int Resources::GetGlyphCount() const
+{
+    // Count the glyphs that are not overridden by a font loaded later
+    int count = 0;
+    int fontIdx;
+    for (int i = 0; i < (int)m_fonts.size(); ++i) {
+        for (const auto &entry : m_fonts.at(i)->GetGlyphTable()) {
+            this->FindGlyph(entry.first, fontIdx);
+            if (fontIdx == i) ++count;
+        }
+    }
+    return count;
+}
+
 } // namespace vrv
@@ -9,7 +9,10 @@
 
 //----------------------------------------------------------------------------
 
+#include <algorithm>
 #include <cassert>
+#include <cstdio>
+#include <cstring>
 
 //----------------------------------------------------------------------------
 
@@ -29,6 +32,670 @@ namespace vrv {
 #define space " "
 #define semicolon ";"
 
+//----------------------------------------------------------------------------
+// SvgDomWriter
+//----------------------------------------------------------------------------
+
+SvgDomWriter::SvgDomWriter()
+{
+    m_currentNode = m_svgDoc;
+    m_svgNodeStack.push_back(m_currentNode);
+
+    m_indent = 2;
+    m_formatRaw = false;
+}
+
+void SvgDomWriter::Reset()
+{
+    m_svgDoc.reset();
+    m_currentNode = m_svgDoc;
+    m_svgNodeStack.clear();
+    m_svgNodeStack.push_back(m_currentNode);
+    m_leafNode = pugi::xml_node();
+}
+
+pugi::xml_node SvgDomWriter::AddNode(const char *name, Position position)
+{
+    switch (position) {
+        case PREPEND: return m_currentNode.prepend_child(name);
+        case BEFORE_GROUP: {
+            pugi::xml_node g = m_currentNode.child("g");
+            return (g) ? m_currentNode.insert_child_before(name, g) : m_currentNode.append_child(name);
+        }
+        case AFTER_PARENT: return m_currentNode.parent().parent().append_child(name);
+        default: return m_currentNode.append_child(name);
+    }
+}
+
+void SvgDomWriter::StartElement(const char *name, Position position)
+{
+    m_leafNode = pugi::xml_node();
+    m_currentNode = this->AddNode(name, position);
+    m_svgNodeStack.push_back(m_currentNode);
+}
+
+void SvgDomWriter::EndElement()
+{
+    m_leafNode = pugi::xml_node();
+    m_svgNodeStack.pop_back();
+    m_currentNode = m_svgNodeStack.back();
+}
+
+void SvgDomWriter::ResumeElement(const std::string &id)
+{
+    m_leafNode = pugi::xml_node();
+    std::string xpath = "//g[@id=\"" + id + "\" or @data-id=\"" + id + "\"]";
+    pugi::xpath_node selection = m_currentNode.select_node(xpath.c_str());
+    if (selection) {
+        m_currentNode = selection.node();
+    }
+    m_svgNodeStack.push_back(m_currentNode);
+}
+
+void SvgDomWriter::EndResumedElement()
+{
+    this->EndElement();
+}
+
+void SvgDomWriter::StartLeaf(const std::string &name, Position position)
+{
+    m_leafNode = this->AddNode(name.c_str(), position);
+}
+
+void SvgDomWriter::SetLeafText(const std::string &text)
+{
+    assert(m_leafNode);
+    m_leafNode.text().set(text.c_str());
+}
+
+void SvgDomWriter::AddAttribute(const char *name, const char *value)
+{
+    this->GetAttributeNode().append_attribute(name) = value;
+}
+
+void SvgDomWriter::AddAttribute(const char *name, int value)
+{
+    this->GetAttributeNode().append_attribute(name) = value;
+}
+
+void SvgDomWriter::AddAttribute(const char *name, float value)
+{
+    this->GetAttributeNode().append_attribute(name) = value;
+}
+
+void SvgDomWriter::AddAttribute(const char *name, double value)
+{
+    this->GetAttributeNode().append_attribute(name) = value;
+}
+
+void SvgDomWriter::PrependAttribute(const char *name, const std::string &value)
+{
+    m_currentNode.prepend_attribute(name) = value.c_str();
+}
+
+void SvgDomWriter::RemoveId()
+{
+    m_currentNode.remove_attribute("id");
+}
+
+std::string SvgDomWriter::GetAncestorFontFamily() const
+{
+    pugi::xpath_node fontNode = m_currentNode.select_node("ancestor::*[@font-family][1]");
+    return (fontNode) ? fontNode.node().attribute("font-family").value() : "";
+}
+
+void SvgDomWriter::AppendCopy(pugi::xml_node node, const char *id)
+{
+    m_leafNode = pugi::xml_node();
+    pugi::xml_node copy = m_currentNode.append_copy(node);
+    if (id) copy.attribute("id").set_value(id);
+}
+
+std::string SvgDomWriter::Flatten(bool xmlDeclaration)
+{
+    m_leafNode = pugi::xml_node();
+
+    unsigned int outputFlags = pugi::format_default | pugi::format_no_declaration;
+    if (xmlDeclaration) {
+        // edit the xml declaration
+        outputFlags = pugi::format_default;
+        pugi::xml_node decl = m_svgDoc.prepend_child(pugi::node_declaration);
+        decl.append_attribute("version") = "1.0";
+        decl.append_attribute("encoding") = "UTF-8";
+        decl.append_attribute("standalone") = "no";
+    }
+
+    if (m_formatRaw) {
+        outputFlags |= pugi::format_raw;
+    }
+
+    std::ostringstream output;
+    std::string indent = (m_indent == -1) ? "\t" : std::string(m_indent, ' ');
+    m_svgDoc.save(output, indent.c_str(), outputFlags);
+    return output.str();
+}
+
+//----------------------------------------------------------------------------
+// SvgStreamWriter
+//----------------------------------------------------------------------------
+
+SvgStreamWriter::SvgStreamWriter()
+{
+    m_sinks.emplace_back();
+    // avoid most reallocations of the main buffer for a typical page
+    m_sinks.front().reserve(1 << 18);
+
+    m_leafOpen = false;
+    m_leafSink = -1;
+    m_leafHasText = false;
+
+    m_indent = "  ";
+    m_formatRaw = false;
+    m_fixupCount = 0;
+}
+
+void SvgStreamWriter::Reset()
+{
+    // keep the main buffer with its capacity
+    m_sinks.resize(1);
+    m_sinks.front().clear();
+    m_fixups.clear();
+    m_elements.clear();
+    m_stack.clear();
+    m_groups.clear();
+    m_fontFamilies.clear();
+
+    m_leafOpen = false;
+    m_leafSink = -1;
+    m_leafName.clear();
+    m_leafText.clear();
+    m_leafHasText = false;
+
+    m_fixupCount = 0;
+}
+
+void SvgStreamWriter::SetIndent(int indent)
+{
+    m_indent = (indent == -1) ? "\t" : std::string(std::max(indent, 0), ' ');
+}
+
+int SvgStreamWriter::AddSink()
+{
+    m_sinks.emplace_back();
+    return (int)m_sinks.size() - 1;
+}
+
+int SvgStreamWriter::AddFixup(const Location &location, int rank, bool prepend, size_t erase)
+{
+    assert(location.m_sink != -1);
+
+    ++m_fixupCount;
+    const int content = this->AddSink();
+    m_fixups.push_back(
+        { location.m_sink, location.m_offset, erase, rank, prepend ? -m_fixupCount : m_fixupCount, content, "" });
+    return content;
+}
+
+void SvgStreamWriter::WriteIndent(std::string &sink, int depth)
+{
+    if (m_formatRaw) return;
+
+    sink.push_back('\n');
+    for (int i = 0; i < depth; ++i) sink.append(m_indent);
+}
+
+void SvgStreamWriter::WriteAttribute(std::string &sink, const char *name, const char *value)
+{
+    sink.push_back(' ');
+    sink.append(name);
+    sink.append("=\"");
+    this->WriteEscaped(sink, value, true);
+    sink.push_back('"');
+}
+
+void SvgStreamWriter::WriteEscaped(std::string &sink, const char *value, bool attribute)
+{
+    // Same escaping as pugixml: control characters are written as character references but tabs and
+    // new lines in text, and > is escaped in text only
+    const char *start = value;
+    for (const char *c = value; *c; ++c) {
+        const unsigned char ch = (unsigned char)*c;
+        const char *entity = NULL;
+        if (ch == '&') {
+            entity = "&amp;";
+        }
+        else if (ch == '<') {
+            entity = "&lt;";
+        }
+        else if (ch == '>') {
+            if (!attribute) entity = "&gt;";
+        }
+        else if (ch == '"') {
+            if (attribute) entity = "&quot;";
+        }
+        else if (ch < 32) {
+            if (attribute || ((ch != '\t') && (ch != '\n') && (ch != '\r'))) entity = "";
+        }
+        if (!entity) continue;
+
+        sink.append(start, c - start);
+        start = c + 1;
+        if (*entity) {
+            sink.append(entity);
+        }
+        else {
+            const char reference[] = { '&', '#', char('0' + ch / 10), char('0' + ch % 10), ';', 0 };
+            sink.append(reference);
+        }
+    }
+    sink.append(start);
+}
+
+int SvgStreamWriter::PrepareChild(Element &parent, Position position, bool isGroup)
+{
+    this->CloseLeaf();
+
+    if ((position == BEFORE_GROUP) && (parent.m_firstGroup.m_sink == -1)) position = APPEND;
+    if ((position == PREPEND) && !parent.m_hasChildren) position = APPEND;
+
+    int sink = -1;
+    if (position == BEFORE_GROUP) {
+        if (parent.m_beforeGroupSink == -1) parent.m_beforeGroupSink = this->AddFixup(parent.m_firstGroup, 1, false);
+        sink = parent.m_beforeGroupSink;
+        if (isGroup) {
+            parent.m_firstGroup = { sink, m_sinks.at(sink).size() };
+            parent.m_beforeGroupSink = -1;
+        }
+    }
+    else if (position == PREPEND) {
+        sink = this->AddFixup(parent.m_contentStart, 1, true);
+        if (isGroup) {
+            parent.m_firstGroup = { sink, 0 };
+            parent.m_beforeGroupSink = -1;
+        }
+    }
+    else {
+        if (parent.m_tagOpen) {
+            std::string &tagSink = m_sinks.at(parent.m_sink);
+            parent.m_attrEnd = tagSink.size();
+            tagSink.push_back('>');
+            parent.m_contentStart = { parent.m_sink, tagSink.size() };
+            parent.m_tagOpen = false;
+        }
+        else if (parent.m_contentSink == -1) {
+            // The element was ended and is resumed - its children are inserted before its end tag
+            if (parent.m_selfClosed) {
+                parent.m_contentSink = this->AddFixup(
+                    { parent.m_sink, parent.m_closeOffset }, 1, false, parent.m_closeEnd - parent.m_closeOffset);
+                parent.m_reopenFixup = (int)m_fixups.size() - 1;
+                m_sinks.at(parent.m_contentSink).push_back('>');
+                parent.m_contentStart = { parent.m_contentSink, 1 };
+            }
+            else {
+                parent.m_contentSink = this->AddFixup({ parent.m_sink, parent.m_closeOffset }, 1, false);
+            }
+        }
+        sink = parent.m_contentSink;
+        if (isGroup && (parent.m_firstGroup.m_sink == -1)) {
+            parent.m_firstGroup = { sink, m_sinks.at(sink).size() };
+        }
+    }
+    parent.m_hasChildren = true;
+
+    return sink;
+}
+
+void SvgStreamWriter::StartElement(const char *name, Position position)
+{
+    int sink = 0;
+    int depth = 0;
+    Element *parent = (m_stack.empty()) ? NULL : m_stack.back();
+    if (parent) {
+        sink = this->PrepareChild(*parent, position, (strcmp(name, "g") == 0));
+        depth = parent->m_depth + 1;
+        if (parent->m_afterText) {
+            parent->m_afterText = false;
+        }
+        else {
+            this->WriteIndent(m_sinks.at(sink), depth);
+        }
+    }
+
+    Element &element = m_elements.emplace_back();
+    element.m_name = name;
+    element.m_depth = depth;
+    element.m_sink = sink;
+    element.m_contentSink = sink;
+    if (parent) {
+        element.m_ancestorFontFamily = (parent->m_fontFamily) ? parent->m_fontFamily : parent->m_ancestorFontFamily;
+    }
+
+    std::string &tagSink = m_sinks.at(sink);
+    element.m_tagStart = tagSink.size();
+    tagSink.push_back('<');
+    tagSink.append(name);
+
+    m_stack.push_back(&element);
+}
+
+void SvgStreamWriter::EndElement()
+{
+    this->CloseLeaf();
+
+    assert(!m_stack.empty());
+    Element &element = *m_stack.back();
+    assert(&element == &m_elements.back());
+
+    std::string &sink = m_sinks.at(element.m_sink);
+    element.m_closeOffset = sink.size();
+    if (element.m_tagOpen) {
+        element.m_attrEnd = sink.size();
+        sink.append((m_formatRaw) ? "/>" : " />");
+        element.m_selfClosed = true;
+        element.m_tagOpen = false;
+    }
+    else {
+        if (!element.m_afterText) this->WriteIndent(sink, element.m_depth);
+        sink.append("</");
+        sink.append(element.m_name);
+        sink.push_back('>');
+    }
+    element.m_closeEnd = sink.size();
+    element.m_contentSink = -1;
+    element.m_ended = true;
+
+    if (element.m_trailingSink != -1) {
+        m_fixups.push_back({ element.m_sink, element.m_closeEnd, 0, 1, ++m_fixupCount, element.m_trailingSink, "" });
+        element.m_trailingSink = -1;
+    }
+
+    if (!element.m_id.empty()) {
+        m_groups.emplace(element.m_id, element);
+    }
+
+    m_stack.pop_back();
+    m_elements.pop_back();
+}
+
+void SvgStreamWriter::ResumeElement(const std::string &id)
+{
+    this->CloseLeaf();
+
+    assert(!m_stack.empty());
+    auto it = m_groups.find(id);
+    m_stack.push_back((it != m_groups.end()) ? &it->second : m_stack.back());
+}
+
+void SvgStreamWriter::EndResumedElement()
+{
+    this->CloseLeaf();
+
+    assert(!m_stack.empty());
+    Element &element = *m_stack.back();
+    if (element.m_ended) {
+        if (element.m_reopenFixup != -1) {
+            Fixup &fixup = m_fixups.at(element.m_reopenFixup);
+            fixup.m_suffix.clear();
+            if (!element.m_afterText) this->WriteIndent(fixup.m_suffix, element.m_depth);
+            fixup.m_suffix += "</" + std::string(element.m_name) + ">";
+        }
+        if (element.m_trailingSink != -1) {
+            m_fixups.push_back(
+                { element.m_sink, element.m_closeEnd, 0, 1, ++m_fixupCount, element.m_trailingSink, "" });
+            element.m_trailingSink = -1;
+        }
+    }
+    m_stack.pop_back();
+}
+
+void SvgStreamWriter::StartLeaf(const std::string &name, Position position)
+{
+    this->CloseLeaf();
+
+    assert(!m_stack.empty());
+    int sink = -1;
+    int depth = 0;
+    if ((position == AFTER_PARENT) && (m_stack.size() > 1)) {
+        Element &parent = *m_stack.at(m_stack.size() - 2);
+        if (parent.m_trailingSink == -1) parent.m_trailingSink = this->AddSink();
+        sink = parent.m_trailingSink;
+        depth = parent.m_depth;
+        this->WriteIndent(m_sinks.at(sink), depth);
+    }
+    else {
+        if (position == AFTER_PARENT) position = APPEND;
+        Element &parent = *m_stack.back();
+        sink = this->PrepareChild(parent, position, (name == "g"));
+        depth = parent.m_depth + 1;
+        if (parent.m_afterText) {
+            parent.m_afterText = false;
+        }
+        else {
+            this->WriteIndent(m_sinks.at(sink), depth);
+        }
+    }
+
+    std::string &leafSink = m_sinks.at(sink);
+    leafSink.push_back('<');
+    leafSink.append(name);
+
+    m_leafOpen = true;
+    m_leafSink = sink;
+    m_leafName = name;
+    m_leafHasText = false;
+}
+
+void SvgStreamWriter::SetLeafText(const std::string &text)
+{
+    assert(m_leafOpen);
+
+    m_leafText = text;
+    m_leafHasText = true;
+}
+
+void SvgStreamWriter::CloseLeaf()
+{
+    if (!m_leafOpen) return;
+
+    std::string &sink = m_sinks.at(m_leafSink);
+    if (m_leafHasText) {
+        sink.push_back('>');
+        this->WriteEscaped(sink, m_leafText.c_str(), false);
+        sink.append("</");
+        sink.append(m_leafName);
+        sink.push_back('>');
+    }
+    else {
+        sink.append((m_formatRaw) ? "/>" : " />");
+    }
+    m_leafOpen = false;
+}
+
+void SvgStreamWriter::AddAttribute(const char *name, const char *value)
+{
+    if (m_leafOpen) {
+        this->WriteAttribute(m_sinks.at(m_leafSink), name, value);
+        return;
+    }
+
+    assert(!m_stack.empty());
+    Element &element = *m_stack.back();
+
+    if (!strcmp(name, "transform")) {
+        element.m_hasTransform = true;
+    }
+    else if (!strcmp(name, "font-family")) {
+        element.m_fontFamily = &(*m_fontFamilies.insert(value).first);
+    }
+    else if ((!strcmp(name, "id") || !strcmp(name, "data-id")) && !strcmp(element.m_name, "g")) {
+        if (!element.m_ended && element.m_id.empty()) element.m_id = value;
+    }
+
+    if (element.m_tagOpen) {
+        this->WriteAttribute(m_sinks.at(element.m_sink), name, value);
+    }
+    else {
+        // The start tag is already closed
+        const int sink = this->AddFixup({ element.m_sink, element.m_attrEnd }, 0, false);
+        this->WriteAttribute(m_sinks.at(sink), name, value);
+    }
+}
+
+void SvgStreamWriter::AddAttribute(const char *name, int value)
+{
+    this->AddAttribute(name, std::to_string(value).c_str());
+}
+
+void SvgStreamWriter::AddAttribute(const char *name, float value)
+{
+    char buffer[128];
+    snprintf(buffer, sizeof(buffer), "%.*g", 9, double(value));
+    this->AddAttribute(name, buffer);
+}
+
+void SvgStreamWriter::AddAttribute(const char *name, double value)
+{
+    char buffer[128];
+    snprintf(buffer, sizeof(buffer), "%.*g", 17, value);
+    this->AddAttribute(name, buffer);
+}
+
+void SvgStreamWriter::PrependAttribute(const char *name, const std::string &value)
+{
+    this->CloseLeaf();
+
+    assert(!m_stack.empty());
+    Element &element = *m_stack.back();
+
+    // Insert it right after the element name
+    const Location location = { element.m_sink, element.m_tagStart + 1 + strlen(element.m_name) };
+    const int sink = this->AddFixup(location, 0, true);
+    this->WriteAttribute(m_sinks.at(sink), name, value.c_str());
+}
+
+void SvgStreamWriter::RemoveId()
+{
+    this->CloseLeaf();
+
+    assert(!m_stack.empty());
+    Element &element = *m_stack.back();
+    if (!element.m_tagOpen) return;
+
+    std::string &sink = m_sinks.at(element.m_sink);
+    const size_t start = sink.find(" id=\"", element.m_tagStart);
+    if (start == std::string::npos) return;
+    const size_t end = sink.find('"', start + 5);
+    assert(end != std::string::npos);
+    sink.erase(start, end - start + 1);
+    element.m_id.clear();
+}
+
+std::string SvgStreamWriter::GetAncestorFontFamily() const
+{
+    assert(!m_stack.empty());
+    const std::string *fontFamily = m_stack.back()->m_ancestorFontFamily;
+    return (fontFamily) ? *fontFamily : "";
+}
+
+void SvgStreamWriter::AppendCopy(pugi::xml_node node, const char *id)
+{
+    class StringWriter : public pugi::xml_writer {
+    public:
+        StringWriter(std::string &output) : m_output(output) {}
+        void write(const void *data, size_t size) override { m_output.append((const char *)data, size); }
+
+    private:
+        std::string &m_output;
+    };
+
+    assert(!m_stack.empty());
+    Element &parent = *m_stack.back();
+    const bool isText = ((node.type() == pugi::node_pcdata) || (node.type() == pugi::node_cdata));
+    std::string &sink
+        = m_sinks.at(this->PrepareChild(parent, APPEND, (!isText && !strcmp(node.name(), "g"))));
+
+    std::string copy;
+    StringWriter writer(copy);
+    const unsigned int flags = (m_formatRaw) ? pugi::format_raw : pugi::format_indent;
+    node.print(writer, m_indent.c_str(), flags, pugi::encoding_utf8, parent.m_depth + 1);
+
+    if (isText) {
+        sink.append(copy);
+        parent.m_afterText = true;
+        return;
+    }
+
+    // replace the value of the @id in the start tag
+    if (id) {
+        const size_t tagEnd = copy.find('>');
+        const size_t idStart = copy.find(" id=\"");
+        if ((idStart != std::string::npos) && (idStart < tagEnd)) {
+            const size_t valueStart = idStart + 5;
+            const size_t valueEnd = copy.find('"', valueStart);
+            std::string value;
+            this->WriteEscaped(value, id, true);
+            copy.replace(valueStart, valueEnd - valueStart, value);
+        }
+    }
+
+    // pugixml indents the node and ends it with a new line, while the writer starts children with the new line
+    if (!m_formatRaw && !copy.empty() && (copy.back() == '\n')) copy.pop_back();
+    if (parent.m_afterText) {
+        copy.erase(0, copy.find('<'));
+        parent.m_afterText = false;
+    }
+    else if (!m_formatRaw) {
+        sink.push_back('\n');
+    }
+    sink.append(copy);
+}
+
+std::string SvgStreamWriter::Flatten(bool xmlDeclaration)
+{
+    while (!m_stack.empty()) this->EndElement();
+
+    std::sort(m_fixups.begin(), m_fixups.end(), [](const Fixup &a, const Fixup &b) {
+        if (a.m_sink != b.m_sink) return (a.m_sink < b.m_sink);
+        if (a.m_offset != b.m_offset) return (a.m_offset < b.m_offset);
+        if (a.m_rank != b.m_rank) return (a.m_rank < b.m_rank);
+        return (a.m_order < b.m_order);
+    });
+
+    size_t size = 0;
+    for (const std::string &sink : m_sinks) size += sink.size();
+
+    std::string output;
+    output.reserve(size + 128);
+    if (xmlDeclaration) {
+        output.append("<?xml version=\"1.0\" encoding=\"UTF-8\" standalone=\"no\"?>");
+        if (!m_formatRaw) output.push_back('\n');
+    }
+    this->FlattenSink(0, output);
+    if (!m_formatRaw) output.push_back('\n');
+
+    return output;
+}
+
+void SvgStreamWriter::FlattenSink(int sink, std::string &output) const
+{
+    const std::string &source = m_sinks.at(sink);
+
+    auto it = std::lower_bound(m_fixups.begin(), m_fixups.end(), sink,
+        [](const Fixup &fixup, int value) { return (fixup.m_sink < value); });
+
+    size_t position = 0;
+    for (; (it != m_fixups.end()) && (it->m_sink == sink); ++it) {
+        if (it->m_offset > position) {
+            output.append(source, position, it->m_offset - position);
+            position = it->m_offset;
+        }
+        this->FlattenSink(it->m_content, output);
+        output.append(it->m_suffix);
+        position = std::max(position, it->m_offset + it->m_erase);
+    }
+    output.append(source, position, std::string::npos);
+}
+
 //----------------------------------------------------------------------------
 // SvgDeviceContext
 //----------------------------------------------------------------------------
@@ -51,30 +718,116 @@ SvgDeviceContext::SvgDeviceContext() : DeviceContext(SVG_DEVICE_CONTEXT)
     m_svgBoundingBoxes = false;
     m_svgViewBox = false;
     m_html5 = false;
-    m_formatRaw = false;
     m_removeXlink = false;
     m_facsimile = false;
+
+    m_streaming = false;
     m_indent = 2;
+    m_formatRaw = false;
+    this->CreateWriter();
 
-    // create the initial SVG element
-    // width and height need to be set later; these are taken care of in "commit"
-    m_svgNode = m_svgDoc.append_child("svg");
-    m_svgNode.append_attribute("version") = "1.1";
-    m_svgNode.append_attribute("xmlns") = "http://www.w3.org/2000/svg";
-    m_svgNode.append_attribute("xmlns:xlink") = "http://www.w3.org/1999/xlink";
-    m_svgNode.append_attribute("xmlns:mei") = "http://www.music-encoding.org/ns/mei";
-    m_svgNode.append_attribute("overflow") = "visible";
+    m_outdata.clear();
+
+    m_glyphPostfixId = Object::GenerateHashID();
+}
 
-    // start the stack
-    m_svgNodeStack.push_back(m_svgNode);
-    m_currentNode = m_svgNode;
+SvgDeviceContext::~SvgDeviceContext() {}
+
+void SvgDeviceContext::Reset()
+{
+    // DeviceContext state
+    this->ResetResources();
+    m_penStack = {};
+    m_brushStack = {};
+    m_fontStack = {};
+    m_isDeactivatedX = false;
+    m_isDeactivatedY = false;
+    m_pushBack = false;
+    this->SetWidth(0);
+    this->SetHeight(0);
+    this->SetContentHeight(0);
+    this->SetUserScale(1.0, 1.0);
+    this->SetBaseSize(0, 0);
+
+    m_originX = 0;
+    m_originY = 0;
+
+    this->SetBrush(AxNONE, AxSOLID);
+    this->SetPen(AxNONE, 1, AxSOLID);
+
+    m_smuflGlyphs.clear();
+
+    m_committed = false;
+    m_vrvTextFont = false;
+    m_vrvTextFontFallback = false;
+
+    m_mmOutput = false;
+    m_svgBoundingBoxes = false;
+    m_svgViewBox = false;
+    m_html5 = false;
+    m_removeXlink = false;
+    m_facsimile = false;
+    m_css.clear();
+    m_svgAdditionalAttributes.clear();
+
+    // keep the writer (and the streaming mode) but restore the default formatting
+    m_indent = 2;
+    m_formatRaw = false;
+    m_writer->Reset();
+    m_writer->SetIndent(m_indent);
+    m_writer->SetFormatRaw(m_formatRaw);
+    this->StartRootElement();
 
     m_outdata.clear();
 
+    // a new id, as for a new device context, so that the following ids are the same
     m_glyphPostfixId = Object::GenerateHashID();
 }
 
-SvgDeviceContext::~SvgDeviceContext() {}
+void SvgDeviceContext::SetStreaming(bool streaming)
+{
+    if (streaming == m_streaming) return;
+
+    m_streaming = streaming;
+    this->CreateWriter();
+}
+
+void SvgDeviceContext::SetIndent(int indent)
+{
+    m_indent = indent;
+    m_writer->SetIndent(indent);
+}
+
+void SvgDeviceContext::SetFormatRaw(bool rawFormat)
+{
+    m_formatRaw = rawFormat;
+    m_writer->SetFormatRaw(rawFormat);
+}
+
+void SvgDeviceContext::CreateWriter()
+{
+    if (m_streaming) {
+        m_writer = std::make_unique<SvgStreamWriter>();
+    }
+    else {
+        m_writer = std::make_unique<SvgDomWriter>();
+    }
+    m_writer->SetIndent(m_indent);
+    m_writer->SetFormatRaw(m_formatRaw);
+    this->StartRootElement();
+}
+
+void SvgDeviceContext::StartRootElement()
+{
+    // create the initial SVG element
+    // width and height need to be set later; these are taken care of in "commit"
+    m_writer->StartElement("svg");
+    m_writer->AddAttribute("version", "1.1");
+    m_writer->AddAttribute("xmlns", "http://www.w3.org/2000/svg");
+    m_writer->AddAttribute("xmlns:xlink", "http://www.w3.org/1999/xlink");
+    m_writer->AddAttribute("xmlns:mei", "http://www.music-encoding.org/ns/mei");
+    m_writer->AddAttribute("overflow", "visible");
+}
 
 bool SvgDeviceContext::CopyFileToStream(const std::string &filename, std::ostream &dest)
 {
@@ -91,17 +844,10 @@ void SvgDeviceContext::IncludeTextFont(const std::string &fontname, const Resour
     std::string cssContent;
 
     if (m_smuflTextFont == SMUFLTEXTFONT_embedded) {
-        const std::string cssFontPath = StringFormat("%s/%s.css", resources->GetPath().c_str(), fontname.c_str());
-        std::ifstream cssFontFile(cssFontPath);
-        if (!cssFontFile.is_open()) {
+        if (!resources->GetCSSFont(fontname, cssContent)) {
             LogWarning("The CSS font for '%s' could not be loaded and will not be embedded in the SVG",
                 resources->GetCurrentFontName().c_str());
         }
-        else {
-            std::stringstream cssFontStream;
-            cssFontStream << cssFontFile.rdbuf();
-            cssContent = cssFontStream.str();
-        }
     }
     else {
         std::string versionPath
@@ -110,9 +856,9 @@ void SvgDeviceContext::IncludeTextFont(const std::string &fontname, const Resour
             versionPath.c_str(), fontname.c_str());
     }
 
-    pugi::xml_node css = m_svgNode.append_child("style");
-    css.append_attribute("type") = "text/css";
-    css.text().set(cssContent.c_str());
+    m_writer->StartLeaf("style");
+    m_writer->AddAttribute("type", "text/css");
+    m_writer->SetLeafText(cssContent);
 }
 
 void SvgDeviceContext::Commit(bool xml_declaration)
@@ -144,11 +890,11 @@ void SvgDeviceContext::Commit(bool xml_declaration)
     }
 
     if (m_svgViewBox) {
-        m_svgNode.prepend_attribute("viewBox") = StringFormat("0 0 %g %g", width, height).c_str();
+        m_writer->PrependAttribute("viewBox", StringFormat("0 0 %g %g", width, height));
     }
     else {
-        m_svgNode.prepend_attribute("height") = StringFormat(format, height).c_str();
-        m_svgNode.prepend_attribute("width") = StringFormat(format, width).c_str();
+        m_writer->PrependAttribute("height", StringFormat(format, height));
+        m_writer->PrependAttribute("width", StringFormat(format, width));
     }
 
     // add the woff2 font if needed
@@ -167,45 +913,34 @@ void SvgDeviceContext::Commit(bool xml_declaration)
     // header
     if (m_smuflGlyphs.size() > 0) {
 
-        pugi::xml_node defs = m_svgNode.prepend_child("defs");
-        pugi::xml_document sourceDoc;
+        m_writer->StartElement("defs", SvgWriter::PREPEND);
+
+        // order the glyphs by code since the set is ordered by address and the glyphs can come from several fonts
+        std::vector<const Glyph *> smuflGlyphs(m_smuflGlyphs.begin(), m_smuflGlyphs.end());
+        std::stable_sort(smuflGlyphs.begin(), smuflGlyphs.end(),
+            [](const Glyph *a, const Glyph *b) { return a->GetCodeStr() < b->GetCodeStr(); });
 
         // for each needed glyph
-        for (const Glyph *smuflGlyph : m_smuflGlyphs) {
-            // load the XML file that contains it as a pugi::xml_document
-            std::ifstream source(smuflGlyph->GetPath());
-            sourceDoc.load(source);
+        for (const Glyph *smuflGlyph : smuflGlyphs) {
+            // get the XML file that contains it as a pugi::xml_document - loaded only once
+            const pugi::xml_document &sourceDoc = Resources::GetGlyphDefinition(smuflGlyph);
 
-            // copy all the nodes inside into the master document
+            // copy all the nodes inside into the output with the postfix added to their id
             for (pugi::xml_node child = sourceDoc.first_child(); child; child = child.next_sibling()) {
                 std::string id = StringFormat("%s-%s", child.attribute("id").value(), m_glyphPostfixId.c_str());
-                child.attribute("id").set_value(id.c_str());
-                defs.append_copy(child);
+                m_writer->AppendCopy(child, id.c_str());
             }
         }
-    }
 
-    unsigned int output_flags = pugi::format_default | pugi::format_no_declaration;
-    if (xml_declaration) {
-        // edit the xml declaration
-        output_flags = pugi::format_default;
-        pugi::xml_node decl = m_svgDoc.prepend_child(pugi::node_declaration);
-        decl.append_attribute("version") = "1.0";
-        decl.append_attribute("encoding") = "UTF-8";
-        decl.append_attribute("standalone") = "no";
-    }
-
-    if (m_formatRaw) {
-        output_flags |= pugi::format_raw;
+        m_writer->EndElement();
     }
 
     // add description statement
-    pugi::xml_node desc = m_svgNode.prepend_child("desc");
-    desc.text().set(StringFormat("Engraved by Verovio %s", GetVersion().c_str()).c_str());
+    m_writer->StartLeaf("desc", SvgWriter::PREPEND);
+    m_writer->SetLeafText(StringFormat("Engraved by Verovio %s", GetVersion().c_str()));
 
-    // save the glyph data to m_outdata
-    std::string indent = (m_indent == -1) ? "\t" : std::string(m_indent, ' ');
-    m_svgDoc.save(m_outdata, indent.c_str(), output_flags);
+    // write the document with the fixups and the xml declaration if necessary to m_outdata
+    m_outdata = m_writer->Flatten(xml_declaration);
 
     m_committed = true;
 }
@@ -223,13 +958,7 @@ void SvgDeviceContext::StartGraphic(
         }
     }
 
-    if (prepend) {
-        m_currentNode = m_currentNode.prepend_child("g");
-    }
-    else {
-        m_currentNode = m_currentNode.append_child("g");
-    }
-    m_svgNodeStack.push_back(m_currentNode);
+    m_writer->StartElement("g", (prepend) ? SvgWriter::PREPEND : SvgWriter::APPEND);
     AppendIdAndClass(gId, object->GetClassName(), gClassFull, graphicID);
     AppendAdditionalAttributes(object);
 
@@ -255,15 +984,15 @@ void SvgDeviceContext::StartGraphic(
             styleStr.append(
                 "font-weight:" + staff->AttTyped::FontweightToStr(staff->m_drawingStaffDef->GetLyricWeight()) + ";");
         }
-        if (!styleStr.empty()) m_currentNode.append_attribute("style") = styleStr.c_str();
+        if (!styleStr.empty()) m_writer->AddAttribute("style", styleStr.c_str());
     }
 
     if (object->HasAttClass(ATT_COLOR)) {
         AttColor *att = dynamic_cast<AttColor *>(object);
         assert(att);
         if (att->HasColor()) {
-            m_currentNode.append_attribute("color") = att->GetColor().c_str();
-            m_currentNode.append_attribute("fill") = att->GetColor().c_str();
+            m_writer->AddAttribute("color", att->GetColor().c_str());
+            m_writer->AddAttribute("fill", att->GetColor().c_str());
         }
     }
 
@@ -271,9 +1000,9 @@ void SvgDeviceContext::StartGraphic(
         AttLabelled *att = dynamic_cast<AttLabelled *>(object);
         assert(att);
         if (att->HasLabel()) {
-            pugi::xml_node svgTitle = m_currentNode.prepend_child("title");
-            svgTitle.append_attribute("class") = "labelAttr";
-            svgTitle.text().set(att->GetLabel().c_str());
+            m_writer->StartLeaf("title", SvgWriter::PREPEND);
+            m_writer->AddAttribute("class", "labelAttr");
+            m_writer->SetLeafText(att->GetLabel());
         }
     }
 
@@ -281,18 +1010,18 @@ void SvgDeviceContext::StartGraphic(
         AttLang *att = dynamic_cast<AttLang *>(object);
         assert(att);
         if (att->HasLang()) {
-            m_currentNode.append_attribute("xml:lang") = att->GetLang().c_str();
+            m_writer->AddAttribute("xml:lang", att->GetLang().c_str());
         }
     }
 
     if (object->HasAttClass(ATT_TYPOGRAPHY)) {
         AttTypography *att = dynamic_cast<AttTypography *>(object);
         assert(att);
-        if (att->HasFontname()) m_currentNode.append_attribute("font-family") = att->GetFontname().c_str();
+        if (att->HasFontname()) m_writer->AddAttribute("font-family", att->GetFontname().c_str());
         if (att->HasFontstyle())
-            m_currentNode.append_attribute("font-style") = att->FontstyleToStr(att->GetFontstyle()).c_str();
+            m_writer->AddAttribute("font-style", att->FontstyleToStr(att->GetFontstyle()).c_str());
         if (att->HasFontweight())
-            m_currentNode.append_attribute("font-weight") = att->FontweightToStr(att->GetFontweight()).c_str();
+            m_writer->AddAttribute("font-weight", att->FontweightToStr(att->GetFontweight()).c_str());
     }
 
     if (object->HasAttClass(ATT_VISIBILITY)) {
@@ -300,10 +1029,10 @@ void SvgDeviceContext::StartGraphic(
         assert(att);
         if (att->HasVisible()) {
             if (att->GetVisible() == BOOLEAN_true) {
-                m_currentNode.append_attribute("visibility") = "visible";
+                m_writer->AddAttribute("visibility", "visible");
             }
             else if (att->GetVisible() == BOOLEAN_false) {
-                m_currentNode.append_attribute("visibility") = "hidden";
+                m_writer->AddAttribute("visibility", "hidden");
             }
         }
     }
@@ -312,46 +1041,44 @@ void SvgDeviceContext::StartGraphic(
         AttLinking *att = dynamic_cast<AttLinking *>(object);
         assert(att);
         if (att->HasFollows()) {
-            m_currentNode.append_attribute("mei:follows") = att->GetFollows().c_str();
+            m_writer->AddAttribute("mei:follows", att->GetFollows().c_str());
         }
         if (att->HasPrecedes()) {
-            m_currentNode.append_attribute("mei:precedes") = att->GetPrecedes().c_str();
+            m_writer->AddAttribute("mei:precedes", att->GetPrecedes().c_str());
         }
     }
 
-    // m_currentNode.append_attribute("style") = StringFormat("stroke: #%s; stroke-opacity: %f; fill: #%s; fill-opacity:
+    // m_writer->AddAttribute("style", StringFormat("stroke: #%s; stroke-opacity: %f; fill: #%s; fill-opacity:
     // %f;",
     // this->GetColor(currentPen.GetColor()).c_str(), currentPen.GetOpacity(),
-    // this->GetColor(currentBrush.GetColor()).c_str(), currentBrush.GetOpacity()).c_str();
+    // this->GetColor(currentBrush.GetColor()).c_str(), currentBrush.GetOpacity()).c_str());
 }
 
 void SvgDeviceContext::StartCustomGraphic(const std::string &name, std::string gClass, std::string gId)
 {
-    m_currentNode = m_currentNode.append_child("g");
-    m_svgNodeStack.push_back(m_currentNode);
+    m_writer->StartElement("g");
     AppendIdAndClass(gId, name, gClass);
 }
 
 void SvgDeviceContext::StartTextGraphic(Object *object, const std::string &gClass, const std::string &gId)
 {
-    m_currentNode = AddChild("tspan");
-    m_svgNodeStack.push_back(m_currentNode);
+    m_writer->StartElement("tspan", this->GetChildPosition());
     AppendIdAndClass(gId, object->GetClassName(), gClass);
     AppendAdditionalAttributes(object);
 
     if (object->HasAttClass(ATT_COLOR)) {
         AttColor *att = dynamic_cast<AttColor *>(object);
         assert(att);
-        if (att->HasColor()) m_currentNode.append_attribute("fill") = att->GetColor().c_str();
+        if (att->HasColor()) m_writer->AddAttribute("fill", att->GetColor().c_str());
     }
 
     if (object->HasAttClass(ATT_LABELLED)) {
         AttLabelled *att = dynamic_cast<AttLabelled *>(object);
         assert(att);
         if (att->HasLabel()) {
-            pugi::xml_node svgTitle = m_currentNode.prepend_child("title");
-            svgTitle.append_attribute("class") = "labelAttr";
-            svgTitle.text().set(att->GetLabel().c_str());
+            m_writer->StartLeaf("title", SvgWriter::PREPEND);
+            m_writer->AddAttribute("class", "labelAttr");
+            m_writer->SetLeafText(att->GetLabel());
         }
     }
 
@@ -359,25 +1086,25 @@ void SvgDeviceContext::StartTextGraphic(Object *object, const std::string &gClas
         AttLang *att = dynamic_cast<AttLang *>(object);
         assert(att);
         if (att->HasLang()) {
-            m_currentNode.append_attribute("xml:lang") = att->GetLang().c_str();
+            m_writer->AddAttribute("xml:lang", att->GetLang().c_str());
         }
     }
 
     if (object->HasAttClass(ATT_TYPOGRAPHY)) {
         AttTypography *att = dynamic_cast<AttTypography *>(object);
         assert(att);
-        if (att->HasFontname()) m_currentNode.append_attribute("font-family") = att->GetFontname().c_str();
+        if (att->HasFontname()) m_writer->AddAttribute("font-family", att->GetFontname().c_str());
         if (att->HasFontstyle())
-            m_currentNode.append_attribute("font-style") = att->FontstyleToStr(att->GetFontstyle()).c_str();
+            m_writer->AddAttribute("font-style", att->FontstyleToStr(att->GetFontstyle()).c_str());
         if (att->HasFontweight())
-            m_currentNode.append_attribute("font-weight") = att->FontweightToStr(att->GetFontweight()).c_str();
+            m_writer->AddAttribute("font-weight", att->FontweightToStr(att->GetFontweight()).c_str());
     }
 
     if (object->HasAttClass(ATT_WHITESPACE)) {
         AttWhitespace *att = dynamic_cast<AttWhitespace *>(object);
         assert(att);
         if (att->HasSpace()) {
-            m_currentNode.append_attribute("xml:space") = att->GetSpace().c_str();
+            m_writer->AddAttribute("xml:space", att->GetSpace().c_str());
             ;
         }
     }
@@ -385,54 +1112,46 @@ void SvgDeviceContext::StartTextGraphic(Object *object, const std::string &gClas
 
 void SvgDeviceContext::ResumeGraphic(Object *object, std::string gId)
 {
-    std::string xpathPrefix = m_html5 ? "//g[@data-id=\"" : "//g[@id=\"";
-    std::string xpath = xpathPrefix + gId + "\"]";
-    pugi::xpath_node selection = m_currentNode.select_node(xpath.c_str());
-    if (selection) {
-        m_currentNode = selection.node();
-    }
-    m_svgNodeStack.push_back(m_currentNode);
+    m_writer->ResumeElement(gId);
 }
 
 void SvgDeviceContext::EndGraphic(Object *object, View *view)
 {
     this->DrawSvgBoundingBox(object, view);
-    m_svgNodeStack.pop_back();
-    m_currentNode = m_svgNodeStack.back();
+    m_writer->EndElement();
 }
 
 void SvgDeviceContext::EndCustomGraphic()
 {
-    m_svgNodeStack.pop_back();
-    m_currentNode = m_svgNodeStack.back();
+    m_writer->EndElement();
 }
 
 void SvgDeviceContext::SetCustomGraphicColor(const std::string &color)
 {
-    m_currentNode.append_attribute("color") = color.c_str();
-    m_currentNode.append_attribute("fill") = color.c_str();
+    m_writer->CloseLeaf();
+    m_writer->AddAttribute("color", color.c_str());
+    m_writer->AddAttribute("fill", color.c_str());
 }
 
 void SvgDeviceContext::EndResumedGraphic(Object *object, View *view)
 {
-    m_svgNodeStack.pop_back();
-    m_currentNode = m_svgNodeStack.back();
+    m_writer->EndResumedElement();
 }
 
 void SvgDeviceContext::EndTextGraphic(Object *object, View *view)
 {
     this->DrawSvgBoundingBox(object, view);
-    m_svgNodeStack.pop_back();
-    m_currentNode = m_svgNodeStack.back();
+    m_writer->EndElement();
 }
 
 void SvgDeviceContext::RotateGraphic(Point const &orig, double angle)
 {
-    if (m_currentNode.attribute("transform")) {
+    m_writer->CloseLeaf();
+    if (m_writer->HasTransform()) {
         return;
     }
 
-    m_currentNode.append_attribute("transform") = StringFormat("rotate(%f %d,%d)", angle, orig.x, orig.y).c_str();
+    m_writer->AddAttribute("transform", StringFormat("rotate(%f %d,%d)", angle, orig.x, orig.y));
 }
 
 void SvgDeviceContext::StartPage()
@@ -443,72 +1162,60 @@ void SvgDeviceContext::StartPage()
 
     // default styles
     if (this->UseGlobalStyling()) {
-        m_currentNode = m_currentNode.append_child("style");
-        m_currentNode.append_attribute("type") = "text/css";
-        m_currentNode.text().set("g.page-margin{font-family:Times,serif;} "
-                                 //"g.page-margin{background: pink;} "
-                                 //"g.bounding-box{stroke:red; stroke-width:10} "
-                                 //"g.content-bounding-box{stroke:blue; stroke-width:10} "
-                                 "g.ending, g.fing, g.reh, g.tempo{font-weight:bold;} g.dir, g.dynam, "
-                                 "g.mNum{font-style:italic;} g.label{font-weight:normal;}");
-        m_currentNode = m_svgNodeStack.back();
+        m_writer->StartLeaf("style");
+        m_writer->AddAttribute("type", "text/css");
+        m_writer->SetLeafText("g.page-margin{font-family:Times,serif;} "
+                             //"g.page-margin{background: pink;} "
+                             //"g.bounding-box{stroke:red; stroke-width:10} "
+                             //"g.content-bounding-box{stroke:blue; stroke-width:10} "
+                             "g.ending, g.fing, g.reh, g.tempo{font-weight:bold;} g.dir, g.dynam, "
+                             "g.mNum{font-style:italic;} g.label{font-weight:normal;}");
     }
 
     if (!m_css.empty()) {
-        m_currentNode = m_currentNode.append_child("style");
-        m_currentNode.append_attribute("type") = "text/css";
-        m_currentNode.text().set(m_css.c_str());
-        m_currentNode = m_svgNodeStack.back();
+        m_writer->StartLeaf("style");
+        m_writer->AddAttribute("type", "text/css");
+        m_writer->SetLeafText(m_css);
     }
 
     // a graphic for definition scaling
-    m_currentNode = m_currentNode.append_child("svg");
-    m_svgNodeStack.push_back(m_currentNode);
-    m_currentNode.append_attribute("class") = "definition-scale";
-    m_currentNode.append_attribute("color") = "black";
+    m_writer->StartElement("svg");
+    m_writer->AddAttribute("class", "definition-scale");
+    m_writer->AddAttribute("color", "black");
     if (this->GetFacsimile()) {
-        m_currentNode.append_attribute("viewBox")
-            = StringFormat("0 0 %d %d", this->GetWidth(), this->GetHeight()).c_str();
+        m_writer->AddAttribute("viewBox", StringFormat("0 0 %d %d", this->GetWidth(), this->GetHeight()));
     }
     else {
-        m_currentNode.append_attribute("viewBox") = StringFormat(
-            "0 0 %d %d", this->GetWidth() * DEFINITION_FACTOR, this->GetContentHeight() * DEFINITION_FACTOR)
-                                                        .c_str();
+        m_writer->AddAttribute("viewBox",
+            StringFormat(
+                "0 0 %d %d", this->GetWidth() * DEFINITION_FACTOR, this->GetContentHeight() * DEFINITION_FACTOR));
     }
 
     // page rectangle - for debugging
-    // pugi::xml_node pageRect = m_currentNode.append_child("rect");
-    // pageRect.append_attribute("fill") = "pink";
-    // pageRect.append_attribute("height") = StringFormat("%d", this->GetHeight()* DEFINITION_FACTOR).c_str();
-    // pageRect.append_attribute("width") = StringFormat("%d", this->GetWidth() * DEFINITION_FACTOR).c_str();
+    // m_writer->StartLeaf("rect");
+    // m_writer->AddAttribute("fill", "pink");
+    // m_writer->AddAttribute("height", this->GetHeight() * DEFINITION_FACTOR);
+    // m_writer->AddAttribute("width", this->GetWidth() * DEFINITION_FACTOR);
 
     // a graphic for the origin
-    m_currentNode = m_currentNode.append_child("g");
-    m_svgNodeStack.push_back(m_currentNode);
-    m_currentNode.append_attribute("class") = "page-margin";
-    m_currentNode.append_attribute("transform")
-        = StringFormat("translate(%d, %d)", (int)((double)m_originX), (int)((double)m_originY)).c_str();
+    m_writer->StartElement("g");
+    m_writer->AddAttribute("class", "page-margin");
+    m_writer->AddAttribute(
+        "transform", StringFormat("translate(%d, %d)", (int)((double)m_originX), (int)((double)m_originY)));
 
     // margin rectangle - for debugging
-    // pugi::xml_node marginRect = m_currentNode.append_child("rect");
-    // marginRect.append_attribute("fill") = "yellow";
-    // marginRect.append_attribute("height") = StringFormat("%d", this->GetHeight() * DEFINITION_FACTOR - 2 *
-    // m_originY).c_str();
-    // marginRect.append_attribute("width") = StringFormat("%d", this->GetWidth() * DEFINITION_FACTOR - 2
-    //* m_originX).c_str();
-
-    m_pageNode = m_currentNode;
+    // m_writer->StartLeaf("rect");
+    // m_writer->AddAttribute("fill", "yellow");
+    // m_writer->AddAttribute("height", this->GetHeight() * DEFINITION_FACTOR - 2 * m_originY);
+    // m_writer->AddAttribute("width", this->GetWidth() * DEFINITION_FACTOR - 2 * m_originX);
 }
 
 void SvgDeviceContext::EndPage()
 {
     // end page-margin
-    m_svgNodeStack.pop_back();
+    m_writer->EndElement();
     // end definition-scale
-    m_svgNodeStack.pop_back();
-    // end page-scale
-    // m_svgNodeStack.pop_back();
-    m_currentNode = m_svgNodeStack.back();
+    m_writer->EndElement();
 }
 
 void SvgDeviceContext::SetBackground(int color, int style)
@@ -544,96 +1251,99 @@ Point SvgDeviceContext::GetLogicalOrigin()
     return Point(m_originX, m_originY);
 }
 
-pugi::xml_node SvgDeviceContext::AddChild(std::string name)
+SvgWriter::Position SvgDeviceContext::GetChildPosition() const
 {
-    pugi::xml_node g = m_currentNode.child("g");
-    if (g) {
-        return m_currentNode.insert_child_before(name.c_str(), g);
+    if (m_writer->HasGroupChild()) {
+        return SvgWriter::BEFORE_GROUP;
     }
     else {
-        return (m_pushBack) ? m_currentNode.prepend_child(name.c_str()) : m_currentNode.append_child(name.c_str());
+        return (m_pushBack) ? SvgWriter::PREPEND : SvgWriter::APPEND;
     }
 }
 
-void SvgDeviceContext::AppendStrokeLineCap(pugi::xml_node node, const Pen &pen)
+void SvgDeviceContext::AddChild(const std::string &name)
+{
+    m_writer->StartLeaf(name, this->GetChildPosition());
+}
+
+void SvgDeviceContext::AppendStrokeLineCap(const Pen &pen)
 {
     switch (pen.GetLineCap()) {
-        case AxCAP_BUTT: node.append_attribute("stroke-linecap") = "butt"; break;
-        case AxCAP_ROUND: node.append_attribute("stroke-linecap") = "round"; break;
-        case AxCAP_SQUARE: node.append_attribute("stroke-linecap") = "square"; break;
+        case AxCAP_BUTT: m_writer->AddAttribute("stroke-linecap", "butt"); break;
+        case AxCAP_ROUND: m_writer->AddAttribute("stroke-linecap", "round"); break;
+        case AxCAP_SQUARE: m_writer->AddAttribute("stroke-linecap", "square"); break;
         default: break;
     }
 }
 
-void SvgDeviceContext::AppendStrokeLineJoin(pugi::xml_node node, const Pen &pen)
+void SvgDeviceContext::AppendStrokeLineJoin(const Pen &pen)
 {
     switch (pen.GetLineJoin()) {
-        case AxJOIN_ARCS: node.append_attribute("stroke-linejoin") = "arcs"; break;
-        case AxJOIN_BEVEL: node.append_attribute("stroke-linejoin") = "bevel"; break;
-        case AxJOIN_MITER: node.append_attribute("stroke-linejoin") = "miter"; break;
-        case AxJOIN_MITER_CLIP: node.append_attribute("stroke-linejoin") = "miter-clip"; break;
-        case AxJOIN_ROUND: node.append_attribute("stroke-linejoin") = "round"; break;
+        case AxJOIN_ARCS: m_writer->AddAttribute("stroke-linejoin", "arcs"); break;
+        case AxJOIN_BEVEL: m_writer->AddAttribute("stroke-linejoin", "bevel"); break;
+        case AxJOIN_MITER: m_writer->AddAttribute("stroke-linejoin", "miter"); break;
+        case AxJOIN_MITER_CLIP: m_writer->AddAttribute("stroke-linejoin", "miter-clip"); break;
+        case AxJOIN_ROUND: m_writer->AddAttribute("stroke-linejoin", "round"); break;
         default: break;
     }
 }
 
-void SvgDeviceContext::AppendStrokeDashArray(pugi::xml_node node, const Pen &pen)
+void SvgDeviceContext::AppendStrokeDashArray(const Pen &pen)
 {
     if (pen.GetDashLength() > 0) {
         const int dashLength = pen.GetDashLength();
         const int gapLength = (pen.GetGapLength() > 0) ? pen.GetGapLength() : dashLength;
-        node.append_attribute("stroke-dasharray") = StringFormat("%d %d", dashLength, gapLength).c_str();
+        m_writer->AddAttribute("stroke-dasharray", StringFormat("%d %d", dashLength, gapLength).c_str());
     }
 }
 
 // Drawing methods
 void SvgDeviceContext::DrawQuadBezierPath(Point bezier[3])
 {
-    pugi::xml_node pathChild = AddChild("path");
-    pathChild.append_attribute("d") = StringFormat("M%d,%d Q%d,%d %d,%d", // Base string
-        bezier[0].x, bezier[0].y, // M Command
-        bezier[1].x, bezier[1].y, bezier[2].x, bezier[2].y)
-                                          .c_str();
-    pathChild.append_attribute("fill") = "none";
-    pathChild.append_attribute("stroke") = this->GetColor(m_penStack.top().GetColor()).c_str();
-    pathChild.append_attribute("stroke-linecap") = "round";
-    pathChild.append_attribute("stroke-linejoin") = "round";
-    pathChild.append_attribute("stroke-width") = m_penStack.top().GetWidth();
-    this->AppendStrokeDashArray(pathChild, m_penStack.top());
+    this->AddChild("path");
+    m_writer->AddAttribute("d",
+        StringFormat("M%d,%d Q%d,%d %d,%d", // Base string
+            bezier[0].x, bezier[0].y, // M Command
+            bezier[1].x, bezier[1].y, bezier[2].x, bezier[2].y));
+    m_writer->AddAttribute("fill", "none");
+    m_writer->AddAttribute("stroke", this->GetColor(m_penStack.top().GetColor()).c_str());
+    m_writer->AddAttribute("stroke-linecap", "round");
+    m_writer->AddAttribute("stroke-linejoin", "round");
+    m_writer->AddAttribute("stroke-width", m_penStack.top().GetWidth());
+    this->AppendStrokeDashArray(m_penStack.top());
 }
 
 void SvgDeviceContext::DrawCubicBezierPath(Point bezier[4])
 {
-    pugi::xml_node pathChild = AddChild("path");
-    pathChild.append_attribute("d") = StringFormat("M%d,%d C%d,%d %d,%d %d,%d", // Base string
-        bezier[0].x, bezier[0].y, // M Command
-        bezier[1].x, bezier[1].y, bezier[2].x, bezier[2].y, bezier[3].x, bezier[3].y // Remaining bezier points.
-        )
-                                          .c_str();
-    pathChild.append_attribute("fill") = "none";
-    pathChild.append_attribute("stroke") = this->GetColor(m_penStack.top().GetColor()).c_str();
-    pathChild.append_attribute("stroke-linecap") = "round";
-    pathChild.append_attribute("stroke-linejoin") = "round";
-    pathChild.append_attribute("stroke-width") = m_penStack.top().GetWidth();
-    this->AppendStrokeDashArray(pathChild, m_penStack.top());
+    this->AddChild("path");
+    m_writer->AddAttribute("d",
+        StringFormat("M%d,%d C%d,%d %d,%d %d,%d", // Base string
+            bezier[0].x, bezier[0].y, // M Command
+            bezier[1].x, bezier[1].y, bezier[2].x, bezier[2].y, bezier[3].x, bezier[3].y // Remaining bezier points.
+            ));
+    m_writer->AddAttribute("fill", "none");
+    m_writer->AddAttribute("stroke", this->GetColor(m_penStack.top().GetColor()).c_str());
+    m_writer->AddAttribute("stroke-linecap", "round");
+    m_writer->AddAttribute("stroke-linejoin", "round");
+    m_writer->AddAttribute("stroke-width", m_penStack.top().GetWidth());
+    this->AppendStrokeDashArray(m_penStack.top());
 }
 
 void SvgDeviceContext::DrawCubicBezierPathFilled(Point bezier1[4], Point bezier2[4])
 {
-    pugi::xml_node pathChild = AddChild("path");
-    pathChild.append_attribute("d")
-        = StringFormat("M%d,%d C%d,%d %d,%d %d,%d C%d,%d %d,%d %d,%d", bezier1[0].x, bezier1[0].y, // M command
+    this->AddChild("path");
+    m_writer->AddAttribute("d",
+        StringFormat("M%d,%d C%d,%d %d,%d %d,%d C%d,%d %d,%d %d,%d", bezier1[0].x, bezier1[0].y, // M command
             bezier1[1].x, bezier1[1].y, bezier1[2].x, bezier1[2].y, bezier1[3].x, bezier1[3].y, // First bezier
             bezier2[2].x, bezier2[2].y, bezier2[1].x, bezier2[1].y, bezier2[0].x, bezier2[0].y // Second Bezier
-            )
-              .c_str();
-    // pathChild.append_attribute("fill") = "currentColor";
-    // pathChild.append_attribute("fill-opacity") = "1";
-    pathChild.append_attribute("stroke") = this->GetColor(m_penStack.top().GetColor()).c_str();
-    pathChild.append_attribute("stroke-linecap") = "round";
-    pathChild.append_attribute("stroke-linejoin") = "round";
-    // pathChild.append_attribute("stroke-opacity") = "1";
-    pathChild.append_attribute("stroke-width") = m_penStack.top().GetWidth();
+            ));
+    // m_writer->AddAttribute("fill", "currentColor");
+    // m_writer->AddAttribute("fill-opacity", "1");
+    m_writer->AddAttribute("stroke", this->GetColor(m_penStack.top().GetColor()).c_str());
+    m_writer->AddAttribute("stroke-linecap", "round");
+    m_writer->AddAttribute("stroke-linejoin", "round");
+    // m_writer->AddAttribute("stroke-opacity", "1");
+    m_writer->AddAttribute("stroke-width", m_penStack.top().GetWidth());
 }
 
 void SvgDeviceContext::DrawCircle(int x, int y, int radius)
@@ -652,16 +1362,16 @@ void SvgDeviceContext::DrawEllipse(int x, int y, int width, int height)
     int rh = height / 2;
     int rw = width / 2;
 
-    pugi::xml_node ellipseChild = AddChild("ellipse");
-    ellipseChild.append_attribute("cx") = x + rw;
-    ellipseChild.append_attribute("cy") = y + rh;
-    ellipseChild.append_attribute("rx") = rw;
-    ellipseChild.append_attribute("ry") = rh;
-    if (currentBrush.GetOpacity() != 1.0) ellipseChild.append_attribute("fill-opacity") = currentBrush.GetOpacity();
-    if (currentPen.GetOpacity() != 1.0) ellipseChild.append_attribute("stroke-opacity") = currentPen.GetOpacity();
+    this->AddChild("ellipse");
+    m_writer->AddAttribute("cx", x + rw);
+    m_writer->AddAttribute("cy", y + rh);
+    m_writer->AddAttribute("rx", rw);
+    m_writer->AddAttribute("ry", rh);
+    if (currentBrush.GetOpacity() != 1.0) m_writer->AddAttribute("fill-opacity", currentBrush.GetOpacity());
+    if (currentPen.GetOpacity() != 1.0) m_writer->AddAttribute("stroke-opacity", currentPen.GetOpacity());
     if (currentPen.GetWidth() > 0) {
-        ellipseChild.append_attribute("stroke-width") = currentPen.GetWidth();
-        ellipseChild.append_attribute("stroke") = this->GetColor(m_penStack.top().GetColor()).c_str();
+        m_writer->AddAttribute("stroke-width", currentPen.GetWidth());
+        m_writer->AddAttribute("stroke", this->GetColor(m_penStack.top().GetColor()).c_str());
     }
 }
 
@@ -715,27 +1425,27 @@ void SvgDeviceContext::DrawEllipticArc(int x, int y, int width, int height, doub
 
     int fSweep = (fabs(theta2 - theta1) > M_PI) ? 1 : 0;
 
-    pugi::xml_node pathChild = AddChild("path");
-    pathChild.append_attribute("d") = StringFormat(
-        "M%d %d A%d %d 0.0 %d %d %d %d", int(xs), int(ys), abs(int(rx)), abs(int(ry)), fArc, fSweep, int(xe), int(ye))
-                                          .c_str();
-    // pathChild.append_attribute("fill") = "currentColor";
-    if (currentBrush.GetOpacity() != 1.0) pathChild.append_attribute("fill-opacity") = currentBrush.GetOpacity();
-    if (currentPen.GetOpacity() != 1.0) pathChild.append_attribute("stroke-opacity") = currentPen.GetOpacity();
+    this->AddChild("path");
+    m_writer->AddAttribute("d",
+        StringFormat("M%d %d A%d %d 0.0 %d %d %d %d", int(xs), int(ys), abs(int(rx)), abs(int(ry)), fArc, fSweep,
+            int(xe), int(ye)));
+    // m_writer->AddAttribute("fill", "currentColor");
+    if (currentBrush.GetOpacity() != 1.0) m_writer->AddAttribute("fill-opacity", currentBrush.GetOpacity());
+    if (currentPen.GetOpacity() != 1.0) m_writer->AddAttribute("stroke-opacity", currentPen.GetOpacity());
     if (currentPen.GetWidth() > 0) {
-        pathChild.append_attribute("stroke-width") = currentPen.GetWidth();
-        pathChild.append_attribute("stroke") = this->GetColor(m_penStack.top().GetColor()).c_str();
+        m_writer->AddAttribute("stroke-width", currentPen.GetWidth());
+        m_writer->AddAttribute("stroke", this->GetColor(m_penStack.top().GetColor()).c_str());
     }
 }
 
 void SvgDeviceContext::DrawLine(int x1, int y1, int x2, int y2)
 {
-    pugi::xml_node pathChild = AddChild("path");
-    pathChild.append_attribute("d") = StringFormat("M%d %d L%d %d", x1, y1, x2, y2).c_str();
-    pathChild.append_attribute("stroke") = this->GetColor(m_penStack.top().GetColor()).c_str();
-    if (m_penStack.top().GetWidth() > 1) pathChild.append_attribute("stroke-width") = m_penStack.top().GetWidth();
-    this->AppendStrokeLineCap(pathChild, m_penStack.top());
-    this->AppendStrokeDashArray(pathChild, m_penStack.top());
+    this->AddChild("path");
+    m_writer->AddAttribute("d", StringFormat("M%d %d L%d %d", x1, y1, x2, y2).c_str());
+    m_writer->AddAttribute("stroke", this->GetColor(m_penStack.top().GetColor()).c_str());
+    if (m_penStack.top().GetWidth() > 1) m_writer->AddAttribute("stroke-width", m_penStack.top().GetWidth());
+    this->AppendStrokeLineCap(m_penStack.top());
+    this->AppendStrokeDashArray(m_penStack.top());
 }
 
 void SvgDeviceContext::DrawPolyline(int n, Point points[], int xOffset, int yOffset)
@@ -743,29 +1453,29 @@ void SvgDeviceContext::DrawPolyline(int n, Point points[], int xOffset, int yOff
     assert(m_penStack.size());
     const Pen &currentPen = m_penStack.top();
 
-    pugi::xml_node polylineChild = AddChild("polyline");
+    this->AddChild("polyline");
 
     if (currentPen.GetWidth() > 0) {
-        polylineChild.append_attribute("stroke") = this->GetColor(currentPen.GetColor()).c_str();
+        m_writer->AddAttribute("stroke", this->GetColor(currentPen.GetColor()).c_str());
     }
     if (currentPen.GetWidth() > 1) {
-        polylineChild.append_attribute("stroke-width") = StringFormat("%d", currentPen.GetWidth()).c_str();
+        m_writer->AddAttribute("stroke-width", StringFormat("%d", currentPen.GetWidth()).c_str());
     }
     if (currentPen.GetOpacity() != 1.0) {
-        polylineChild.append_attribute("stroke-opacity") = StringFormat("%f", currentPen.GetOpacity()).c_str();
+        m_writer->AddAttribute("stroke-opacity", StringFormat("%f", currentPen.GetOpacity()).c_str());
     }
 
-    this->AppendStrokeLineCap(polylineChild, currentPen);
-    this->AppendStrokeLineJoin(polylineChild, currentPen);
-    this->AppendStrokeDashArray(polylineChild, currentPen);
+    this->AppendStrokeLineCap(currentPen);
+    this->AppendStrokeLineJoin(currentPen);
+    this->AppendStrokeDashArray(currentPen);
 
-    if (n > 2) polylineChild.append_attribute("fill") = "none";
+    if (n > 2) m_writer->AddAttribute("fill", "none");
 
     std::string pointsString;
     for (int i = 0; i < n; ++i) {
         pointsString += StringFormat("%d,%d ", points[i].x + xOffset, points[i].y + yOffset);
     }
-    polylineChild.append_attribute("points") = pointsString.c_str();
+    m_writer->AddAttribute("points", pointsString.c_str());
 }
 
 void SvgDeviceContext::DrawPolygon(int n, Point points[], int xOffset, int yOffset)
@@ -776,31 +1486,31 @@ void SvgDeviceContext::DrawPolygon(int n, Point points[], int xOffset, int yOffs
     const Pen &currentPen = m_penStack.top();
     const Brush &currentBrush = m_brushStack.top();
 
-    pugi::xml_node polygonChild = AddChild("polygon");
+    this->AddChild("polygon");
 
     if (currentPen.GetWidth() > 0) {
-        polygonChild.append_attribute("stroke") = this->GetColor(currentPen.GetColor()).c_str();
+        m_writer->AddAttribute("stroke", this->GetColor(currentPen.GetColor()).c_str());
     }
     if (currentPen.GetWidth() > 1) {
-        polygonChild.append_attribute("stroke-width") = StringFormat("%d", currentPen.GetWidth()).c_str();
+        m_writer->AddAttribute("stroke-width", StringFormat("%d", currentPen.GetWidth()).c_str());
     }
     if (currentPen.GetOpacity() != 1.0) {
-        polygonChild.append_attribute("stroke-opacity") = StringFormat("%f", currentPen.GetOpacity()).c_str();
+        m_writer->AddAttribute("stroke-opacity", StringFormat("%f", currentPen.GetOpacity()).c_str());
     }
 
-    this->AppendStrokeLineJoin(polygonChild, currentPen);
-    this->AppendStrokeDashArray(polygonChild, currentPen);
+    this->AppendStrokeLineJoin(currentPen);
+    this->AppendStrokeDashArray(currentPen);
 
     if (currentBrush.GetColor() != AxNONE)
-        polygonChild.append_attribute("fill") = this->GetColor(currentBrush.GetColor()).c_str();
+        m_writer->AddAttribute("fill", this->GetColor(currentBrush.GetColor()).c_str());
     if (currentBrush.GetOpacity() != 1.0)
-        polygonChild.append_attribute("fill-opacity") = StringFormat("%f", currentBrush.GetOpacity()).c_str();
+        m_writer->AddAttribute("fill-opacity", StringFormat("%f", currentBrush.GetOpacity()).c_str());
 
     std::string pointsString = StringFormat("%d,%d", points[0].x + xOffset, points[0].y + yOffset);
     for (int i = 1; i < n; ++i) {
         pointsString += " " + StringFormat("%d,%d", points[i].x + xOffset, points[i].y + yOffset);
     }
-    polygonChild.append_attribute("points") = pointsString.c_str();
+    m_writer->AddAttribute("points", pointsString.c_str());
 }
 
 void SvgDeviceContext::DrawRectangle(int x, int y, int width, int height)
@@ -810,24 +1520,24 @@ void SvgDeviceContext::DrawRectangle(int x, int y, int width, int height)
 
 void SvgDeviceContext::DrawRoundedRectangle(int x, int y, int width, int height, int radius)
 {
-    pugi::xml_node rectChild = AddChild("rect");
+    this->AddChild("rect");
 
     if (m_penStack.size()) {
         Pen currentPen = m_penStack.top();
         if (currentPen.GetWidth() > 0)
-            rectChild.append_attribute("stroke") = this->GetColor(currentPen.GetColor()).c_str();
+            m_writer->AddAttribute("stroke", this->GetColor(currentPen.GetColor()).c_str());
         if (currentPen.GetWidth() > 1)
-            rectChild.append_attribute("stroke-width") = StringFormat("%d", currentPen.GetWidth()).c_str();
+            m_writer->AddAttribute("stroke-width", StringFormat("%d", currentPen.GetWidth()).c_str());
         if (currentPen.GetOpacity() != 1.0)
-            rectChild.append_attribute("stroke-opacity") = StringFormat("%f", currentPen.GetOpacity()).c_str();
+            m_writer->AddAttribute("stroke-opacity", StringFormat("%f", currentPen.GetOpacity()).c_str());
     }
 
     if (m_brushStack.size()) {
         Brush currentBrush = m_brushStack.top();
         if (currentBrush.GetColor() != AxNONE)
-            rectChild.append_attribute("fill") = this->GetColor(currentBrush.GetColor()).c_str();
+            m_writer->AddAttribute("fill", this->GetColor(currentBrush.GetColor()).c_str());
         if (currentBrush.GetOpacity() != 1.0)
-            rectChild.append_attribute("fill-opacity") = StringFormat("%f", currentBrush.GetOpacity()).c_str();
+            m_writer->AddAttribute("fill-opacity", StringFormat("%f", currentBrush.GetOpacity()).c_str());
     }
 
     // negative heights or widths are not allowed in SVG
@@ -840,11 +1550,11 @@ void SvgDeviceContext::DrawRoundedRectangle(int x, int y, int width, int height,
         x -= width;
     }
 
-    rectChild.append_attribute("x") = x;
-    rectChild.append_attribute("y") = y;
-    rectChild.append_attribute("height") = height;
-    rectChild.append_attribute("width") = width;
-    if (radius != 0) rectChild.append_attribute("rx") = radius;
+    m_writer->AddAttribute("x", x);
+    m_writer->AddAttribute("y", y);
+    m_writer->AddAttribute("height", height);
+    m_writer->AddAttribute("width", width);
+    if (radius != 0) m_writer->AddAttribute("rx", radius);
 }
 
 void SvgDeviceContext::StartText(int x, int y, data_HORIZONTALALIGNMENT alignment)
@@ -859,45 +1569,45 @@ void SvgDeviceContext::StartText(int x, int y, data_HORIZONTALALIGNMENT alignmen
         anchor = "middle";
     }
 
-    m_currentNode = m_currentNode.append_child("text");
-    m_svgNodeStack.push_back(m_currentNode);
-    if (x) m_currentNode.append_attribute("x") = x;
-    if (y) m_currentNode.append_attribute("y") = y;
+    m_writer->StartElement("text");
+    if (x) m_writer->AddAttribute("x", x);
+    if (y) m_writer->AddAttribute("y", y);
     // unless dx, dy have a value they don't need to be set
-    // m_currentNode.append_attribute("dx") = 0;
-    // m_currentNode.append_attribute("dy") = 0;
+    // m_writer->AddAttribute("dx", 0);
+    // m_writer->AddAttribute("dy", 0);
     if (!anchor.empty()) {
-        m_currentNode.append_attribute("text-anchor") = anchor.c_str();
+        m_writer->AddAttribute("text-anchor", anchor.c_str());
     }
     // font-size seems to be required in <text> in FireFox and also we set it to 0px so space
     // is not added between tspan elements
-    m_currentNode.append_attribute("font-size") = "0px";
+    m_writer->AddAttribute("font-size", "0px");
     //
     if (!m_fontStack.top()->GetFaceName().empty()) {
-        m_currentNode.append_attribute("font-family") = m_fontStack.top()->GetFaceName().c_str();
+        m_writer->AddAttribute("font-family", m_fontStack.top()->GetFaceName().c_str());
     }
     if (m_fontStack.top()->GetStyle() != FONTSTYLE_NONE) {
         if (m_fontStack.top()->GetStyle() == FONTSTYLE_italic) {
-            m_currentNode.append_attribute("font-style") = "italic";
+            m_writer->AddAttribute("font-style", "italic");
         }
         else if (m_fontStack.top()->GetStyle() == FONTSTYLE_normal) {
-            m_currentNode.append_attribute("font-style") = "normal";
+            m_writer->AddAttribute("font-style", "normal");
         }
         else if (m_fontStack.top()->GetStyle() == FONTSTYLE_oblique) {
-            m_currentNode.append_attribute("font-style") = "oblique";
+            m_writer->AddAttribute("font-style", "oblique");
         }
     }
     if (m_fontStack.top()->GetWeight() != FONTWEIGHT_NONE) {
         if (m_fontStack.top()->GetWeight() == FONTWEIGHT_bold) {
-            m_currentNode.append_attribute("font-weight") = "bold";
+            m_writer->AddAttribute("font-weight", "bold");
         }
     }
 }
 
 void SvgDeviceContext::MoveTextTo(int x, int y, data_HORIZONTALALIGNMENT alignment)
 {
-    m_currentNode.append_attribute("x") = x;
-    m_currentNode.append_attribute("y") = y;
+    m_writer->CloseLeaf();
+    m_writer->AddAttribute("x", x);
+    m_writer->AddAttribute("y", y);
     if (alignment != HORIZONTALALIGNMENT_NONE) {
         std::string anchor = "start";
         if (alignment == HORIZONTALALIGNMENT_right) {
@@ -906,19 +1616,19 @@ void SvgDeviceContext::MoveTextTo(int x, int y, data_HORIZONTALALIGNMENT alignme
         if (alignment == HORIZONTALALIGNMENT_center) {
             anchor = "middle";
         }
-        m_currentNode.append_attribute("text-anchor") = anchor.c_str();
+        m_writer->AddAttribute("text-anchor", anchor.c_str());
     }
 }
 
 void SvgDeviceContext::MoveTextVerticallyTo(int y)
 {
-    m_currentNode.append_attribute("y") = y;
+    m_writer->CloseLeaf();
+    m_writer->AddAttribute("y", y);
 }
 
 void SvgDeviceContext::EndText()
 {
-    m_svgNodeStack.pop_back();
-    m_currentNode = m_svgNodeStack.back();
+    m_writer->EndElement();
 }
 
 // draw text element with optional parameters to specify the bounding box of the text
@@ -939,56 +1649,53 @@ void SvgDeviceContext::DrawText(
         svgText.replace(svgText.size() - 1, 1, "\xC2\xA0");
     }
 
-    pugi::xpath_node fontNode = m_currentNode.select_node("ancestor::*[@font-family][1]");
-    std::string currentFaceName = (fontNode) ? fontNode.node().attribute("font-family").value() : "";
+    std::string currentFaceName = m_writer->GetAncestorFontFamily();
     std::string fontFaceName = m_fontStack.top()->GetFaceName();
 
-    pugi::xml_node textChild = AddChild("tspan");
+    this->AddChild("tspan");
     // We still add @xml:space (No: this seems to create problems with Safari)
-    // textChild.append_attribute("xml:space") = "preserve";
+    // m_writer->AddAttribute("xml:space", "preserve");
     // Set the @font-family only if it is not the same as in the parent node
     if (!fontFaceName.empty() && (fontFaceName != currentFaceName)) {
         // Special case where we want to specifiy if the woff2 font needs to be included in the output
         if (m_fontStack.top()->GetSmuflFont() != SMUFL_NONE) {
             if (m_fontStack.top()->GetSmuflFont() == SMUFL_FONT_FALLBACK) {
                 this->VrvTextFontFallback();
-                textChild.append_attribute("font-family") = "Leipzig";
+                m_writer->AddAttribute("font-family", "Leipzig");
             }
             else {
                 this->VrvTextFont();
-                textChild.append_attribute("font-family") = m_fontStack.top()->GetFaceName().c_str();
+                m_writer->AddAttribute("font-family", m_fontStack.top()->GetFaceName().c_str());
             }
             if (m_fontStack.top()->GetStyle() == FONTSTYLE_normal) {
-                textChild.append_attribute("font-style") = "normal";
+                m_writer->AddAttribute("font-style", "normal");
             }
         }
         else {
-            textChild.append_attribute("font-family") = m_fontStack.top()->GetFaceName().c_str();
+            m_writer->AddAttribute("font-family", m_fontStack.top()->GetFaceName().c_str());
         }
     }
     if (m_fontStack.top()->GetPointSize() != 0) {
-        textChild.append_attribute("font-size") = StringFormat("%dpx", m_fontStack.top()->GetPointSize()).c_str();
+        m_writer->AddAttribute("font-size", StringFormat("%dpx", m_fontStack.top()->GetPointSize()).c_str());
     }
     if (m_fontStack.top()->GetLetterSpacing() != 0.0) {
-        textChild.append_attribute("letter-spacing")
-            = StringFormat("%dpx", m_fontStack.top()->GetLetterSpacing()).c_str();
+        m_writer->AddAttribute("letter-spacing", StringFormat("%dpx", m_fontStack.top()->GetLetterSpacing()).c_str());
     }
-    textChild.text().set(svgText.c_str());
+    m_writer->SetLeafText(svgText);
 
     if ((x != 0) && (y != 0) && (x != VRV_UNSET) && (y != VRV_UNSET) && (width != 0) && (height != 0)
         && (width != VRV_UNSET) && (height != VRV_UNSET)) {
-        pugi::xml_node g = m_currentNode.parent().parent();
-        pugi::xml_node rectChild = g.append_child("rect");
-        rectChild.append_attribute("class") = "sylTextRect";
-        rectChild.append_attribute("x") = StringFormat("%d", x).c_str();
-        rectChild.append_attribute("y") = StringFormat("%d", y).c_str();
-        rectChild.append_attribute("width") = StringFormat("%d", width).c_str();
-        rectChild.append_attribute("height") = StringFormat("%d", height).c_str();
-        rectChild.append_attribute("opacity") = "0.0";
+        m_writer->StartLeaf("rect", SvgWriter::AFTER_PARENT);
+        m_writer->AddAttribute("class", "sylTextRect");
+        m_writer->AddAttribute("x", StringFormat("%d", x).c_str());
+        m_writer->AddAttribute("y", StringFormat("%d", y).c_str());
+        m_writer->AddAttribute("width", StringFormat("%d", width).c_str());
+        m_writer->AddAttribute("height", StringFormat("%d", height).c_str());
+        m_writer->AddAttribute("opacity", "0.0");
     }
     else if ((x != 0) && (y != 0) && (x != VRV_UNSET) && (y != VRV_UNSET)) {
-        textChild.append_attribute("x") = StringFormat("%d", x).c_str();
-        textChild.append_attribute("y") = StringFormat("%d", y).c_str();
+        m_writer->AddAttribute("x", StringFormat("%d", x).c_str());
+        m_writer->AddAttribute("y", StringFormat("%d", y).c_str());
     }
 }
 
@@ -1023,17 +1730,17 @@ void SvgDeviceContext::DrawMusicText(const std::u32string &text, int x, int y, b
         m_smuflGlyphs.insert(glyph);
 
         // Write the char in the SVG
-        pugi::xml_node useChild = AddChild("use");
-        useChild.append_attribute(hrefAttrib.c_str())
-            = StringFormat("#%s-%s", glyph->GetCodeStr().c_str(), m_glyphPostfixId.c_str()).c_str();
-        useChild.append_attribute("x") = x;
-        useChild.append_attribute("y") = y;
-        useChild.append_attribute("height") = StringFormat("%dpx", m_fontStack.top()->GetPointSize()).c_str();
-        useChild.append_attribute("width") = StringFormat("%dpx", m_fontStack.top()->GetPointSize()).c_str();
+        this->AddChild("use");
+        m_writer->AddAttribute(
+            hrefAttrib.c_str(), StringFormat("#%s-%s", glyph->GetCodeStr().c_str(), m_glyphPostfixId.c_str()));
+        m_writer->AddAttribute("x", x);
+        m_writer->AddAttribute("y", y);
+        m_writer->AddAttribute("height", StringFormat("%dpx", m_fontStack.top()->GetPointSize()).c_str());
+        m_writer->AddAttribute("width", StringFormat("%dpx", m_fontStack.top()->GetPointSize()).c_str());
         if (m_fontStack.top()->GetWidthToHeightRatio() != 1.0f) {
-            useChild.append_attribute("transform") = StringFormat("matrix(%f,0,0,1,%f,0)",
-                m_fontStack.top()->GetWidthToHeightRatio(), x * (1. - m_fontStack.top()->GetWidthToHeightRatio()))
-                                                         .c_str();
+            m_writer->AddAttribute("transform",
+                StringFormat("matrix(%f,0,0,1,%f,0)", m_fontStack.top()->GetWidthToHeightRatio(),
+                    x * (1. - m_fontStack.top()->GetWidthToHeightRatio())));
         }
 
         // Get the bounds of the char
@@ -1050,25 +1757,26 @@ void SvgDeviceContext::DrawSpline(int n, Point points[]) {}
 
 void SvgDeviceContext::DrawGraphicUri(int x, int y, int width, int height, const std::string &uri)
 {
-    pugi::xml_node image = m_currentNode.append_child("image");
-    image.append_attribute("xlink:href") = uri.c_str();
-    image.append_attribute("x") = StringFormat("%d", x).c_str();
-    image.append_attribute("y") = StringFormat("%d", y).c_str();
-    image.append_attribute("width") = StringFormat("%d", width).c_str();
-    image.append_attribute("height") = StringFormat("%d", height).c_str();
+    m_writer->StartLeaf("image");
+    m_writer->AddAttribute("xlink:href", uri.c_str());
+    m_writer->AddAttribute("x", StringFormat("%d", x).c_str());
+    m_writer->AddAttribute("y", StringFormat("%d", y).c_str());
+    m_writer->AddAttribute("width", StringFormat("%d", width).c_str());
+    m_writer->AddAttribute("height", StringFormat("%d", height).c_str());
 }
 
 void SvgDeviceContext::DrawSvgShape(int x, int y, int width, int height, double scale, pugi::xml_node svg)
 {
-    m_currentNode.append_attribute("transform")
-        = StringFormat("translate(%d, %d) scale(%f, %f)", x, y, scale * DEFINITION_FACTOR, scale * DEFINITION_FACTOR)
-              .c_str();
+    m_writer->CloseLeaf();
+    m_writer->AddAttribute("transform",
+        StringFormat(
+            "translate(%d, %d) scale(%f, %f)", x, y, scale * DEFINITION_FACTOR, scale * DEFINITION_FACTOR));
 
     // Remove the ID in the SVG because it might be duplicated and that will not be valid
-    m_currentNode.remove_attribute("id");
+    m_writer->RemoveId();
 
     for (pugi::xml_node child : svg.children()) {
-        m_currentNode.append_copy(child);
+        m_writer->AppendCopy(child);
     }
 }
 
@@ -1076,8 +1784,8 @@ void SvgDeviceContext::DrawBackgroundImage(int x, int y) {}
 
 void SvgDeviceContext::AddDescription(const std::string &text)
 {
-    pugi::xml_node desc = m_currentNode.append_child("desc");
-    desc.text().set(text.c_str());
+    m_writer->StartLeaf("desc");
+    m_writer->SetLeafText(text);
 }
 
 void SvgDeviceContext::AppendIdAndClass(
@@ -1088,17 +1796,17 @@ void SvgDeviceContext::AppendIdAndClass(
 
     if (gId.length() > 0) {
         if (m_html5) {
-            m_currentNode.append_attribute("data-id") = gId.c_str();
+            m_writer->AddAttribute("data-id", gId.c_str());
         }
         else if (graphicID == PRIMARY) {
             // Don't write ids for HTML5 to avoid id clashes when embedding into
             // an HTML document.
-            m_currentNode.append_attribute("id") = gId.c_str();
+            m_writer->AddAttribute("id", gId.c_str());
         }
     }
 
     if (m_html5) {
-        m_currentNode.append_attribute("data-class") = baseClassFull.c_str();
+        m_writer->AddAttribute("data-class", baseClassFull.c_str());
     }
 
     if (graphicID != PRIMARY) {
@@ -1108,7 +1816,7 @@ void SvgDeviceContext::AppendIdAndClass(
     if (!addedClasses.empty()) {
         baseClassFull.append(" " + addedClasses);
     }
-    m_currentNode.append_attribute("class") = baseClassFull.c_str();
+    m_writer->AddAttribute("class", baseClassFull.c_str());
 }
 
 void SvgDeviceContext::AppendAdditionalAttributes(Object *object)
@@ -1120,7 +1828,7 @@ void SvgDeviceContext::AppendAdditionalAttributes(Object *object)
         object->GetAttributes(&attributes);
         for (ArrayOfStrAttr::iterator iter = attributes.begin(); iter != attributes.end(); ++iter) {
             if (it->second == (*iter).first) // ...and attribute exists in class name, add it to SVG element
-                m_currentNode.append_attribute(("data-" + it->second).c_str()) = (*iter).second.c_str();
+                m_writer->AddAttribute(("data-" + it->second).c_str(), (*iter).second.c_str());
         }
     }
 }
@@ -1154,7 +1862,7 @@ std::string SvgDeviceContext::GetStringSVG(bool xml_declaration)
 {
     if (!m_committed) Commit(xml_declaration);
 
-    return m_outdata.str();
+    return m_outdata;
 }
 
 void SvgDeviceContext::DrawSvgBoundingBoxRectangle(int x, int y, int width, int height)
@@ -1171,13 +1879,13 @@ void SvgDeviceContext::DrawSvgBoundingBoxRectangle(int x, int y, int width, int
         x -= width;
     }
 
-    pugi::xml_node rectChild = AddChild("rect");
-    rectChild.append_attribute("x") = x;
-    rectChild.append_attribute("y") = y;
-    rectChild.append_attribute("height") = height;
-    rectChild.append_attribute("width") = width;
+    this->AddChild("rect");
+    m_writer->AddAttribute("x", x);
+    m_writer->AddAttribute("y", y);
+    m_writer->AddAttribute("height", height);
+    m_writer->AddAttribute("width", width);
 
-    rectChild.append_attribute("fill") = "transparent";
+    m_writer->AddAttribute("fill", "transparent");
 }
 
 void SvgDeviceContext::DrawSvgBoundingBox(Object *object, View *view)
@@ -1185,7 +1893,6 @@ void SvgDeviceContext::DrawSvgBoundingBox(Object *object, View *view)
     const Resources *resources = this->GetResources();
     assert(resources);
 
-    bool groupInPage = false;
     bool drawAnchors = false;
     bool drawContentBB = false;
 
@@ -1201,11 +1908,6 @@ void SvgDeviceContext::DrawSvgBoundingBox(Object *object, View *view)
             if (!box) return;
         }
 
-        pugi::xml_node currentNode = m_currentNode;
-        if (groupInPage) {
-            m_currentNode = m_pageNode;
-        }
-
         StartGraphic(object, "bounding-box", "bbox-" + object->GetID(), PRIMARY, true);
 
         if (box->HasSelfBB()) {
@@ -1251,10 +1953,6 @@ void SvgDeviceContext::DrawSvgBoundingBox(Object *object, View *view)
 
         EndGraphic(object, NULL);
 
-        if (groupInPage) {
-            m_currentNode = m_pageNode;
-        }
-
         if (drawContentBB) {
             if (object->HasContentBB()) {
                 StartGraphic(object, "content-bounding-box", "cbbox-" + object->GetID(), PRIMARY, true);
@@ -1270,10 +1968,6 @@ void SvgDeviceContext::DrawSvgBoundingBox(Object *object, View *view)
                 EndGraphic(object, NULL);
             }
         }
-
-        if (groupInPage) {
-            m_currentNode = currentNode;
-        }
     }
 }
 
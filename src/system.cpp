@@ -371,7 +371,8 @@ void System::AddToDrawingListIfNecessary(Object *object)
 bool System::IsFirstInPage() const
 {
     assert(this->GetParent());
-    return (this->GetParent()->GetFirst(SYSTEM) == this);
+    // GetFirst would change the iterator of the page, which is not possible when laying out systems concurrently
+    return (this->GetParent()->GetPrevious(this, SYSTEM) == NULL);
 }
 
 bool System::IsLastInPage() const
@@ -89,6 +89,29 @@ void TextLayoutElement::AppendTextToCell(int index, TextElement *text)
     m_cells[index].push_back(text);
 }
 
+std::vector<int> TextLayoutElement::GetCellDrawingYRels() const
+{
+    std::vector<int> drawingYRels;
+    for (int i = 0; i < 9; ++i) {
+        for (const TextElement *element : m_cells[i]) {
+            drawingYRels.push_back(element->GetDrawingYRel());
+        }
+    }
+    return drawingYRels;
+}
+
+void TextLayoutElement::SetCellDrawingYRels(const std::vector<int> &drawingYRels)
+{
+    std::vector<int>::const_iterator iter = drawingYRels.begin();
+    for (int i = 0; i < 9; ++i) {
+        for (TextElement *element : m_cells[i]) {
+            if (iter == drawingYRels.end()) return;
+            element->SetDrawingYRel(*iter);
+            ++iter;
+        }
+    }
+}
+
 int TextLayoutElement::GetContentHeight() const
 {
     int height = 0;
@@ -182,6 +182,7 @@ bool TimePointInterface::VerifyMeasure(const Object *owner) const
 
 TimeSpanningInterface::TimeSpanningInterface() : TimePointInterface(), AttStartEndId(), AttTimestamp2Log()
 {
+    this->RegisterInterfaceAttClasses(INTERFACE_TIME_POINT);
     this->RegisterInterfaceAttClass(ATT_STARTENDID);
     this->RegisterInterfaceAttClass(ATT_TIMESTAMP2LOG);
 
@@ -9,7 +9,9 @@
 
 //----------------------------------------------------------------------------
 
+#include <algorithm>
 #include <cassert>
+#include <cstring>
 
 //----------------------------------------------------------------------------
 
@@ -94,4 +96,295 @@ void Timemap::ToJson(std::string &output, bool includeRests, bool includeMeasure
     output = timemap.json();
 }
 
+std::vector<const std::string *> Timemap::InternIDs(
+    std::unordered_map<std::string, int> &indices, bool includeRests, bool includeMeasures) const
+{
+    std::vector<const std::string *> ids;
+    auto intern = [&indices, &ids](const std::string &id) {
+        if (indices.emplace(id, (int)ids.size()).second) ids.push_back(&id);
+    };
+    for (const auto &[tstamp, entry] : m_map) {
+        std::for_each(entry.notesOn.begin(), entry.notesOn.end(), intern);
+        std::for_each(entry.notesOff.begin(), entry.notesOff.end(), intern);
+        if (includeRests) {
+            std::for_each(entry.restsOn.begin(), entry.restsOn.end(), intern);
+            std::for_each(entry.restsOff.begin(), entry.restsOff.end(), intern);
+        }
+        if (includeMeasures && !entry.measureOn.empty()) intern(entry.measureOn);
+    }
+    return ids;
+}
+
+void Timemap::ToCompactJson(std::ostream &output, bool includeRests, bool includeMeasures) const
+{
+    std::unordered_map<std::string, int> indices;
+    std::vector<const std::string *> ids = this->InternIDs(indices, includeRests, includeMeasures);
+
+    const std::streamsize precision = output.precision(15);
+
+    output << "{\"ids\":[";
+    for (auto it = ids.begin(); it != ids.end(); ++it) {
+        output << ((it == ids.begin()) ? "\"" : ",\"");
+        for (char c : **it) {
+            if ((c == '"') || (c == '\\')) output << '\\';
+            output << c;
+        }
+        output << '"';
+    }
+    output << "]";
+
+    auto writeColumn = [this, &output](const char *name, auto value) {
+        output << ",\"" << name << "\":[";
+        for (auto it = m_map.begin(); it != m_map.end(); ++it) {
+            if (it != m_map.begin()) output << ',';
+            value(it->first, it->second);
+        }
+        output << "]";
+    };
+    auto writeIDs = [&output, &indices](const std::vector<std::string> &list) {
+        output << '[';
+        for (auto it = list.begin(); it != list.end(); ++it) {
+            output << ((it == list.begin()) ? "" : ",") << indices.at(*it);
+        }
+        output << ']';
+    };
+
+    writeColumn("tstamp", [&output](double tstamp, const TimemapEntry &entry) { output << tstamp; });
+    writeColumn("qstamp", [&output](double tstamp, const TimemapEntry &entry) { output << entry.qstamp; });
+    double currentTempo = -1000.0;
+    writeColumn("tempo", [&output, &currentTempo](double tstamp, const TimemapEntry &entry) {
+        if (entry.tempo != -1000.0) currentTempo = entry.tempo;
+        output << currentTempo;
+    });
+    writeColumn("on", [&writeIDs](double tstamp, const TimemapEntry &entry) { writeIDs(entry.notesOn); });
+    writeColumn("off", [&writeIDs](double tstamp, const TimemapEntry &entry) { writeIDs(entry.notesOff); });
+    if (includeRests) {
+        writeColumn("restsOn", [&writeIDs](double tstamp, const TimemapEntry &entry) { writeIDs(entry.restsOn); });
+        writeColumn("restsOff", [&writeIDs](double tstamp, const TimemapEntry &entry) { writeIDs(entry.restsOff); });
+    }
+    if (includeMeasures) {
+        writeColumn("measureOn", [&output, &indices](double tstamp, const TimemapEntry &entry) {
+            output << ((entry.measureOn.empty()) ? -1 : indices.at(entry.measureOn));
+        });
+    }
+    output << "}";
+
+    output.precision(precision);
+}
+
+void Timemap::ToBinary(std::vector<unsigned char> &output, bool includeRests, bool includeMeasures) const
+{
+    std::unordered_map<std::string, int> indices;
+    std::vector<const std::string *> ids = this->InternIDs(indices, includeRests, includeMeasures);
+
+    // the magic number with the version of the format replaces any previous content
+    static const unsigned char magic[4] = { 'V', 'T', 'M', '1' };
+    output.assign(magic, magic + 4);
+
+    auto writeUInt32 = [&output](uint32_t value) {
+        for (int i = 0; i < 4; ++i) output.push_back((value >> (8 * i)) & 0xFF);
+    };
+    auto writeDouble = [&output](double value) {
+        uint64_t bits;
+        std::memcpy(&bits, &value, sizeof(bits));
+        for (int i = 0; i < 8; ++i) output.push_back((bits >> (8 * i)) & 0xFF);
+    };
+    auto writeIDs = [this, &writeUInt32, &indices](std::vector<std::string> TimemapEntry::*list) {
+        for (const auto &[tstamp, entry] : m_map) writeUInt32((uint32_t)(entry.*list).size());
+        for (const auto &[tstamp, entry] : m_map) {
+            for (const std::string &id : entry.*list) writeUInt32(indices.at(id));
+        }
+    };
+
+    writeUInt32((includeRests ? 1 : 0) | (includeMeasures ? 2 : 0));
+    writeUInt32((uint32_t)m_map.size());
+    writeUInt32((uint32_t)ids.size());
+    for (const std::string *id : ids) {
+        writeUInt32((uint32_t)id->size());
+        output.insert(output.end(), id->begin(), id->end());
+    }
+
+    for (const auto &[tstamp, entry] : m_map) writeDouble(tstamp);
+    for (const auto &[tstamp, entry] : m_map) writeDouble(entry.qstamp);
+    double currentTempo = -1000.0;
+    for (const auto &[tstamp, entry] : m_map) {
+        if (entry.tempo != -1000.0) currentTempo = entry.tempo;
+        writeDouble(currentTempo);
+    }
+
+    writeIDs(&TimemapEntry::notesOn);
+    writeIDs(&TimemapEntry::notesOff);
+    if (includeRests) {
+        writeIDs(&TimemapEntry::restsOn);
+        writeIDs(&TimemapEntry::restsOff);
+    }
+    if (includeMeasures) {
+        for (const auto &[tstamp, entry] : m_map) {
+            writeUInt32((uint32_t)((entry.measureOn.empty()) ? -1 : indices.at(entry.measureOn)));
+        }
+    }
+}
+
+//----------------------------------------------------------------------------
+// TimeIndex
+//----------------------------------------------------------------------------
+
+TimeIndex::TimeIndex()
+{
+    this->Reset();
+}
+
+TimeIndex::~TimeIndex() {}
+
+void TimeIndex::Reset()
+{
+    m_measures.clear();
+    m_elements.clear();
+    m_measuresByRealTime.Clear();
+    m_measuresByScoreTime.Clear();
+    m_elementsByRealTime.Clear();
+    m_elementsByScoreTime.Clear();
+    m_objectEntries.clear();
+}
+
+void TimeIndex::AddEntry(const TimeIndexEntry &entry)
+{
+    assert(entry.object);
+
+    if (entry.object->Is(MEASURE)) {
+        m_objectEntries[entry.object].push_back((int)m_measures.size());
+        m_measures.push_back(entry);
+    }
+    else {
+        m_objectEntries[entry.object].push_back((int)m_elements.size());
+        m_elements.push_back(entry);
+    }
+}
+
+void TimeIndex::Build()
+{
+    m_measuresByRealTime.Build(m_measures, false);
+    m_measuresByScoreTime.Build(m_measures, true);
+    m_elementsByRealTime.Build(m_elements, false);
+    m_elementsByScoreTime.Build(m_elements, true);
+}
+
+void TimeIndex::FindMeasuresByRealTime(double from, double to, std::vector<const TimeIndexEntry *> &entries) const
+{
+    this->Find(m_measures, m_measuresByRealTime, from, to, entries);
+}
+
+void TimeIndex::FindMeasuresByScoreTime(double from, double to, std::vector<const TimeIndexEntry *> &entries) const
+{
+    this->Find(m_measures, m_measuresByScoreTime, from, to, entries);
+}
+
+void TimeIndex::FindElementsByRealTime(double from, double to, std::vector<const TimeIndexEntry *> &entries) const
+{
+    this->Find(m_elements, m_elementsByRealTime, from, to, entries);
+}
+
+void TimeIndex::FindElementsByScoreTime(double from, double to, std::vector<const TimeIndexEntry *> &entries) const
+{
+    this->Find(m_elements, m_elementsByScoreTime, from, to, entries);
+}
+
+std::vector<const TimeIndexEntry *> TimeIndex::GetEntries(const Object *object) const
+{
+    std::vector<const TimeIndexEntry *> entries;
+    auto it = m_objectEntries.find(object);
+    if (it == m_objectEntries.end()) return entries;
+
+    const std::vector<TimeIndexEntry> &objectEntries = (object->Is(MEASURE)) ? m_measures : m_elements;
+    for (int position : it->second) entries.push_back(&objectEntries.at(position));
+    return entries;
+}
+
+void TimeIndex::Find(const std::vector<TimeIndexEntry> &entries, const IntervalTree &tree, double from, double to,
+    std::vector<const TimeIndexEntry *> &results) const
+{
+    results.clear();
+    tree.Find(entries, from, to, results);
+    std::sort(results.begin(), results.end(), [](const TimeIndexEntry *entry1, const TimeIndexEntry *entry2) {
+        if (entry1->order != entry2->order) return (entry1->order < entry2->order);
+        return (entry1->repeat < entry2->repeat);
+    });
+}
+
+//----------------------------------------------------------------------------
+// TimeIndex::IntervalTree
+//----------------------------------------------------------------------------
+
+void TimeIndex::IntervalTree::Clear()
+{
+    m_positions.clear();
+    m_onsets.clear();
+    m_offsets.clear();
+    m_maxOffsets.clear();
+}
+
+void TimeIndex::IntervalTree::Build(const std::vector<TimeIndexEntry> &entries, bool scoreTime)
+{
+    this->Clear();
+
+    const int size = (int)entries.size();
+    m_positions.resize(size);
+    for (int i = 0; i < size; ++i) m_positions.at(i) = i;
+
+    auto onset = [&entries, scoreTime](int position) {
+        return (scoreTime) ? entries.at(position).scoreTimeOnset : entries.at(position).realTimeOnset;
+    };
+    auto offset = [&entries, scoreTime](int position) {
+        return (scoreTime) ? entries.at(position).scoreTimeOffset : entries.at(position).realTimeOffset;
+    };
+
+    std::stable_sort(m_positions.begin(), m_positions.end(),
+        [&onset](int position1, int position2) { return (onset(position1) < onset(position2)); });
+
+    // Keep the values in contiguous arrays for the lookup
+    m_onsets.reserve(size);
+    m_offsets.reserve(size);
+    for (int position : m_positions) {
+        m_onsets.push_back(onset(position));
+        m_offsets.push_back(offset(position));
+    }
+    m_maxOffsets.resize(size);
+    this->BuildMaxOffsets(0, size);
+}
+
+double TimeIndex::IntervalTree::BuildMaxOffsets(int begin, int end)
+{
+    // The subtree [begin, end) is rooted in its middle position
+    const int middle = begin + (end - begin) / 2;
+    double maxOffset = m_offsets.at(middle);
+    if (begin < middle) maxOffset = std::max(maxOffset, this->BuildMaxOffsets(begin, middle));
+    if (middle + 1 < end) maxOffset = std::max(maxOffset, this->BuildMaxOffsets(middle + 1, end));
+    m_maxOffsets.at(middle) = maxOffset;
+    return maxOffset;
+}
+
+void TimeIndex::IntervalTree::Find(const std::vector<TimeIndexEntry> &entries, double from, double to,
+    std::vector<const TimeIndexEntry *> &results) const
+{
+    if (m_positions.empty()) return;
+    this->Find(entries, 0, (int)m_positions.size(), from, to, results);
+}
+
+void TimeIndex::IntervalTree::Find(const std::vector<TimeIndexEntry> &entries, int begin, int end, double from,
+    double to, std::vector<const TimeIndexEntry *> &results) const
+{
+    if (begin >= end) return;
+
+    const int middle = begin + (end - begin) / 2;
+    // Nothing in this subtree ends after the start of the range
+    if (m_maxOffsets.at(middle) < from) return;
+
+    this->Find(entries, begin, middle, from, to, results);
+    // Everything from here on starts after the end of the range
+    if (m_onsets.at(middle) > to) return;
+
+    if (m_offsets.at(middle) >= from) results.push_back(&entries.at(m_positions.at(middle)));
+    this->Find(entries, middle + 1, end, from, to, results);
+}
+
 } // namespace vrv
@@ -10,9 +10,13 @@
 //----------------------------------------------------------------------------
 
 #include <cassert>
+#include <cstdio>
 #include <codecvt>
 #include <locale>
+#include <mutex>
 #include <regex>
+#include <thread>
+#include <unordered_set>
 
 //----------------------------------------------------------------------------
 
@@ -35,6 +39,7 @@
 #include "note.h"
 #include "options.h"
 #include "page.h"
+#include "pages.h"
 #include "runtimeclock.h"
 #include "score.h"
 #include "slur.h"
@@ -58,11 +63,167 @@ const char *UTF_16_BE_BOM = "\xFE\xFF";
 const char *UTF_16_LE_BOM = "\xFF\xFE";
 const char *ZIP_SIGNATURE = "\x50\x4B\x03\x04";
 
+#ifndef NO_HUMDRUM_SUPPORT
+// humlib has global state - the conversions going through it are serialized between the toolkits
+static std::recursive_mutex humlibMutex;
+#endif
+
 //----------------------------------------------------------------------------
-// Toolkit
+// ByteStreamBuffer
+//----------------------------------------------------------------------------
+
+/**
+ * A stream buffer appending the characters written to a vector of bytes.
+ * Used for writing binary output directly into a buffer without a stringstream copy.
+ */
+class ByteStreamBuffer : public std::streambuf {
+public:
+    explicit ByteStreamBuffer(std::vector<unsigned char> &bytes) : m_bytes(bytes) {}
+
+protected:
+    int_type overflow(int_type c) override
+    {
+        if (traits_type::eq_int_type(c, traits_type::eof())) return traits_type::not_eof(c);
+        m_bytes.push_back(static_cast<unsigned char>(c));
+        return c;
+    }
+
+    std::streamsize xsputn(const char *s, std::streamsize n) override
+    {
+        m_bytes.insert(m_bytes.end(), reinterpret_cast<const unsigned char *>(s),
+            reinterpret_cast<const unsigned char *>(s) + n);
+        return n;
+    }
+
+private:
+    std::vector<unsigned char> &m_bytes;
+};
+
+//----------------------------------------------------------------------------
+// Element queries
 //----------------------------------------------------------------------------
 
-char *Toolkit::m_humdrumBuffer = NULL;
+/**
+ * The values of an element shared by the element query methods of the toolkit and their batch variants.
+ * The time values require the timemap to have been calculated.
+ */
+static void FillElementAttr(const Object *element, jsonxx::Object &o)
+{
+    // Fill the attribute array (pair of std::string) by looking at attributes for all available MEI modules
+    ArrayOfStrAttr attributes;
+    element->GetAttributes(&attributes);
+
+    // Fill the JSON object
+    ArrayOfStrAttr::iterator iter;
+    for (iter = attributes.begin(); iter != attributes.end(); ++iter) {
+        o << (*iter).first << (*iter).second;
+    }
+}
+
+static int GetPageNoOfElement(const Object *element)
+{
+    const Page *page = vrv_cast<const Page *>(element->GetFirstAncestor(PAGE));
+    return (page) ? page->GetIdx() + 1 : 0;
+}
+
+static int GetTimeOfElement(const TimeIndex &timeIndex, const Object *element)
+{
+    int timeofElement = 0;
+    if (element->Is(CHORD)) {
+        element = element->FindDescendantByType(NOTE);
+        assert(element);
+    }
+    if (element->Is({ MEASURE, NOTE })) {
+        // For now ignore repeats and access always the first
+        std::vector<const TimeIndexEntry *> entries = timeIndex.GetEntries(element);
+        if (!entries.empty()) {
+            timeofElement = entries.front()->measure->GetRealTimeOffsetMilliseconds(entries.front()->repeat);
+            if (element->Is(NOTE)) {
+                const Note *note = vrv_cast<const Note *>(element);
+                assert(note);
+                timeofElement += note->GetRealTimeOnsetMilliseconds();
+            }
+        }
+    }
+    return timeofElement;
+}
+
+static void FillMIDIValuesForNote(const TimeIndex &timeIndex, const Note *note, jsonxx::Object &o)
+{
+    const int timeOfElement = GetTimeOfElement(timeIndex, note);
+    const int pitchOfElement = note->GetMIDIPitch();
+    const int durationOfElement = note->GetRealTimeOffsetMilliseconds() - note->GetRealTimeOnsetMilliseconds();
+    o << "time" << timeOfElement;
+    o << "pitch" << pitchOfElement;
+    o << "duration" << durationOfElement;
+}
+
+static void FillTimesForNote(const TimeIndex &timeIndex, const Note *note, jsonxx::Object &o)
+{
+    jsonxx::Array scoreTimeOnset;
+    jsonxx::Array scoreTimeOffset;
+    jsonxx::Array scoreTimeDuration;
+    jsonxx::Array scoreTimeTiedDuration;
+    jsonxx::Array realTimeOnsetMilliseconds;
+    jsonxx::Array realTimeOffsetMilliseconds;
+    jsonxx::Array repeatRealTimeOnsetMilliseconds;
+    jsonxx::Array repeatRealTimeOffsetMilliseconds;
+
+    const Measure *measure = vrv_cast<const Measure *>(note->GetFirstAncestor(MEASURE));
+    assert(measure);
+
+    // For now ignore repeats and access always the first
+    double offset = measure->GetRealTimeOffsetMilliseconds(1);
+    realTimeOffsetMilliseconds << offset + note->GetRealTimeOffsetMilliseconds();
+    realTimeOnsetMilliseconds << offset + note->GetRealTimeOnsetMilliseconds();
+
+    scoreTimeOnset << note->GetScoreTimeOnset();
+    scoreTimeOffset << note->GetScoreTimeOffset();
+    scoreTimeDuration << note->GetScoreTimeDuration();
+    scoreTimeTiedDuration << note->GetScoreTimeTiedDuration();
+
+    // One value for each playing repeat of the measure
+    for (const TimeIndexEntry *entry : timeIndex.GetEntries(note)) {
+        offset = entry->measure->GetRealTimeOffsetMilliseconds(entry->repeat);
+        repeatRealTimeOffsetMilliseconds << offset + note->GetRealTimeOffsetMilliseconds();
+        repeatRealTimeOnsetMilliseconds << offset + note->GetRealTimeOnsetMilliseconds();
+    }
+
+    o << "scoreTimeOnset" << scoreTimeOnset;
+    o << "scoreTimeOffset" << scoreTimeOffset;
+    o << "scoreTimeDuration" << scoreTimeDuration;
+    o << "scoreTimeTiedDuration" << scoreTimeTiedDuration;
+    o << "realTimeOnsetMilliseconds" << realTimeOnsetMilliseconds;
+    o << "realTimeOffsetMilliseconds" << realTimeOffsetMilliseconds;
+    o << "repeatRealTimeOnsetMilliseconds" << repeatRealTimeOnsetMilliseconds;
+    o << "repeatRealTimeOffsetMilliseconds" << repeatRealTimeOffsetMilliseconds;
+}
+
+/**
+ * Write the JSON object of a batch query with the value of each element keyed by ID.
+ * The values are serialized one by one and not copied into a single jsonxx::Object, which is much slower.
+ */
+template <typename Function>
+static std::string WriteElementValues(const ArrayOfIDObjectPairs &elements, Function value)
+{
+    std::string output = "{";
+    for (const auto &[xmlId, element] : elements) {
+        if (output.size() > 1) output += ",";
+        output += "\"";
+        for (char c : xmlId) {
+            if ((c == '"') || (c == '\\')) output += '\\';
+            output += c;
+        }
+        output += "\":";
+        output += value(xmlId, element);
+    }
+    output += "}";
+    return output;
+}
+
+//----------------------------------------------------------------------------
+// Toolkit
+//----------------------------------------------------------------------------
 
 Toolkit::Toolkit(bool initFont)
 {
@@ -71,6 +232,8 @@ Toolkit::Toolkit(bool initFont)
 
     m_humdrumBuffer = NULL;
     m_cString = NULL;
+    m_logCallbackUserData = NULL;
+    m_svgDeviceContext = NULL;
 
     if (initFont) {
         Resources &resources = m_doc.GetResourcesForModification();
@@ -96,6 +259,10 @@ Toolkit::~Toolkit()
         free(m_cString);
         m_cString = NULL;
     }
+    if (m_svgDeviceContext) {
+        delete m_svgDeviceContext;
+        m_svgDeviceContext = NULL;
+    }
     if (m_editorToolkit) {
         delete m_editorToolkit;
         m_editorToolkit = NULL;
@@ -269,10 +436,12 @@ FileFormat Toolkit::IdentifyInputFrom(const std::string &data)
         // <score-timewise> == root node for time-wise organization of MusicXML data
         // <opus> == root node for multi-movement/work organization of MusicXML data
 
-        if (std::regex_search(initial, std::regex("<(mei|music|pages)[\\s\\n>]"))) {
+        static const std::regex meiRoot("<(mei|music|pages)[\\s\\n>]");
+        static const std::regex musicXmlRoot("<(!DOCTYPE )?(score-partwise|opus|score-timewise)[\\s\\n>]");
+        if (std::regex_search(initial, meiRoot)) {
             return MEI;
         }
-        if (std::regex_search(initial, std::regex("<(!DOCTYPE )?(score-partwise|opus|score-timewise)[\\s\\n>]"))) {
+        if (std::regex_search(initial, musicXmlRoot)) {
             return musicxmlDefault;
         }
         LogWarning("Warning: Trying to load unknown XML data which cannot be identified.");
@@ -465,6 +634,8 @@ bool Toolkit::LoadZipDataBuffer(const unsigned char *data, int length)
 
 bool Toolkit::LoadData(const std::string &data)
 {
+    this->SetThreadLogUserData();
+    ObjectArenaScope arenaScope(m_doc.GetArena());
     std::string newData;
     Input *input = NULL;
 
@@ -484,6 +655,15 @@ bool Toolkit::LoadData(const std::string &data)
     if (inputFormat == AUTO) {
         inputFormat = IdentifyInputFrom(data);
     }
+
+#ifndef NO_HUMDRUM_SUPPORT
+    std::unique_lock<std::recursive_mutex> humlibLock(humlibMutex, std::defer_lock);
+    if ((inputFormat == HUMDRUM) || (inputFormat == HUMMEI) || (inputFormat == MUSICXMLHUM)
+        || (inputFormat == MEIHUM) || (inputFormat == MUSEDATAHUM) || (inputFormat == ESAC)) {
+        humlibLock.lock();
+    }
+#endif
+
     if (inputFormat == ABC) {
 #ifndef NO_ABC_SUPPORT
         input = new ABCInput(&m_doc);
@@ -694,6 +874,11 @@ bool Toolkit::LoadData(const std::string &data)
         return false;
     }
 
+#ifndef NO_HUMDRUM_SUPPORT
+    // The data converted from Humdrum is loaded from MEI, only the HumdrumInput needs to keep the lock
+    if (humlibLock.owns_lock() && (inputFormat != HUMDRUM)) humlibLock.unlock();
+#endif
+
     // load the file
     if (inputFormat != HUMDRUM) {
         if (!input->Import(newData.size() ? newData : data)) {
@@ -807,6 +992,14 @@ bool Toolkit::LoadData(const std::string &data)
 
 std::string Toolkit::GetMEI(const std::string &jsonOptions)
 {
+    std::ostringstream output;
+    if (!this->WriteMEI(output, jsonOptions)) return "";
+    return output.str();
+}
+
+bool Toolkit::WriteMEI(std::ostream &output, const std::string &jsonOptions)
+{
+    this->SetThreadLogUserData();
     bool scoreBased = true;
     bool basic = false;
     bool ignoreHeader = false;
@@ -843,16 +1036,18 @@ std::string Toolkit::GetMEI(const std::string &jsonOptions)
 
     if (this->GetPageCount() == 0) {
         LogWarning("No data loaded");
-        return "";
+        return false;
     }
 
+    ObjectArenaScope arenaScope(m_doc.GetArena());
+
     int initialPageNo = (m_doc.GetDrawingPage() == NULL) ? -1 : m_doc.GetDrawingPage()->GetIdx();
 
     bool hadSelection = false;
     if (m_doc.HasSelection()) {
         if (!scoreBased) {
             LogError("Page-based MEI output is not possible when a selection is set.");
-            return "";
+            return false;
         }
         hadSelection = true;
         m_doc.DeactiveateSelection();
@@ -873,12 +1068,12 @@ std::string Toolkit::GetMEI(const std::string &jsonOptions)
     if (!lastMeasure.empty()) meioutput.SetLastMeasure(lastMeasure);
     if (!mdiv.empty()) meioutput.SetMdiv(mdiv);
 
-    std::string output = meioutput.GetOutput();
+    bool success = meioutput.Export(output);
 
     if (hadSelection) m_doc.ReactivateSelection(false);
 
     if (initialPageNo >= 0) m_doc.SetDrawingPage(initialPageNo);
-    return output;
+    return success;
 }
 
 std::string Toolkit::ValidatePAEFile(const std::string &filename)
@@ -901,21 +1096,41 @@ std::string Toolkit::ValidatePAE(const std::string &data)
 
 bool Toolkit::SaveFile(const std::string &filename, const std::string &jsonOptions)
 {
-    std::string output = this->GetMEI(jsonOptions);
-    if (output.empty()) {
+    if (this->GetPageCount() == 0) {
+        LogWarning("No data loaded");
         return false;
     }
 
+    // Write to a temporary file in the same directory that replaces the file only once the output is complete
+    const std::string tmpFilename = filename + ".tmp";
     std::ofstream outfile;
-    outfile.open(filename.c_str());
+    outfile.open(tmpFilename.c_str());
 
     if (!outfile.is_open()) {
         LogError("Unable to write MEI to %s", filename.c_str());
         return false;
     }
 
-    outfile << output;
+    bool success = this->WriteMEI(outfile, jsonOptions);
     outfile.close();
+    if (success && outfile.fail()) {
+        LogError("Unable to write MEI to %s", filename.c_str());
+        success = false;
+    }
+    if (!success) {
+        std::remove(tmpFilename.c_str());
+        return false;
+    }
+
+#ifdef _WIN32
+    // The file cannot be renamed over an existing one on Windows
+    std::remove(filename.c_str());
+#endif
+    if (std::rename(tmpFilename.c_str(), filename.c_str()) != 0) {
+        LogError("Unable to write MEI to %s", filename.c_str());
+        std::remove(tmpFilename.c_str());
+        return false;
+    }
     return true;
 }
 
@@ -1024,6 +1239,7 @@ std::string Toolkit::GetAvailableOptions() const
 
 bool Toolkit::SetOptions(const std::string &jsonOptions)
 {
+    this->SetThreadLogUserData();
     jsonxx::Object json;
 
     // Read JSON options
@@ -1275,52 +1491,125 @@ std::string Toolkit::GetElementAttr(const std::string &xmlId)
     }
     // If not found again, try looking in the layer staffdefs
     if (!element) {
-        FindElementInLayerStaffDefFunctor findElementInLayerStaffDef(xmlId);
-        // Check drawing page elements first
-        if (m_doc.GetDrawingPage()) {
-            m_doc.GetDrawingPage()->Process(findElementInLayerStaffDef);
-            element = findElementInLayerStaffDef.GetElement();
+        element = this->FindElementInLayerStaffDefs(xmlId);
+    }
+    // If not found at all
+    if (!element) {
+        LogWarning("Element '%s' not found", xmlId.c_str());
+        return o.json();
+    }
+
+    FillElementAttr(element, o);
+    return o.json();
+}
+
+std::string Toolkit::GetElementsAttr(const std::string &jsonQuery)
+{
+    ArrayOfIDObjectPairs elements;
+    if (!this->FindElementsForQuery(jsonQuery, elements)) return jsonxx::Object().json();
+
+    return WriteElementValues(elements, [this](const std::string &xmlId, const Object *element) {
+        if (!element) element = this->FindElementInLayerStaffDefs(xmlId);
+        jsonxx::Object o;
+        if (element) {
+            FillElementAttr(element, o);
         }
-        if (!element) {
-            m_doc.Process(findElementInLayerStaffDef);
-            element = findElementInLayerStaffDef.GetElement();
+        else {
+            LogWarning("Element '%s' not found", xmlId.c_str());
         }
-        // If element is found within layer staffdef - check for the linking interface @corresp attribute to find
-        // original ID of the element
-        if (element) {
-            // If element has @corresp set, try finding its origin
-            const LinkingInterface *link = element->GetLinkingInterface();
-            if (link && link->HasCorresp()) {
-                const std::string correspId = ExtractIDFragment(link->GetCorresp());
-                Object *origin = m_doc.FindDescendantByID(correspId);
-                // if no original element was found, try searching through scoredef in score (only for certain elements)
-                if (!origin && element->Is({ CLEF, GRPSYM, KEYSIG, MENSUR, METERSIG, METERSIGGRP })) {
-                    Page *page = vrv_cast<Page *>(m_doc.FindDescendantByType(PAGE));
-                    if (page && page->m_score) {
-                        origin = page->m_score->GetScoreDef()->FindDescendantByID(correspId);
-                    }
+        return o.json();
+    });
+}
+
+const Object *Toolkit::FindElementInLayerStaffDefs(const std::string &xmlId)
+{
+    const Object *element = NULL;
+
+    FindElementInLayerStaffDefFunctor findElementInLayerStaffDef(xmlId);
+    // Check drawing page elements first
+    if (m_doc.GetDrawingPage()) {
+        m_doc.GetDrawingPage()->Process(findElementInLayerStaffDef);
+        element = findElementInLayerStaffDef.GetElement();
+    }
+    if (!element) {
+        m_doc.Process(findElementInLayerStaffDef);
+        element = findElementInLayerStaffDef.GetElement();
+    }
+    // If element is found within layer staffdef - check for the linking interface @corresp attribute to find
+    // original ID of the element
+    if (element) {
+        // If element has @corresp set, try finding its origin
+        const LinkingInterface *link = element->GetLinkingInterface();
+        if (link && link->HasCorresp()) {
+            const std::string correspId = ExtractIDFragment(link->GetCorresp());
+            Object *origin = m_doc.FindDescendantByID(correspId);
+            // if no original element was found, try searching through scoredef in score (only for certain elements)
+            if (!origin && element->Is({ CLEF, GRPSYM, KEYSIG, MENSUR, METERSIG, METERSIGGRP })) {
+                Page *page = vrv_cast<Page *>(m_doc.FindDescendantByType(PAGE));
+                if (page && page->m_score) {
+                    origin = page->m_score->GetScoreDef()->FindDescendantByID(correspId);
                 }
-                if (origin) element = origin;
             }
+            if (origin) element = origin;
         }
     }
-    // If not found at all
-    if (!element) {
-        LogWarning("Element '%s' not found", xmlId.c_str());
-        return o.json();
+    return element;
+}
+
+bool Toolkit::FindElementsForQuery(const std::string &jsonQuery, ArrayOfIDObjectPairs &elements)
+{
+    elements.clear();
+
+    // The query is either an array of IDs or an object with the IDs or the page
+    jsonxx::Array ids;
+    if (!ids.parse(jsonQuery)) {
+        jsonxx::Object json;
+        if (!json.parse(jsonQuery)) {
+            LogWarning("Cannot parse JSON std::string.");
+            return false;
+        }
+        if (json.has<jsonxx::Number>("page")) {
+            const int pageNo = json.get<jsonxx::Number>("page");
+            if ((pageNo < 1) || (pageNo > this->GetPageCount())) {
+                LogWarning("Page %d does not exist", pageNo);
+                return false;
+            }
+            Page *page = vrv_cast<Page *>(m_doc.GetPages()->GetChild(pageNo - 1));
+            assert(page);
+            for (Object *note : page->FindAllDescendantsByType(NOTE)) {
+                elements.push_back({ note->GetID(), note });
+            }
+            return true;
+        }
+        if (json.has<jsonxx::Array>("ids")) ids = json.get<jsonxx::Array>("ids");
     }
 
-    // Fill the attribute array (pair of std::string) by looking at attributes for all available MEI modules
-    ArrayOfStrAttr attributes;
-    element->GetAttributes(&attributes);
+    // Keep the order of the query and skip duplicated IDs
+    std::unordered_set<std::string> idSet;
+    for (const jsonxx::Value *value : ids.values()) {
+        if (!value->is<jsonxx::String>()) continue;
+        const std::string &id = value->get<jsonxx::String>();
+        if (idSet.insert(id).second) elements.push_back({ id, NULL });
+    }
+    if (elements.empty()) return true;
 
-    // Fill the JSON object
-    ArrayOfStrAttr::iterator iter;
-    for (iter = attributes.begin(); iter != attributes.end(); ++iter) {
-        o << (*iter).first << (*iter).second;
-        // LogInfo("Element %s - %s", (*iter).first.c_str(), (*iter).second.c_str());
+    // Use the ID index of the document when available
+    if (m_doc.IsIDIndexActive()) {
+        for (auto &[id, element] : elements) element = m_doc.FindDescendantByID(id);
+        return true;
     }
-    return o.json();
+
+    // Otherwise look for all the elements at once - keep the first one for duplicated IDs as FindDescendantByID does
+    ListOfObjects objects;
+    IDsComparison comparison(idSet);
+    m_doc.FindAllDescendantsByComparison(&objects, &comparison);
+    std::unordered_map<std::string, Object *> found;
+    for (Object *object : objects) found.emplace(object->GetID(), object);
+    for (auto &[id, element] : elements) {
+        auto iter = found.find(id);
+        if (iter != found.end()) element = iter->second;
+    }
+    return true;
 }
 
 std::string Toolkit::GetNotatedIdForElement(const std::string &xmlId)
@@ -1351,6 +1640,8 @@ bool Toolkit::Edit(const std::string &editorAction)
 {
     this->ResetLogBuffer();
 
+    ObjectArenaScope arenaScope(m_doc.GetArena());
+
     return m_editorToolkit->ParseEditorAction(editorAction);
 }
 
@@ -1381,7 +1672,13 @@ void Toolkit::ResetXmlIdSeed(int seed)
 
 void Toolkit::ResetLogBuffer()
 {
-    logBuffer.clear();
+    LogBufferClear();
+    this->SetThreadLogUserData();
+}
+
+void Toolkit::SetThreadLogUserData() const
+{
+    SetLogToolkitUserData(m_logCallbackUserData);
 }
 
 void Toolkit::RedoLayout(const std::string &jsonOptions)
@@ -1407,6 +1704,11 @@ void Toolkit::RedoLayout(const std::string &jsonOptions)
         return;
     }
 
+    // The neume editor does not reset the cached layout of the measures it modifies, so it cannot be reused
+    if (m_doc.m_notationType == NOTATIONTYPE_neume) resetCache = true;
+
+    ObjectArenaScope arenaScope(m_doc.GetArena());
+
     if (m_docSelection.m_isPending) {
         m_doc.InitSelectionDoc(m_docSelection, resetCache);
     }
@@ -1444,6 +1746,7 @@ void Toolkit::RedoPagePitchPosLayout()
 
 bool Toolkit::RenderToDeviceContext(int pageNo, DeviceContext *deviceContext)
 {
+    this->SetThreadLogUserData();
     if (pageNo > this->GetPageCount()) {
         LogWarning("Page %d does not exist", pageNo);
         return false;
@@ -1455,6 +1758,15 @@ bool Toolkit::RenderToDeviceContext(int pageNo, DeviceContext *deviceContext)
     // Get the current system for the SVG clipping size
     m_view.SetPage(pageNo);
 
+    this->RenderToDeviceContext(m_view, m_doc.GetDrawingPageContext(), deviceContext);
+
+    return true;
+}
+
+void Toolkit::RenderToDeviceContext(View &view, const DrawingPageContext &context, DeviceContext *deviceContext)
+{
+    // Also called by the threads drawing pages concurrently
+    this->SetThreadLogUserData();
     // Adjusting page width and height according to the options
     int width = m_options->m_pageWidth.GetUnfactoredValue();
     int height = m_options->m_pageHeight.GetUnfactoredValue();
@@ -1462,12 +1774,12 @@ bool Toolkit::RenderToDeviceContext(int pageNo, DeviceContext *deviceContext)
     bool adjustHeight = m_options->m_adjustPageHeight.GetValue();
     bool adjustWidth = m_options->m_adjustPageWidth.GetValue();
 
-    if (adjustWidth || (breaks == BREAKS_none)) width = m_doc.GetAdjustedDrawingPageWidth();
-    if (adjustHeight || (breaks == BREAKS_none)) height = m_doc.GetAdjustedDrawingPageHeight();
+    if (adjustWidth || (breaks == BREAKS_none)) width = context.m_adjustedPageWidth;
+    if (adjustHeight || (breaks == BREAKS_none)) height = context.m_adjustedPageHeight;
 
     if (m_doc.GetType() == Transcription) {
-        width = m_doc.GetAdjustedDrawingPageWidth();
-        height = m_doc.GetAdjustedDrawingPageHeight();
+        width = context.m_adjustedPageWidth;
+        height = context.m_adjustedPageHeight;
     }
 
     // set dimensions
@@ -1475,7 +1787,7 @@ bool Toolkit::RenderToDeviceContext(int pageNo, DeviceContext *deviceContext)
         std::swap(height, width);
     }
 
-    double userScale = m_view.GetPPUFactor() * m_options->m_scale.GetValue() / 100;
+    double userScale = view.GetPPUFactor() * m_options->m_scale.GetValue() / 100;
     assert(userScale != 0.0);
 
     if (m_options->m_scaleToPageSize.GetValue()) {
@@ -1494,9 +1806,7 @@ bool Toolkit::RenderToDeviceContext(int pageNo, DeviceContext *deviceContext)
     }
 
     // render the page
-    m_view.DrawCurrentPage(deviceContext, false);
-
-    return true;
+    view.DrawCurrentPage(deviceContext, false);
 }
 
 std::string Toolkit::RenderData(const std::string &data, const std::string &jsonOptions)
@@ -1514,9 +1824,341 @@ std::string Toolkit::RenderToSVG(int pageNo, bool xmlDeclaration)
     int initialPageNo = (m_doc.GetDrawingPage() == NULL) ? -1 : m_doc.GetDrawingPage()->GetIdx();
     // Create the SVG object, h & w come from the system
     // We will need to set the size of the page after having drawn it depending on the options
-    SvgDeviceContext svg;
+    // When the memory is recycled, the device context of the previous page is reset and its buffers reused
+    std::unique_ptr<SvgDeviceContext> newSvg;
+    SvgDeviceContext *svg = NULL;
+    if (m_options->m_recycleMemory.GetValue()) {
+        if (m_svgDeviceContext) {
+            m_svgDeviceContext->Reset();
+        }
+        else {
+            m_svgDeviceContext = new SvgDeviceContext();
+        }
+        svg = m_svgDeviceContext;
+    }
+    else {
+        newSvg = std::make_unique<SvgDeviceContext>();
+        svg = newSvg.get();
+    }
+    this->SetSvgOptions(*svg);
+
+    // render the page
+    this->RenderToDeviceContext(pageNo, svg);
+
+    std::string out_str = svg->GetStringSVG(xmlDeclaration);
+    if (initialPageNo >= 0) m_doc.SetDrawingPage(initialPageNo);
+    return out_str;
+}
+
+std::vector<std::string> Toolkit::RenderPagesToSVG(int firstPageNo, int lastPageNo, bool xmlDeclaration)
+{
+    this->ResetLogBuffer();
+
+    std::vector<std::string> output;
+
+    firstPageNo = std::max(firstPageNo, 1);
+    lastPageNo = std::min(lastPageNo, this->GetPageCount());
+    if (firstPageNo > lastPageNo) return output;
+
+    const int pageCount = lastPageNo - firstPageNo + 1;
+    output.resize(pageCount);
+
+    int initialPageNo = (m_doc.GetDrawingPage() == NULL) ? -1 : m_doc.GetDrawingPage()->GetIdx();
+
+    int threadCount = std::min(GetThreadCount(m_options->m_threads.GetValue()), pageCount);
+
+    // Pages can be drawn concurrently only if they all have the same dimensions since some are read from the doc
+    bool concurrent = ((threadCount > 1) && (m_doc.GetType() != Transcription) && !m_doc.IsFacs()
+        && !m_options->m_adjustPageWidth.GetValue());
+    for (int pageNo = firstPageNo; concurrent && (pageNo <= lastPageNo); ++pageNo) {
+        const Page *page = vrv_cast<const Page *>(m_doc.GetPages()->GetChild(pageNo - 1));
+        assert(page);
+        if (page->m_pageHeight != -1) concurrent = false;
+    }
+
+    // Lay out the pages one after the other and keep their drawing context
+    // The device contexts are created in page order since each of them generates an id
+    std::vector<std::unique_ptr<SvgDeviceContext>> devices;
+    std::vector<DrawingPageContext> contexts;
+    for (int pageNo = firstPageNo; concurrent && (pageNo <= lastPageNo); ++pageNo) {
+        devices.push_back(std::make_unique<SvgDeviceContext>());
+        m_view.SetPage(pageNo - 1);
+        contexts.push_back(m_doc.GetDrawingPageContext());
+        if (!contexts.back().HasSameDimensions(contexts.front())) concurrent = false;
+    }
+
+    // Otherwise render them one by one
+    if (!concurrent) {
+        for (int i = 0; i < pageCount; ++i) {
+            if (i >= (int)devices.size()) devices.push_back(std::make_unique<SvgDeviceContext>());
+            this->SetSvgOptions(*devices.at(i));
+            this->RenderToDeviceContext(firstPageNo + i, devices.at(i).get());
+            output.at(i) = devices.at(i)->GetStringSVG(xmlDeclaration);
+            devices.at(i).reset();
+        }
+        if (initialPageNo >= 0) m_doc.SetDrawingPage(initialPageNo);
+        return output;
+    }
+
+    std::mutex sharedElementMutex;
+    std::atomic<int> nextPage = 0;
+    std::vector<std::vector<std::string>> threadLogs(threadCount);
+
+    auto drawPages = [&](int threadIdx) {
+        // The view creates objects - their ids must not depend on the thread either
+        IDCounterScope idCounterScope(contexts.front().m_idCounter);
+        View view;
+        view.SetDoc(&m_doc);
+        // The resources hold the current text style - each thread draws with its own copy
+        const Resources resources = m_doc.GetResources();
+        for (int i = nextPage++; i < pageCount; i = nextPage++) {
+            SvgDeviceContext *svg = devices.at(i).get();
+            this->SetSvgOptions(*svg);
+            svg->SetResources(&resources);
+            view.SetPageContext(contexts.at(i), &sharedElementMutex);
+            this->RenderToDeviceContext(view, contexts.at(i), svg);
+            output.at(i) = svg->GetStringSVG(xmlDeclaration);
+            devices.at(i).reset();
+        }
+        // The log buffer is per thread
+        if (threadIdx > 0) threadLogs.at(threadIdx) = logBuffer;
+    };
+
+    // The calling thread draws pages too
+    std::vector<std::thread> threads;
+    for (int threadIdx = 1; threadIdx < threadCount; ++threadIdx) {
+        try {
+            threads.emplace_back(drawPages, threadIdx);
+        }
+        catch (const std::system_error &error) {
+            LogWarning("Thread for drawing pages could not be started (%s)", error.what());
+            break;
+        }
+    }
+    drawPages(0);
+    for (std::thread &thread : threads) {
+        thread.join();
+    }
+
+    for (const std::vector<std::string> &messages : threadLogs) {
+        LogBufferAppend(messages);
+    }
+
+    if (initialPageNo >= 0) m_doc.SetDrawingPage(initialPageNo);
+    return output;
+}
+
+std::vector<std::string> Toolkit::RenderAllToSVG(bool xmlDeclaration)
+{
+    return this->RenderPagesToSVG(1, this->GetPageCount(), xmlDeclaration);
+}
+
+std::string Toolkit::RenderPAEBatch(const std::string &records, const std::string &jsonOptions)
+{
+    this->ResetLogBuffer();
+
+    bool includeMEI = false;
+
+    jsonxx::Object json;
+
+    // Read JSON options if not empty
+    if (!jsonOptions.empty()) {
+        if (!json.parse(jsonOptions)) {
+            LogWarning("Cannot parse JSON std::string. Using default options.");
+        }
+        else {
+            if (json.has<jsonxx::Boolean>("mei")) includeMEI = json.get<jsonxx::Boolean>("mei");
+        }
+    }
+
+    std::vector<PAEBatchRecord> batch;
+
+    // The records are either a JSON array or JSON Lines
+    size_t start = records.find_first_not_of(" \t\r\n");
+    if ((start != std::string::npos) && (records.at(start) == '[')) {
+        jsonxx::Array array;
+        if (!array.parse(records)) {
+            LogError("Cannot parse the JSON array of PAE records");
+            return "[]";
+        }
+        for (size_t i = 0; i < array.size(); ++i) {
+            PAEBatchRecord record;
+            if (array.has<jsonxx::Object>((unsigned)i)) {
+                record.m_input = array.get<jsonxx::Object>((unsigned)i).json();
+                ReadPAERecord(record.m_input, record);
+            }
+            else if (array.has<jsonxx::String>((unsigned)i)) {
+                record.m_input = array.get<jsonxx::String>((unsigned)i);
+            }
+            else {
+                LogWarning("PAE record %d is neither a JSON object nor a string", (int)i);
+            }
+            batch.push_back(record);
+        }
+    }
+    else {
+        std::istringstream stream(records);
+        std::string line;
+        while (std::getline(stream, line)) {
+            PAEBatchRecord record;
+            if (ReadPAERecord(line, record)) batch.push_back(record);
+        }
+    }
+
+    std::vector<std::unique_ptr<Toolkit>> workers = this->CreatePAEWorkers((int)batch.size());
+    this->RenderPAERecords(batch, 0, workers, includeMEI);
+
+    jsonxx::Array output;
+    for (const PAEBatchRecord &record : batch) {
+        jsonxx::Object o;
+        o << "id" << record.m_id;
+        o << "valid" << record.m_valid;
+        o << "svg" << record.m_svg;
+        if (includeMEI) o << "mei" << record.m_mei;
+        jsonxx::Array log;
+        for (const std::string &message : record.m_log) log << message;
+        o << "log" << log;
+        output << o;
+    }
+    return output.json();
+}
+
+int Toolkit::RenderPAEBatchStream(
+    std::istream &records, const std::function<void(const PAEBatchRecord &)> &callback, bool includeMEI)
+{
+    this->ResetLogBuffer();
+
+    // The worker toolkits are kept for the whole stream
+    std::vector<std::unique_ptr<Toolkit>> workers = this->CreatePAEWorkers(VRV_UNSET);
+    const int chunkSize = (int)workers.size() * 16;
+
+    int count = 0;
+    std::vector<PAEBatchRecord> chunk;
+    std::string line;
+    bool done = false;
+    while (!done) {
+        chunk.clear();
+        while ((int)chunk.size() < chunkSize) {
+            if (!std::getline(records, line)) {
+                done = true;
+                break;
+            }
+            PAEBatchRecord record;
+            if (ReadPAERecord(line, record)) chunk.push_back(record);
+        }
+        this->RenderPAERecords(chunk, count, workers, includeMEI);
+        for (const PAEBatchRecord &record : chunk) {
+            callback(record);
+        }
+        count += (int)chunk.size();
+    }
+    return count;
+}
+
+bool Toolkit::ReadPAERecord(const std::string &line, PAEBatchRecord &record)
+{
+    size_t start = line.find_first_not_of(" \t\r\n");
+    if (start == std::string::npos) return false;
+
+    if (record.m_input.empty()) record.m_input = line.substr(start);
+    // A single line PAE string without id
+    if (line.at(start) != '{') return true;
+
+    jsonxx::Object json;
+    if (!json.parse(record.m_input)) return true;
+    if (json.has<jsonxx::String>("id")) {
+        record.m_id = json.get<jsonxx::String>("id");
+    }
+    else if (json.has<jsonxx::Number>("id")) {
+        record.m_id = StringFormat("%g", json.get<jsonxx::Number>("id"));
+    }
+    return true;
+}
+
+std::vector<std::unique_ptr<Toolkit>> Toolkit::CreatePAEWorkers(int recordCount) const
+{
+    int threadCount = GetThreadCount(m_options->m_threads.GetValue());
+    if (recordCount != VRV_UNSET) threadCount = std::min(threadCount, recordCount);
+    threadCount = std::max(threadCount, 1);
+
+    // Each worker has its own document with the options of the toolkit and renders one record at a time
+    const std::string options = this->GetOptions();
+    std::vector<std::unique_ptr<Toolkit>> workers;
+    for (int i = 0; i < threadCount; ++i) {
+        workers.push_back(std::make_unique<Toolkit>(false));
+        workers.back()->SetResourcePath(this->GetResourcePath());
+        workers.back()->SetOptions(options);
+        workers.back()->m_options->m_threads.SetValue(1);
+        workers.back()->SetInputFrom("pae");
+        workers.back()->m_logCallbackUserData = m_logCallbackUserData;
+    }
+    return workers;
+}
+
+void Toolkit::RenderPAERecords(std::vector<PAEBatchRecord> &records, int firstIndex,
+    std::vector<std::unique_ptr<Toolkit>> &workers, bool includeMEI)
+{
+    const int recordCount = (int)records.size();
+    const int threadCount = std::min((int)workers.size(), recordCount);
+    if (threadCount == 0) return;
+
+    std::atomic<int> nextRecord = 0;
+
+    auto renderRecords = [&](int threadIdx) {
+        Toolkit *worker = workers.at(threadIdx).get();
+        for (int i = nextRecord++; i < recordCount; i = nextRecord++) {
+            worker->RenderPAERecord(records.at(i), firstIndex + i, includeMEI);
+        }
+    };
+
+    // The calling thread renders records too
+    std::vector<std::thread> threads;
+    for (int threadIdx = 1; threadIdx < threadCount; ++threadIdx) {
+        try {
+            threads.emplace_back(renderRecords, threadIdx);
+        }
+        catch (const std::system_error &error) {
+            LogWarning("Thread for rendering PAE records could not be started (%s)", error.what());
+            break;
+        }
+    }
+    // The log buffer of the calling thread is used for its records and needs to be restored afterwards
+    const std::vector<std::string> callerLog = logBuffer;
+    renderRecords(0);
+    for (std::thread &thread : threads) {
+        thread.join();
+    }
+
+    LogBufferClear();
+    LogBufferAppend(callerLog);
+}
+
+void Toolkit::RenderPAERecord(PAEBatchRecord &record, int index, bool includeMEI)
+{
+    // Seed the ids for each record so that they do not depend on the thread rendering it
+    if (m_options->m_xmlIdSeed.GetValue() != 0) {
+        Object::SeedID(m_options->m_xmlIdSeed.GetValue() + index);
+    }
+
+    LogBufferClear();
+    record.m_valid = this->LoadData(record.m_input);
+    if (record.m_valid) {
+        SvgDeviceContext svg;
+        this->SetSvgOptions(svg);
+        this->RenderToDeviceContext(1, &svg);
+        record.m_svg = svg.GetStringSVG();
+        if (includeMEI) record.m_mei = this->GetMEI();
+    }
+    record.m_log = logBuffer;
+}
+
+void Toolkit::SetSvgOptions(SvgDeviceContext &svg)
+{
     svg.SetResources(&m_doc.GetResources());
 
+    // the writer has to be selected before anything else is set
+    svg.SetStreaming(m_options->m_svgStreaming.GetValue());
+
     int indent = (m_options->m_outputIndentTab.GetValue()) ? -1 : m_options->m_outputIndent.GetValue();
     svg.SetIndent(indent);
 
@@ -1547,13 +2189,6 @@ std::string Toolkit::RenderToSVG(int pageNo, bool xmlDeclaration)
     svg.SetRemoveXlink(m_options->m_svgRemoveXlink.GetValue());
     svg.SetAdditionalAttributes(m_options->m_svgAdditionalAttribute.GetValue());
     svg.SetSmuflTextFont((option_SMUFLTEXTFONT)m_options->m_smuflTextFont.GetValue());
-
-    // render the page
-    this->RenderToDeviceContext(pageNo, &svg);
-
-    std::string out_str = svg.GetStringSVG(xmlDeclaration);
-    if (initialPageNo >= 0) m_doc.SetDrawingPage(initialPageNo);
-    return out_str;
 }
 
 bool Toolkit::RenderToSVGFile(const std::string &filename, int pageNo)
@@ -1601,6 +2236,14 @@ void Toolkit::GetHumdrum(std::ostream &output)
 }
 
 std::string Toolkit::RenderToMIDI()
+{
+    std::vector<unsigned char> output;
+    this->RenderToMIDIBuffer(output);
+
+    return Base64Encode(output.data(), (unsigned int)output.size());
+}
+
+bool Toolkit::RenderToMIDIBuffer(std::vector<unsigned char> &output)
 {
     this->ResetLogBuffer();
 
@@ -1609,12 +2252,10 @@ std::string Toolkit::RenderToMIDI()
     m_doc.ExportMIDI(&outputfile);
     outputfile.sortTracks();
 
-    std::stringstream stream;
-    outputfile.write(stream);
-    std::string outputstr = Base64Encode(
-        reinterpret_cast<const unsigned char *>(stream.str().c_str()), (unsigned int)stream.str().length());
-
-    return outputstr;
+    output.clear();
+    ByteStreamBuffer buffer(output);
+    std::ostream stream(&buffer);
+    return outputfile.write(stream);
 }
 
 std::string Toolkit::RenderToPAE()
@@ -1649,10 +2290,12 @@ bool Toolkit::RenderToPAEFile(const std::string &filename)
     return true;
 }
 
-std::string Toolkit::RenderToTimemap(const std::string &jsonOptions)
+void Toolkit::ReadTimemapOptions(
+    const std::string &jsonOptions, std::string &format, bool &includeRests, bool &includeMeasures) const
 {
-    bool includeMeasures = false;
-    bool includeRests = false;
+    format = "json";
+    includeMeasures = false;
+    includeRests = false;
 
     jsonxx::Object json;
 
@@ -1665,16 +2308,64 @@ std::string Toolkit::RenderToTimemap(const std::string &jsonOptions)
             if (json.has<jsonxx::Boolean>("includeMeasures"))
                 includeMeasures = json.get<jsonxx::Boolean>("includeMeasures");
             if (json.has<jsonxx::Boolean>("includeRests")) includeRests = json.get<jsonxx::Boolean>("includeRests");
+            if (json.has<jsonxx::String>("format")) format = json.get<jsonxx::String>("format");
         }
     }
 
+    if ((format != "json") && (format != "compact") && (format != "binary")) {
+        LogWarning("Unsupported timemap format '%s', using 'json'", format.c_str());
+        format = "json";
+    }
+}
+
+std::string Toolkit::RenderToTimemap(const std::string &jsonOptions)
+{
+    std::string format;
+    bool includeMeasures;
+    bool includeRests;
+    this->ReadTimemapOptions(jsonOptions, format, includeRests, includeMeasures);
+
     this->ResetLogBuffer();
 
     std::string output;
-    m_doc.ExportTimemap(output, includeRests, includeMeasures);
+    if (format == "json") {
+        m_doc.ExportTimemap(output, includeRests, includeMeasures);
+        return output;
+    }
+
+    Timemap timemap;
+    if (!m_doc.GenerateTimemap(timemap)) return (format == "compact") ? "{}" : "";
+
+    if (format == "compact") {
+        std::ostringstream stream;
+        timemap.ToCompactJson(stream, includeRests, includeMeasures);
+        output = stream.str();
+    }
+    else {
+        std::vector<unsigned char> buffer;
+        timemap.ToBinary(buffer, includeRests, includeMeasures);
+        output = Base64Encode(buffer.data(), (unsigned int)buffer.size());
+    }
     return output;
 }
 
+bool Toolkit::RenderToTimemapBuffer(std::vector<unsigned char> &output, const std::string &jsonOptions)
+{
+    std::string format;
+    bool includeMeasures;
+    bool includeRests;
+    this->ReadTimemapOptions(jsonOptions, format, includeRests, includeMeasures);
+
+    this->ResetLogBuffer();
+
+    output.clear();
+    Timemap timemap;
+    if (!m_doc.GenerateTimemap(timemap)) return false;
+
+    timemap.ToBinary(output, includeRests, includeMeasures);
+    return true;
+}
+
 std::string Toolkit::RenderToExpansionMap()
 {
     this->ResetLogBuffer();
@@ -1693,48 +2384,52 @@ std::string Toolkit::GetElementsAtTime(int millisec)
     jsonxx::Array chordArray;
     jsonxx::Array restArray;
 
-    // Here we need to check that the midi timemap is done
-    if (!m_doc.HasTimemap()) {
-        // generate MIDI timemap before progressing
-        m_doc.CalculateTimemap();
-    }
+    // Here we need to check that the midi timemap is done - this also updates the time index
+    const TimeIndex &timeIndex = m_doc.GetTimeIndex();
 
-    MeasureOnsetOffsetComparison matchMeasureTime(millisec);
-    Measure *measure = dynamic_cast<Measure *>(m_doc.FindDescendantByComparison(&matchMeasureTime));
+    // The first measure in the document order enclosing the time, with its first enclosing repeat
+    std::vector<const TimeIndexEntry *> entries;
+    timeIndex.FindMeasuresByRealTime(millisec, millisec, entries);
 
-    if (!measure) {
+    if (entries.empty()) {
         return o.json();
     }
 
-    int repeat = measure->EnclosesTime(millisec);
+    const Measure *measure = entries.front()->measure;
+    int repeat = entries.front()->repeat;
     int measureTimeOffset = measure->GetRealTimeOffsetMilliseconds(repeat);
 
     // Get the pageNo from the first note (if any)
     int pageNo = -1;
-    Page *page = vrv_cast<Page *>(measure->GetFirstAncestor(PAGE));
+    const Page *page = vrv_cast<const Page *>(measure->GetFirstAncestor(PAGE));
     if (page) pageNo = page->GetIdx() + 1;
 
-    NoteOrRestOnsetOffsetComparison matchTime(millisec - measureTimeOffset);
-    ListOfObjects notesOrRests;
-    ListOfObjects chords;
+    // Look for candidates around the time since the measure offset is truncated for the comparison
+    timeIndex.FindElementsByRealTime(millisec - 1, millisec + 1, entries);
 
-    measure->FindAllDescendantsByComparison(&notesOrRests, &matchTime);
+    NoteOrRestOnsetOffsetComparison matchTime(millisec - measureTimeOffset);
+    ListOfConstObjects chords;
+    const Object *previous = NULL;
 
     // Fill the JSON object
-    for (Object *object : notesOrRests) {
-        if (object->Is(NOTE)) {
-            noteArray << object->GetID();
-            Note *note = vrv_cast<Note *>(object);
+    for (const TimeIndexEntry *entry : entries) {
+        // Entries are ordered, so skip the other repeats of the same object
+        if ((entry->measure != measure) || (entry->object == previous)) continue;
+        previous = entry->object;
+        if (!matchTime(entry->object)) continue;
+        if (entry->object->Is(NOTE)) {
+            noteArray << entry->object->GetID();
+            const Note *note = vrv_cast<const Note *>(entry->object);
             assert(note);
-            Chord *chord = note->IsChordTone();
+            const Chord *chord = note->IsChordTone();
             if (chord) chords.push_back(chord);
         }
-        else if (object->Is(REST)) {
-            restArray << object->GetID();
+        else if (entry->object->Is(REST)) {
+            restArray << entry->object->GetID();
         }
     }
     chords.unique();
-    for (Object *object : chords) {
+    for (const Object *object : chords) {
         chordArray << object->GetID();
     }
 
@@ -1747,6 +2442,90 @@ std::string Toolkit::GetElementsAtTime(int millisec)
     return o.json();
 }
 
+std::string Toolkit::GetElementsInTimeRange(const std::string &jsonOptions)
+{
+    this->ResetLogBuffer();
+
+    double start = 0.0;
+    double end = 0.0;
+    bool scoreTime = false;
+
+    jsonxx::Object json;
+
+    if (!json.parse(jsonOptions)) {
+        LogWarning("Cannot parse JSON std::string.");
+    }
+    else {
+        if (json.has<jsonxx::Number>("start")) start = json.get<jsonxx::Number>("start");
+        if (json.has<jsonxx::Number>("end")) end = json.get<jsonxx::Number>("end");
+        if (json.has<jsonxx::Boolean>("scoreTime")) scoreTime = json.get<jsonxx::Boolean>("scoreTime");
+    }
+
+    jsonxx::Object o;
+    jsonxx::Array noteArray;
+    jsonxx::Array chordArray;
+    jsonxx::Array restArray;
+    jsonxx::Array measureArray;
+
+    if (end > start) {
+        const TimeIndex &timeIndex = m_doc.GetTimeIndex();
+
+        std::vector<const TimeIndexEntry *> entries;
+        // Only keep the entries overlapping the half-open range [start, end)
+        auto isInRange = [start, end, scoreTime](const TimeIndexEntry *entry) {
+            if (scoreTime) return ((entry->scoreTimeOnset < end) && (entry->scoreTimeOffset > start));
+            return ((entry->realTimeOnset < end) && (entry->realTimeOffset > start));
+        };
+
+        if (scoreTime) {
+            timeIndex.FindMeasuresByScoreTime(start, end, entries);
+        }
+        else {
+            timeIndex.FindMeasuresByRealTime(start, end, entries);
+        }
+        const Object *previous = NULL;
+        for (const TimeIndexEntry *entry : entries) {
+            if ((entry->object == previous) || !isInRange(entry)) continue;
+            previous = entry->object;
+            measureArray << entry->object->GetID();
+        }
+
+        if (scoreTime) {
+            timeIndex.FindElementsByScoreTime(start, end, entries);
+        }
+        else {
+            timeIndex.FindElementsByRealTime(start, end, entries);
+        }
+        ListOfConstObjects chords;
+        previous = NULL;
+        for (const TimeIndexEntry *entry : entries) {
+            if ((entry->object == previous) || !isInRange(entry)) continue;
+            previous = entry->object;
+            if (entry->object->Is(NOTE)) {
+                noteArray << entry->object->GetID();
+                const Note *note = vrv_cast<const Note *>(entry->object);
+                assert(note);
+                const Chord *chord = note->IsChordTone();
+                if (chord) chords.push_back(chord);
+            }
+            else if (entry->object->Is(REST)) {
+                restArray << entry->object->GetID();
+            }
+        }
+        chords.unique();
+        for (const Object *object : chords) {
+            chordArray << object->GetID();
+        }
+    }
+
+    o << "notes" << noteArray;
+    o << "chords" << chordArray;
+    o << "rests" << restArray;
+    o << "measures" << measureArray;
+
+    return o.json();
+}
+
 bool Toolkit::RenderToMIDIFile(const std::string &filename)
 {
     this->ResetLogBuffer();
@@ -1762,15 +2541,42 @@ bool Toolkit::RenderToMIDIFile(const std::string &filename)
 
 bool Toolkit::RenderToTimemapFile(const std::string &filename, const std::string &jsonOptions)
 {
-    std::string outputString = this->RenderToTimemap(jsonOptions);
+    std::string format;
+    bool includeMeasures;
+    bool includeRests;
+    this->ReadTimemapOptions(jsonOptions, format, includeRests, includeMeasures);
 
-    std::ofstream output(filename.c_str());
+    if (format == "json") {
+        std::string outputString = this->RenderToTimemap(jsonOptions);
+
+        std::ofstream output(filename.c_str());
+        if (!output.is_open()) {
+            return false;
+        }
+        output << outputString;
+
+        return true;
+    }
+
+    this->ResetLogBuffer();
+
+    Timemap timemap;
+    if (!m_doc.GenerateTimemap(timemap)) return false;
+
+    std::ofstream output(filename.c_str(), std::ios::binary);
     if (!output.is_open()) {
         return false;
     }
-    output << outputString;
+    if (format == "compact") {
+        timemap.ToCompactJson(output, includeRests, includeMeasures);
+    }
+    else {
+        std::vector<unsigned char> buffer;
+        timemap.ToBinary(buffer, includeRests, includeMeasures);
+        output.write(reinterpret_cast<const char *>(buffer.data()), buffer.size());
+    }
 
-    return true;
+    return output.good();
 }
 
 bool Toolkit::RenderToExpansionMapFile(const std::string &filename)
@@ -1806,11 +2612,18 @@ int Toolkit::GetPageWithElement(const std::string &xmlId)
         LogWarning("Element '%s' not found", xmlId.c_str());
         return 0;
     }
-    Page *page = vrv_cast<Page *>(element->GetFirstAncestor(PAGE));
-    if (!page) {
-        return 0;
-    }
-    return page->GetIdx() + 1;
+    return GetPageNoOfElement(element);
+}
+
+std::string Toolkit::GetPagesWithElements(const std::string &jsonQuery)
+{
+    ArrayOfIDObjectPairs elements;
+    if (!this->FindElementsForQuery(jsonQuery, elements)) return jsonxx::Object().json();
+
+    return WriteElementValues(elements, [](const std::string &xmlId, const Object *element) {
+        if (!element) LogWarning("Element '%s' not found", xmlId.c_str());
+        return std::to_string((element) ? GetPageNoOfElement(element) : 0);
+    });
 }
 
 int Toolkit::GetTimeForElement(const std::string &xmlId)
@@ -1824,41 +2637,11 @@ int Toolkit::GetTimeForElement(const std::string &xmlId)
         return 0;
     }
 
-    int timeofElement = 0;
-    if (!m_doc.HasTimemap()) {
-        // generate MIDI timemap before progressing
-        m_doc.CalculateTimemap();
-    }
+    const TimeIndex &timeIndex = m_doc.GetTimeIndex();
     if (!m_doc.HasTimemap()) {
         LogWarning("Calculation of MIDI timemap failed, time value is invalid.");
     }
-    if (element->Is(NOTE)) {
-        Note *note = vrv_cast<Note *>(element);
-        assert(note);
-        Measure *measure = vrv_cast<Measure *>(note->GetFirstAncestor(MEASURE));
-        assert(measure);
-        // For now ignore repeats and access always the first
-        timeofElement = measure->GetRealTimeOffsetMilliseconds(1);
-        timeofElement += note->GetRealTimeOnsetMilliseconds();
-    }
-    else if (element->Is(MEASURE)) {
-        Measure *measure = vrv_cast<Measure *>(element);
-        assert(measure);
-        // For now ignore repeats and access always the first
-        timeofElement = measure->GetRealTimeOffsetMilliseconds(1);
-    }
-    else if (element->Is(CHORD)) {
-        Chord *chord = vrv_cast<Chord *>(element);
-        assert(chord);
-        Note *note = vrv_cast<Note *>(chord->FindDescendantByType(NOTE));
-        assert(note);
-        Measure *measure = vrv_cast<Measure *>(note->GetFirstAncestor(MEASURE));
-        assert(measure);
-        // For now ignore repeats and access always the first
-        timeofElement = measure->GetRealTimeOffsetMilliseconds(1);
-        timeofElement += note->GetRealTimeOnsetMilliseconds();
-    }
-    return timeofElement;
+    return GetTimeOfElement(timeIndex, element);
 }
 
 std::string Toolkit::GetTimesForElement(const std::string &xmlId)
@@ -1873,46 +2656,40 @@ std::string Toolkit::GetTimesForElement(const std::string &xmlId)
         return o.json();
     }
 
-    jsonxx::Array scoreTimeOnset;
-    jsonxx::Array scoreTimeOffset;
-    jsonxx::Array scoreTimeDuration;
-    jsonxx::Array scoreTimeTiedDuration;
-    jsonxx::Array realTimeOnsetMilliseconds;
-    jsonxx::Array realTimeOffsetMilliseconds;
-
-    if (!m_doc.HasTimemap()) {
-        // generate MIDI timemap before progressing
-        m_doc.CalculateTimemap();
-    }
+    const TimeIndex &timeIndex = m_doc.GetTimeIndex();
     if (!m_doc.HasTimemap()) {
         LogWarning("Calculation of MIDI timemap failed, time value is invalid.");
         return o.json();
     }
     if (element->Is(NOTE)) {
+        FillTimesForNote(timeIndex, vrv_cast<Note *>(element), o);
+    }
+    return o.json();
+}
 
-        Note *note = vrv_cast<Note *>(element);
-        assert(note);
-        Measure *measure = vrv_cast<Measure *>(note->GetFirstAncestor(MEASURE));
-        assert(measure);
+std::string Toolkit::GetTimesForElements(const std::string &jsonQuery)
+{
+    this->ResetLogBuffer();
 
-        // For now ignore repeats and access always the first
-        double offset = measure->GetRealTimeOffsetMilliseconds(1);
-        realTimeOffsetMilliseconds << offset + note->GetRealTimeOffsetMilliseconds();
-        realTimeOnsetMilliseconds << offset + note->GetRealTimeOnsetMilliseconds();
-
-        scoreTimeOnset << note->GetScoreTimeOnset();
-        scoreTimeOffset << note->GetScoreTimeOffset();
-        scoreTimeDuration << note->GetScoreTimeDuration();
-        scoreTimeTiedDuration << note->GetScoreTimeTiedDuration();
-
-        o << "scoreTimeOnset" << scoreTimeOnset;
-        o << "scoreTimeOffset" << scoreTimeOffset;
-        o << "scoreTimeDuration" << scoreTimeDuration;
-        o << "scoreTimeTiedDuration" << scoreTimeTiedDuration;
-        o << "realTimeOnsetMilliseconds" << realTimeOnsetMilliseconds;
-        o << "realTimeOffsetMilliseconds" << realTimeOffsetMilliseconds;
+    ArrayOfIDObjectPairs elements;
+    if (!this->FindElementsForQuery(jsonQuery, elements)) return jsonxx::Object().json();
+
+    const TimeIndex &timeIndex = m_doc.GetTimeIndex();
+    const bool hasTimemap = m_doc.HasTimemap();
+    if (!hasTimemap) {
+        LogWarning("Calculation of MIDI timemap failed, time value is invalid.");
     }
-    return o.json();
+
+    return WriteElementValues(elements, [&timeIndex, hasTimemap](const std::string &xmlId, const Object *element) {
+        jsonxx::Object o;
+        if (!element) {
+            LogWarning("Element '%s' not found", xmlId.c_str());
+        }
+        else if (hasTimemap && element->Is(NOTE)) {
+            FillTimesForNote(timeIndex, vrv_cast<const Note *>(element), o);
+        }
+        return o.json();
+    });
 }
 
 std::string Toolkit::GetMIDIValuesForElement(const std::string &xmlId)
@@ -1936,18 +2713,36 @@ std::string Toolkit::GetMIDIValuesForElement(const std::string &xmlId)
             LogWarning("Calculation of MIDI timemap failed, time value is invalid.");
             return o.json();
         }
-        Note *note = vrv_cast<Note *>(element);
-        assert(note);
-        const int timeOfElement = this->GetTimeForElement(xmlId);
-        const int pitchOfElement = note->GetMIDIPitch();
-        const int durationOfElement = note->GetRealTimeOffsetMilliseconds() - note->GetRealTimeOnsetMilliseconds();
-        o << "time" << timeOfElement;
-        o << "pitch" << pitchOfElement;
-        o << "duration" << durationOfElement;
+        FillMIDIValuesForNote(m_doc.GetTimeIndex(), vrv_cast<Note *>(element), o);
     }
     return o.json();
 }
 
+std::string Toolkit::GetMIDIValuesForElements(const std::string &jsonQuery)
+{
+    this->ResetLogBuffer();
+
+    ArrayOfIDObjectPairs elements;
+    if (!this->FindElementsForQuery(jsonQuery, elements)) return jsonxx::Object().json();
+
+    const TimeIndex &timeIndex = m_doc.GetTimeIndex();
+    const bool hasTimemap = m_doc.HasTimemap();
+    if (!hasTimemap) {
+        LogWarning("Calculation of MIDI timemap failed, time value is invalid.");
+    }
+
+    return WriteElementValues(elements, [&timeIndex, hasTimemap](const std::string &xmlId, const Object *element) {
+        jsonxx::Object o;
+        if (!element) {
+            LogWarning("Element '%s' not found", xmlId.c_str());
+        }
+        else if (hasTimemap && element->Is(NOTE)) {
+            FillMIDIValuesForNote(timeIndex, vrv_cast<const Note *>(element), o);
+        }
+        return o.json();
+    });
+}
+
 void Toolkit::SetHumdrumBuffer(const char *data)
 {
     this->ClearHumdrumBuffer();
@@ -1968,6 +2763,7 @@ const char *Toolkit::GetHumdrumBuffer()
     else {
 #ifndef NO_HUMDRUM_SUPPORT
         // Convert from MEI to Humdrum
+        std::lock_guard<std::recursive_mutex> humlibLock(humlibMutex);
         MEIOutput meioutput(&m_doc);
         meioutput.SetScoreBasedMEI(true);
         std::string meidata = meioutput.GetOutput();
@@ -2032,6 +2828,7 @@ void Toolkit::SetInputFrom(FileFormat format)
 std::string Toolkit::ConvertMEIToHumdrum(const std::string &meiData)
 {
 #ifndef NO_HUMDRUM_SUPPORT
+    std::lock_guard<std::recursive_mutex> humlibLock(humlibMutex);
     hum::Tool_mei2hum converter;
     pugi::xml_document xmlfile;
     xmlfile.load_string(meiData.c_str());
@@ -2050,6 +2847,7 @@ std::string Toolkit::ConvertMEIToHumdrum(const std::string &meiData)
 std::string Toolkit::ConvertHumdrumToHumdrum(const std::string &humdrumData)
 {
 #ifndef NO_HUMDRUM_SUPPORT
+    std::lock_guard<std::recursive_mutex> humlibLock(humlibMutex);
 
     hum::HumdrumFileSet infiles;
     // bool result = infiles.readString(humdrumData);
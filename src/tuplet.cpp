@@ -137,6 +137,7 @@ void Tuplet::AddChild(Object *child)
         children.push_back(child);
     }
 
+    this->IndexChild(child);
     Modify();
 }
 
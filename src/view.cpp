@@ -20,6 +20,18 @@
 
 namespace vrv {
 
+//----------------------------------------------------------------------------
+// DrawingPageContext
+//----------------------------------------------------------------------------
+
+bool DrawingPageContext::HasSameDimensions(const DrawingPageContext &context) const
+{
+    return ((m_pageHeight == context.m_pageHeight) && (m_pageWidth == context.m_pageWidth)
+        && (m_pageContentHeight == context.m_pageContentHeight) && (m_pageContentWidth == context.m_pageContentWidth)
+        && (m_pageMarginBottom == context.m_pageMarginBottom) && (m_pageMarginLeft == context.m_pageMarginLeft)
+        && (m_pageMarginRight == context.m_pageMarginRight) && (m_pageMarginTop == context.m_pageMarginTop));
+}
+
 //----------------------------------------------------------------------------
 // View
 //----------------------------------------------------------------------------
@@ -30,6 +42,9 @@ View::View()
     m_options = NULL;
     m_pageIdx = 0;
     m_slurHandling = SlurHandling::Initialize;
+    m_measureFilters = NULL;
+    m_hasOwnPageContext = false;
+    m_sharedElementMutex = NULL;
 
     m_currentColor = AxNONE;
     m_currentElement = NULL;
@@ -60,6 +75,9 @@ void View::SetDoc(Doc *doc)
     m_currentSystem = NULL;
     m_currentPage = NULL;
     m_pageIdx = 0;
+    m_pageContext = DrawingPageContext();
+    m_hasOwnPageContext = false;
+    m_sharedElementMutex = NULL;
 }
 
 void View::SetPage(int pageIdx, bool doLayout)
@@ -82,6 +100,10 @@ void View::SetPage(int pageIdx, bool doLayout)
         }
     }
 
+    m_pageContext = m_doc->GetDrawingPageContext();
+    m_hasOwnPageContext = false;
+    m_sharedElementMutex = NULL;
+
     m_currentElement = NULL;
     m_currentLayer = NULL;
     m_currentMeasure = NULL;
@@ -92,6 +114,24 @@ void View::SetPage(int pageIdx, bool doLayout)
     DoRefresh();
 }
 
+void View::SetPageContext(const DrawingPageContext &context, std::mutex *sharedElementMutex)
+{
+    assert(m_doc);
+    assert(context.m_page);
+
+    m_pageIdx = context.m_page->GetIdx();
+    m_currentPage = context.m_page;
+    m_pageContext = context;
+    m_hasOwnPageContext = true;
+    m_sharedElementMutex = sharedElementMutex;
+
+    m_currentElement = NULL;
+    m_currentLayer = NULL;
+    m_currentMeasure = NULL;
+    m_currentStaff = NULL;
+    m_currentSystem = NULL;
+}
+
 bool View::HasNext(bool forward)
 {
     if (forward) return (m_doc && (m_doc->HasPage(m_pageIdx + 1)));
@@ -129,7 +169,7 @@ int View::ToDeviceContextY(int i)
         return 0;
     }
 
-    return (m_doc->m_drawingPageContentHeight - i); // flipped
+    return (m_pageContext.m_pageContentHeight - i); // flipped
 }
 
 /** y value in the Logical world  */
@@ -139,7 +179,7 @@ int View::ToLogicalY(int i)
         return 0;
     }
 
-    return m_doc->m_drawingPageContentHeight - i; // flipped
+    return m_pageContext.m_pageContentHeight - i; // flipped
 }
 
 Point View::ToDeviceContext(Point p)
@@ -175,6 +175,10 @@ void View::DrawTimeSpanningElement(DeviceContext *dc, Object *element, System *s
     assert(element);
     assert(system);
 
+    // The element can be drawn on other pages where it sets its current floating positioner
+    std::unique_lock<std::mutex> lock;
+    if (m_sharedElementMutex) lock = std::unique_lock<std::mutex>(*m_sharedElementMutex);
+
     if (dc->Is(BBOX_DEVICE_CONTEXT)) {
         BBoxDeviceContext *bBoxDC = vrv_cast<BBoxDeviceContext *>(dc);
         assert(bBoxDC);
@@ -759,23 +763,21 @@ void View::DrawOctave(
         x1 += lineWidth;
         if (altSymbols) x1 += extend.m_width / 2;
 
-        dc->SetPen(m_currentColor, lineWidth, AxSHORT_DASH, 0, gap, AxCAP_SQUARE);
-        dc->SetBrush(m_currentColor, AxSOLID);
-        if (octave->HasLform()) {
-            if (octave->GetLform() == LINEFORM_solid) {
-                dc->SetPen(m_currentColor, lineWidth, AxSOLID, 0, 0, AxCAP_SQUARE);
-                dc->SetBrush(m_currentColor, AxSOLID);
-            }
-            else if (octave->GetLform() == LINEFORM_dotted) {
-                if ((spanningType == SPANNING_START_END) || (spanningType == SPANNING_END)) {
-                    // round to nearest multiple
-                    const int diff = (x2 - x1) % (gap + 1);
-                    x2 += (gap - diff < diff) ? gap - diff : -diff;
-                }
-                dc->SetPen(m_currentColor, lineWidth * 3 / 2, AxDOT, 0, gap, AxCAP_ROUND);
-                dc->SetBrush(m_currentColor, AxSOLID);
+        if (octave->GetLform() == LINEFORM_solid) {
+            dc->SetPen(m_currentColor, lineWidth, AxSOLID, 0, 0, AxCAP_SQUARE);
+        }
+        else if (octave->GetLform() == LINEFORM_dotted) {
+            if ((spanningType == SPANNING_START_END) || (spanningType == SPANNING_END)) {
+                // round to nearest multiple
+                const int diff = (x2 - x1) % (gap + 1);
+                x2 += (gap - diff < diff) ? gap - diff : -diff;
             }
+            dc->SetPen(m_currentColor, lineWidth * 3 / 2, AxDOT, 0, gap, AxCAP_ROUND);
         }
+        else {
+            dc->SetPen(m_currentColor, lineWidth, AxSHORT_DASH, 0, gap, AxCAP_SQUARE);
+        }
+        dc->SetBrush(m_currentColor, AxSOLID);
 
         // adjust vertical ends
         y1 += (disPlace == STAFFREL_basic_above) ? -lineWidth / 2 : lineWidth / 2;
@@ -799,6 +801,7 @@ void View::DrawOctave(
                         m_currentColor, lineWidth * 3 / 2, AxDOT, 0, std::min(gap, unit * 2 - lineWidth), AxCAP_ROUND);
                     dc->DrawLine(
                         ToDeviceContextX(x2), ToDeviceContextY(y1), ToDeviceContextX(x2), ToDeviceContextY(y2));
+                    dc->ResetPen();
                 }
                 else {
                     dc->SetPen(m_currentColor, lineWidth, AxSOLID);
@@ -808,9 +811,13 @@ void View::DrawOctave(
                     hookRight[1] = { ToDeviceContextX(x2), ToDeviceContextY(y1) };
                     hookRight[2] = { ToDeviceContextX(x2 - unit), ToDeviceContextY(y1) };
                     dc->DrawPolyline(3, hookRight);
+                    dc->ResetPen();
                 }
             }
         }
+
+        dc->ResetBrush();
+        dc->ResetPen();
     }
 
     if (graphic) {
@@ -68,7 +68,13 @@ void View::DrawCurrentPage(DeviceContext *dc, bool background)
     const bool dcHasResources = dc->HasResources();
     if (!dcHasResources) dc->SetResources(&m_doc->GetResources());
 
-    m_currentPage = m_doc->SetDrawingPage(m_pageIdx);
+    if (!m_hasOwnPageContext) {
+        m_currentPage = m_doc->SetDrawingPage(m_pageIdx);
+        m_pageContext = m_doc->GetDrawingPageContext();
+    }
+
+    // The temporary objects created when drawing do not consume the ids of the thread
+    IDCounterScope idCounterScope(m_pageContext.m_idCounter);
 
     // Keep the width of the initial scoreDef
     SetScoreDefDrawingWidth(dc, &m_currentPage->m_drawingScoreDef);
@@ -77,8 +83,8 @@ void View::DrawCurrentPage(DeviceContext *dc, bool background)
     // The page one has previously been set by the ScoreDefSetCurrentFunctor
     m_drawingScoreDef = m_currentPage->m_drawingScoreDef;
 
-    if ((m_doc->GetAdjustedDrawingPageHeight() > dc->GetHeight()) && m_options->m_shrinkToFit.GetValue()) {
-        dc->SetContentHeight(m_doc->GetAdjustedDrawingPageHeight());
+    if ((m_pageContext.m_adjustedPageHeight > dc->GetHeight()) && m_options->m_shrinkToFit.GetValue()) {
+        dc->SetContentHeight(m_pageContext.m_adjustedPageHeight);
     }
     else {
         dc->SetContentHeight(dc->GetHeight());
@@ -88,7 +94,7 @@ void View::DrawCurrentPage(DeviceContext *dc, bool background)
     dc->DrawBackgroundImage();
 
     Point origin = dc->GetLogicalOrigin();
-    dc->SetLogicalOrigin(origin.x - m_doc->m_drawingPageMarginLeft, origin.y - m_doc->m_drawingPageMarginTop);
+    dc->SetLogicalOrigin(origin.x - m_pageContext.m_pageMarginLeft, origin.y - m_pageContext.m_pageMarginTop);
 
     dc->StartPage();
 
@@ -113,6 +119,69 @@ void View::DrawCurrentPage(DeviceContext *dc, bool background)
     if (!dcHasResources) dc->ResetResources();
 }
 
+void View::DrawCurrentPageRunningElements(DeviceContext *dc)
+{
+    assert(dc);
+    assert(m_doc);
+
+    const bool dcHasResources = dc->HasResources();
+    if (!dcHasResources) dc->SetResources(&m_doc->GetResources());
+
+    if (!m_hasOwnPageContext) {
+        m_currentPage = m_doc->SetDrawingPage(m_pageIdx);
+        m_pageContext = m_doc->GetDrawingPageContext();
+    }
+
+    IDCounterScope idCounterScope(m_pageContext.m_idCounter);
+
+    // Keep the width of the initial scoreDef
+    SetScoreDefDrawingWidth(dc, &m_currentPage->m_drawingScoreDef);
+
+    // Set the current score def to the page one as in DrawCurrentPage
+    m_drawingScoreDef = m_currentPage->m_drawingScoreDef;
+
+    Point origin = dc->GetLogicalOrigin();
+    dc->SetLogicalOrigin(origin.x - m_pageContext.m_pageMarginLeft, origin.y - m_pageContext.m_pageMarginTop);
+
+    dc->StartPage();
+    this->DrawRunningElements(dc, m_currentPage);
+    dc->EndPage();
+
+    if (!dcHasResources) dc->ResetResources();
+}
+
+void View::DrawCurrentPageSystem(DeviceContext *dc, System *system)
+{
+    assert(dc);
+    assert(m_doc);
+    assert(system);
+
+    const bool dcHasResources = dc->HasResources();
+    if (!dcHasResources) dc->SetResources(&m_doc->GetResources());
+
+    if (!m_hasOwnPageContext) {
+        m_currentPage = m_doc->SetDrawingPage(m_pageIdx);
+        m_pageContext = m_doc->GetDrawingPageContext();
+    }
+    assert(system->GetParent() == m_currentPage);
+
+    // One counter per system since the systems of a page can be drawn concurrently
+    IDCounterScope idCounterScope(Object::Hash(m_pageContext.m_idCounter + system->GetIdx(), true));
+
+    // Only the measure number visibility of the page scoreDef is used for drawing the system - copy it instead of
+    // the entire scoreDef since this would generate new ids
+    m_drawingScoreDef.SetMnumVisible(m_currentPage->m_drawingScoreDef.GetMnumVisible());
+
+    Point origin = dc->GetLogicalOrigin();
+    dc->SetLogicalOrigin(origin.x - m_pageContext.m_pageMarginLeft, origin.y - m_pageContext.m_pageMarginTop);
+
+    dc->StartPage();
+    this->DrawSystem(dc, system);
+    dc->EndPage();
+
+    if (!dcHasResources) dc->ResetResources();
+}
+
 double View::GetPPUFactor() const
 {
     if (!m_currentPage) return 1.0;
@@ -1550,6 +1619,8 @@ void View::DrawSystemDivider(DeviceContext *dc, System *system, Measure *firstMe
     if (!firstMeasure || (m_options->m_systemDivider.GetValue() == SYSTEMDIVIDER_none)) return;
     // No system divider if we are on the first system of a page or of an mdiv
     if (system->IsFirstInPage() || system->IsFirstOfMdiv()) return;
+    // Only drawn for optimized systems in auto mode
+    if (!system->IsDrawingOptimized() && (m_options->m_systemDivider.GetValue() <= SYSTEMDIVIDER_auto)) return;
 
     // initialize to zero, first measure is not supposed to have system divider
     int previousSystemBottomMarginY = 0;
@@ -1572,38 +1643,36 @@ void View::DrawSystemDivider(DeviceContext *dc, System *system, Measure *firstMe
         }
     }
 
-    if ((system->IsDrawingOptimized() || (m_options->m_systemDivider.GetValue() > SYSTEMDIVIDER_auto))) {
-        int y = system->GetDrawingY();
-        Staff *staff = firstMeasure->GetTopVisibleStaff();
-        if (staff) {
-            // Place it in the middle of current and previous systems - in very tight layout this can collision with
-            // the staff above. To be improved
-            y = (staff->GetDrawingY() + previousSystemBottomMarginY) / 2;
-        }
-        int x1 = system->GetDrawingX() - m_doc->GetDrawingUnit(100) * 3;
-        int x2 = system->GetDrawingX() + m_doc->GetDrawingUnit(100) * 3;
-        int y1 = y - m_doc->GetDrawingUnit(100) * 1;
-        int y2 = y + m_doc->GetDrawingUnit(100) * 3;
-        int y3 = y1 + m_doc->GetDrawingUnit(100) * 2;
-        int y4 = y2 + m_doc->GetDrawingUnit(100) * 2;
-        // left and left-right
-        dc->StartCustomGraphic("systemDivider");
-
-        this->DrawObliquePolygon(dc, x1, y1, x2, y2, m_doc->GetDrawingUnit(100) * 1.5);
-        this->DrawObliquePolygon(dc, x1, y3, x2, y4, m_doc->GetDrawingUnit(100) * 1.5);
-        if (m_options->m_systemDivider.GetValue() == SYSTEMDIVIDER_left_right) {
-            // Right divider is not taken into account in the layout calculation and can collision with the music
-            // content
-            Measure *lastMeasure = vrv_cast<Measure *>(system->FindDescendantByType(MEASURE, 1, BACKWARD));
-            assert(lastMeasure);
-            int x4 = lastMeasure->GetDrawingX() + lastMeasure->GetRightBarLineRight();
-            int x3 = x4 - m_doc->GetDrawingUnit(100) * 6;
-            this->DrawObliquePolygon(dc, x3, y1, x4, y2, m_doc->GetDrawingUnit(100) * 1.5);
-            this->DrawObliquePolygon(dc, x3, y3, x4, y4, m_doc->GetDrawingUnit(100) * 1.5);
-        }
-
-        dc->EndCustomGraphic();
+    int y = system->GetDrawingY();
+    Staff *staff = firstMeasure->GetTopVisibleStaff();
+    if (staff) {
+        // Place it in the middle of current and previous systems - in very tight layout this can collision with
+        // the staff above. To be improved
+        y = (staff->GetDrawingY() + previousSystemBottomMarginY) / 2;
+    }
+    int x1 = system->GetDrawingX() - m_doc->GetDrawingUnit(100) * 3;
+    int x2 = system->GetDrawingX() + m_doc->GetDrawingUnit(100) * 3;
+    int y1 = y - m_doc->GetDrawingUnit(100) * 1;
+    int y2 = y + m_doc->GetDrawingUnit(100) * 3;
+    int y3 = y1 + m_doc->GetDrawingUnit(100) * 2;
+    int y4 = y2 + m_doc->GetDrawingUnit(100) * 2;
+    // left and left-right
+    dc->StartCustomGraphic("systemDivider");
+
+    this->DrawObliquePolygon(dc, x1, y1, x2, y2, m_doc->GetDrawingUnit(100) * 1.5);
+    this->DrawObliquePolygon(dc, x1, y3, x2, y4, m_doc->GetDrawingUnit(100) * 1.5);
+    if (m_options->m_systemDivider.GetValue() == SYSTEMDIVIDER_left_right) {
+        // Right divider is not taken into account in the layout calculation and can collision with the music
+        // content
+        Measure *lastMeasure = vrv_cast<Measure *>(system->FindDescendantByType(MEASURE, 1, BACKWARD));
+        assert(lastMeasure);
+        int x4 = lastMeasure->GetDrawingX() + lastMeasure->GetRightBarLineRight();
+        int x3 = x4 - m_doc->GetDrawingUnit(100) * 6;
+        this->DrawObliquePolygon(dc, x3, y1, x4, y2, m_doc->GetDrawingUnit(100) * 1.5);
+        this->DrawObliquePolygon(dc, x3, y3, x4, y4, m_doc->GetDrawingUnit(100) * 1.5);
     }
+
+    dc->EndCustomGraphic();
 }
 
 //----------------------------------------------------------------------------
@@ -1618,6 +1687,7 @@ void View::DrawSystemChildren(DeviceContext *dc, Object *parent, System *system)
 
     for (Object *current : parent->GetChildren()) {
         if (current->Is(MEASURE)) {
+            if (m_measureFilters && !m_measureFilters->Apply(current)) continue;
             // cast to Measure check in DrawMeasure
             this->DrawMeasure(dc, vrv_cast<Measure *>(current), system);
         }
@@ -644,12 +644,26 @@ void View::DrawRunningElements(DeviceContext *dc, Page *page)
         if (!bBoxDC->UpdateVerticalValues()) return;
     }
 
+    // The header and the footer are shared between pages - their page has to be set when drawing concurrently
+    std::unique_lock<std::mutex> lock;
+    if (m_sharedElementMutex) lock = std::unique_lock<std::mutex>(*m_sharedElementMutex);
+
     RunningElement *header = page->GetHeader();
     if (header) {
+        if (m_hasOwnPageContext) {
+            header->SetDrawingPage(page);
+            header->SetDrawingYRel(m_pageContext.m_headerYRel);
+            header->SetCellDrawingYRels(m_pageContext.m_headerCellYRels);
+        }
         this->DrawTextLayoutElement(dc, header);
     }
     RunningElement *footer = page->GetFooter();
     if (footer) {
+        if (m_hasOwnPageContext) {
+            footer->SetDrawingPage(page);
+            footer->SetDrawingYRel(m_pageContext.m_footerYRel);
+            footer->SetCellDrawingYRels(m_pageContext.m_footerCellYRels);
+        }
         this->DrawTextLayoutElement(dc, footer);
     }
 }
@@ -9,14 +9,21 @@
 
 //----------------------------------------------------------------------------
 
+#include <algorithm>
 #include <cassert>
 #include <cmath>
 #include <codecvt>
+#include <condition_variable>
 #include <cstdlib>
+#include <deque>
 #include <iostream>
 #include <locale>
+#include <memory>
+#include <mutex>
 #include <regex>
 #include <sstream>
+#include <thread>
+#include <unordered_set>
 #include <vector>
 
 #ifndef _WIN32
@@ -64,12 +71,23 @@ namespace vrv {
 struct timeval start;
 
 /** For controlling the log level - warning level enabled by default */
-LogLevel logLevel = LOG_WARNING;
+std::atomic<LogLevel> logLevel = LOG_WARNING;
 
 /** By default log to stderr or JS console */
-bool loggingToBuffer = false;
+std::atomic<bool> loggingToBuffer = false;
 
-std::vector<std::string> logBuffer;
+/** The log buffer with a set of its messages for skipping duplicates - one per thread */
+thread_local std::vector<std::string> logBuffer;
+thread_local std::unordered_set<std::string> logBufferSet;
+
+/** The callback replacing the buffer or the console (if any) - the mutex only protects setting it */
+std::atomic<bool> loggingToCallback = false;
+LogCallback logCallback = NULL;
+void *logCallbackUserData = NULL;
+std::mutex logCallbackMutex;
+
+/** The user data of the toolkit used on the thread, given to the callback instead of the global one when not NULL */
+thread_local void *logToolkitUserData = NULL;
 
 void LogElapsedTimeStart()
 {
@@ -138,8 +156,23 @@ void LogWarning(const char *fmt, ...)
 
 void LogString(std::string message, LogLevel level)
 {
+    if (loggingToCallback) {
+        LogCallback callback = NULL;
+        void *userData = NULL;
+        {
+            const std::lock_guard<std::mutex> lock(logCallbackMutex);
+            callback = logCallback;
+            userData = logCallbackUserData;
+        }
+        // Call it without holding the lock so that it can log or set the callback itself
+        if (callback) {
+            callback(level, message.c_str(), (logToolkitUserData) ? logToolkitUserData : userData);
+            return;
+        }
+    }
+
     if (loggingToBuffer) {
-        if (LogBufferContains(message)) return;
+        if (!logBufferSet.insert(message).second) return;
         logBuffer.push_back(message);
     }
     else {
@@ -179,10 +212,31 @@ LogLevel StrToLogLevel(const std::string &level)
 
 bool LogBufferContains(const std::string &s)
 {
-    for (const std::string &logStr : logBuffer) {
-        if (logStr == s) return true;
+    return (logBufferSet.count(s) > 0);
+}
+
+void LogBufferClear()
+{
+    logBuffer.clear();
+    logBufferSet.clear();
+}
+
+void SetLogToolkitUserData(void *userData)
+{
+    logToolkitUserData = userData;
+}
+
+void *GetLogToolkitUserData()
+{
+    return logToolkitUserData;
+}
+
+void LogBufferAppend(const std::vector<std::string> &messages)
+{
+    for (const std::string &message : messages) {
+        if (!logBufferSet.insert(message).second) continue;
+        logBuffer.push_back(message);
     }
-    return false;
 }
 
 bool Check(Object *object)
@@ -205,10 +259,30 @@ void EnableLogToBuffer(bool value)
     loggingToBuffer = value;
 }
 
+void SetLogCallback(LogCallback callback, void *userData)
+{
+    const std::lock_guard<std::mutex> lock(logCallbackMutex);
+    logCallback = callback;
+    logCallbackUserData = userData;
+    loggingToCallback = (callback != NULL);
+}
+
 //----------------------------------------------------------------------------
 // Various helpers
 //----------------------------------------------------------------------------
 
+struct tm GetLocalTime()
+{
+    const time_t t = time(0);
+    struct tm now;
+#ifndef _WIN32
+    localtime_r(&t, &now);
+#else
+    localtime_s(&now, &t);
+#endif
+    return now;
+}
+
 std::string StringFormat(const char *fmt, ...)
 {
     std::string str(STRING_FORMAT_MAX_LEN, 0);
@@ -236,20 +310,20 @@ bool AreEqual(double dFirstVal, double dSecondVal)
 bool IsValidInteger(const std::string &value)
 {
     // Accept "1" " 1 " "+1" "-1" "1." "1.0"
-    std::regex re(R"(^\s*[+-]?\d+\.?\d*\s*$)");
+    static const std::regex re(R"(^\s*[+-]?\d+\.?\d*\s*$)");
     return std::regex_match(value, re);
 }
 
 bool IsValidDouble(const std::string &value)
 {
     // Accept "1.0" " 1.0 " ".0"  "1." "+1.0" "-1.0"
-    std::regex re(R"(^\s*[+-]?(?:\d+\.?\d*|\.\d+)\s*$)");
+    static const std::regex re(R"(^\s*[+-]?(?:\d+\.?\d*|\.\d+)\s*$)");
     return std::regex_match(value, re);
 }
 
 bool IsDigits(const std::string &value)
 {
-    std::regex re(R"(^\d+$)");
+    static const std::regex re(R"(^\d+$)");
     return std::regex_match(value, re);
 }
 
@@ -301,6 +375,130 @@ std::string GetVersion()
     return StringFormat("%d.%d.%d%s%s", VERSION_MAJOR, VERSION_MINOR, VERSION_REVISION, dev.c_str(), GIT_COMMIT);
 }
 
+int GetThreadCount(int threads)
+{
+#if defined(__EMSCRIPTEN__) && !defined(__EMSCRIPTEN_PTHREADS__)
+    // No thread can be started in a WebAssembly build without pthreads
+    return 1;
+#else
+    if (threads == 0) threads = std::thread::hardware_concurrency();
+    return std::max(threads, 1);
+#endif
+}
+
+//----------------------------------------------------------------------------
+// ThreadPool
+//----------------------------------------------------------------------------
+
+/**
+ * This class is the pool of worker threads used by RunConcurrently.
+ * A job is queued once for each worker it can use. The tasks are then taken from the job with an atomic index by
+ * the workers and by the calling thread until there is none left.
+ */
+class ThreadPool {
+public:
+    struct Job {
+        Job(int taskCount, const std::function<void(int)> &task) : m_taskCount(taskCount), m_task(task) {}
+
+        // Run the tasks left and notify the calling thread when the last one is done
+        void Work()
+        {
+            for (int i = m_next++; i < m_taskCount; i = m_next++) {
+                m_task(i);
+                if (++m_done == m_taskCount) {
+                    std::lock_guard<std::mutex> lock(m_mutex);
+                    m_condition.notify_all();
+                }
+            }
+        }
+
+        const int m_taskCount;
+        const std::function<void(int)> m_task;
+        std::atomic<int> m_next = 0;
+        std::atomic<int> m_done = 0;
+        std::mutex m_mutex;
+        std::condition_variable m_condition;
+    };
+
+    ThreadPool() : m_stop(false) {}
+
+    ~ThreadPool()
+    {
+        {
+            std::lock_guard<std::mutex> lock(m_mutex);
+            m_stop = true;
+        }
+        m_condition.notify_all();
+        for (std::thread &worker : m_workers) worker.join();
+    }
+
+    void Run(const std::shared_ptr<Job> &job, int workerCount)
+    {
+        {
+            std::lock_guard<std::mutex> lock(m_mutex);
+            // Start the workers missing, one less than the number of cores since the calling thread works too
+            const int maxWorkers = std::max((int)std::thread::hardware_concurrency() - 1, 0);
+            while ((int)m_workers.size() < std::min(workerCount, maxWorkers)) {
+                try {
+                    m_workers.emplace_back(&ThreadPool::Work, this);
+                }
+                catch (const std::system_error &error) {
+                    LogWarning("Thread for the pool could not be started (%s)", error.what());
+                    break;
+                }
+            }
+            workerCount = std::min(workerCount, (int)m_workers.size());
+            for (int i = 0; i < workerCount; ++i) m_jobs.push_back(job);
+        }
+        if (workerCount > 0) m_condition.notify_all();
+
+        job->Work();
+        std::unique_lock<std::mutex> lock(job->m_mutex);
+        job->m_condition.wait(lock, [&job] { return (job->m_done == job->m_taskCount); });
+    }
+
+private:
+    void Work()
+    {
+        while (true) {
+            std::shared_ptr<Job> job;
+            {
+                std::unique_lock<std::mutex> lock(m_mutex);
+                m_condition.wait(lock, [this] { return (m_stop || !m_jobs.empty()); });
+                if (m_stop) return;
+                job = m_jobs.front();
+                m_jobs.pop_front();
+            }
+            job->Work();
+        }
+    }
+
+    std::mutex m_mutex;
+    std::condition_variable m_condition;
+    std::deque<std::shared_ptr<Job>> m_jobs;
+    std::vector<std::thread> m_workers;
+    bool m_stop;
+};
+
+void RunConcurrently(int taskCount, int threadCount, const std::function<void(int)> &task)
+{
+    threadCount = std::min(GetThreadCount(threadCount), taskCount);
+    if (threadCount <= 1) {
+        for (int i = 0; i < taskCount; ++i) task(i);
+        return;
+    }
+
+    // The workers log with the user data of the calling thread
+    void *logUserData = GetLogToolkitUserData();
+    auto logTask = [&task, logUserData](int i) {
+        SetLogToolkitUserData(logUserData);
+        task(i);
+    };
+
+    static ThreadPool pool;
+    pool.Run(std::make_shared<ThreadPool::Job>(taskCount, logTask), threadCount - 1);
+}
+
 static const std::string base62Chars = "0123456789abcdefghijklmnopqrstuvwxyzABCDEFGHIJKLMNOPQRSTUVWXYZ";
 
 std::string BaseEncodeInt(uint32_t value, uint8_t base)
@@ -322,8 +520,8 @@ std::string BaseEncodeInt(uint32_t value, uint8_t base)
 
 std::string FromCamelCase(const std::string &s)
 {
-    std::regex regExp1("(.)([A-Z][a-z]+)");
-    std::regex regExp2("([a-z0-9])([A-Z])");
+    static const std::regex regExp1("(.)([A-Z][a-z]+)");
+    static const std::regex regExp2("([a-z0-9])([A-Z])");
 
     std::string result = s;
     result = std::regex_replace(result, regExp1, "$1-$2");
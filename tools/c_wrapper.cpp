@@ -9,6 +9,10 @@
 #include "toolkit.h"
 #include "vrv.h"
 
+//----------------------------------------------------------------------------
+
+#include "jsonxx.h"
+
 using namespace std;
 using namespace vrv;
 
@@ -24,6 +28,11 @@ void enableLogToBuffer(bool value)
     EnableLogToBuffer(value);
 }
 
+void setLogCallback(void (*callback)(int level, const char *message, void *userData), void *userData)
+{
+    SetLogCallback(callback, userData);
+}
+
 /****************************************************************
  * Methods exported to use the Toolkit class
  ****************************************************************/
@@ -94,6 +103,13 @@ const char *vrvToolkit_getElementAttr(void *tkPtr, const char *xmlId)
     return tk->GetCString();
 }
 
+const char *vrvToolkit_getElementsAttr(void *tkPtr, const char *c_query)
+{
+    Toolkit *tk = static_cast<Toolkit *>(tkPtr);
+    tk->SetCString(tk->GetElementsAttr(c_query));
+    return tk->GetCString();
+}
+
 const char *vrvToolkit_getElementsAtTime(void *tkPtr, int millisec)
 {
     Toolkit *tk = static_cast<Toolkit *>(tkPtr);
@@ -101,6 +117,13 @@ const char *vrvToolkit_getElementsAtTime(void *tkPtr, int millisec)
     return tk->GetCString();
 }
 
+const char *vrvToolkit_getElementsInTimeRange(void *tkPtr, const char *options)
+{
+    Toolkit *tk = static_cast<Toolkit *>(tkPtr);
+    tk->SetCString(tk->GetElementsInTimeRange(options));
+    return tk->GetCString();
+}
+
 const char *vrvToolkit_getExpansionIdsForElement(void *tkPtr, const char *xmlId)
 {
     Toolkit *tk = static_cast<Toolkit *>(tkPtr);
@@ -159,6 +182,13 @@ const char *vrvToolkit_getMIDIValuesForElement(void *tkPtr, const char *xmlId)
     return tk->GetCString();
 }
 
+const char *vrvToolkit_getMIDIValuesForElements(void *tkPtr, const char *c_query)
+{
+    Toolkit *tk = static_cast<Toolkit *>(tkPtr);
+    tk->SetCString(tk->GetMIDIValuesForElements(c_query));
+    return tk->GetCString();
+}
+
 const char *vrvToolkit_getNotatedIdForElement(void *tkPtr, const char *xmlId)
 {
     Toolkit *tk = static_cast<Toolkit *>(tkPtr);
@@ -192,6 +222,13 @@ int vrvToolkit_getPageWithElement(void *tkPtr, const char *xmlId)
     return tk->GetPageWithElement(xmlId);
 }
 
+const char *vrvToolkit_getPagesWithElements(void *tkPtr, const char *c_query)
+{
+    Toolkit *tk = static_cast<Toolkit *>(tkPtr);
+    tk->SetCString(tk->GetPagesWithElements(c_query));
+    return tk->GetCString();
+}
+
 double vrvToolkit_getTimeForElement(void *tkPtr, const char *xmlId)
 {
     Toolkit *tk = static_cast<Toolkit *>(tkPtr);
@@ -205,6 +242,13 @@ const char *vrvToolkit_getTimesForElement(void *tkPtr, const char *xmlId)
     return tk->GetCString();
 }
 
+const char *vrvToolkit_getTimesForElements(void *tkPtr, const char *c_query)
+{
+    Toolkit *tk = static_cast<Toolkit *>(tkPtr);
+    tk->SetCString(tk->GetTimesForElements(c_query));
+    return tk->GetCString();
+}
+
 const char *vrvToolkit_getVersion(void *tkPtr)
 {
     Toolkit *tk = static_cast<Toolkit *>(tkPtr);
@@ -249,6 +293,24 @@ const char *vrvToolkit_renderData(void *tkPtr, const char *data, const char *opt
     return tk->GetCString();
 }
 
+const char *vrvToolkit_renderPAEBatch(void *tkPtr, const char *records, const char *options)
+{
+    Toolkit *tk = static_cast<Toolkit *>(tkPtr);
+    tk->SetCString(tk->RenderPAEBatch(records, options));
+    return tk->GetCString();
+}
+
+const char *vrvToolkit_renderPagesToSVG(void *tkPtr, int firstPageNo, int lastPageNo, bool xmlDeclaration)
+{
+    Toolkit *tk = static_cast<Toolkit *>(tkPtr);
+    jsonxx::Array pages;
+    for (const std::string &page : tk->RenderPagesToSVG(firstPageNo, lastPageNo, xmlDeclaration)) {
+        pages << page;
+    }
+    tk->SetCString(pages.json());
+    return tk->GetCString();
+}
+
 const char *vrvToolkit_renderToExpansionMap(void *tkPtr)
 {
     Toolkit *tk = static_cast<Toolkit *>(tkPtr);
@@ -263,6 +325,14 @@ const char *vrvToolkit_renderToMIDI(void *tkPtr, const char *c_options)
     return tk->GetCString();
 }
 
+const unsigned char *vrvToolkit_renderToMIDIBuffer(void *tkPtr, const char *c_options, int *length)
+{
+    Toolkit *tk = static_cast<Toolkit *>(tkPtr);
+    tk->RenderToMIDIBuffer(tk->GetCBuffer());
+    *length = (int)tk->GetCBuffer().size();
+    return tk->GetCBuffer().data();
+}
+
 const char *vrvToolkit_renderToPAE(void *tkPtr)
 {
     Toolkit *tk = static_cast<Toolkit *>(tkPtr);
@@ -284,6 +354,14 @@ const char *vrvToolkit_renderToTimemap(void *tkPtr, const char *c_options)
     return tk->GetCString();
 }
 
+const unsigned char *vrvToolkit_renderToTimemapBuffer(void *tkPtr, const char *c_options, int *length)
+{
+    Toolkit *tk = static_cast<Toolkit *>(tkPtr);
+    tk->RenderToTimemapBuffer(tk->GetCBuffer(), c_options);
+    *length = (int)tk->GetCBuffer().size();
+    return tk->GetCBuffer().data();
+}
+
 void vrvToolkit_resetOptions(void *tkPtr)
 {
     Toolkit *tk = static_cast<Toolkit *>(tkPtr);
@@ -302,6 +380,12 @@ bool vrvToolkit_select(void *tkPtr, const char *selection)
     return tk->Select(selection);
 }
 
+void vrvToolkit_setLogCallbackUserData(void *tkPtr, void *userData)
+{
+    Toolkit *tk = static_cast<Toolkit *>(tkPtr);
+    tk->SetLogCallbackUserData(userData);
+}
+
 bool vrvToolkit_setOptions(void *tkPtr, const char *options)
 {
     Toolkit *tk = static_cast<Toolkit *>(tkPtr);
@@ -15,6 +15,7 @@ extern "C" {
 
 void enableLog(bool value);
 void enableLogToBuffer(bool value);
+void setLogCallback(void (*callback)(int level, const char *message, void *userData), void *userData);
 
 void *vrvToolkit_constructor();
 void *vrvToolkit_constructorResourcePath(const char *resourcePath);
@@ -25,7 +26,9 @@ const char *vrvToolkit_getAvailableOptions(void *tkPtr);
 const char *vrvToolkit_getDefaultOptions(void *tkPtr);
 const char *vrvToolkit_getDescriptiveFeatures(void *tkPtr, const char *options);
 const char *vrvToolkit_getElementAttr(void *tkPtr, const char *xmlId);
+const char *vrvToolkit_getElementsAttr(void *tkPtr, const char *c_query);
 const char *vrvToolkit_getElementsAtTime(void *tkPtr, int millisec);
+const char *vrvToolkit_getElementsInTimeRange(void *tkPtr, const char *options);
 const char *vrvToolkit_getExpansionIdsForElement(void *tkPtr, const char *xmlId);
 const char *vrvToolkit_getHumdrum(void *tkPtr);
 const char *vrvToolkit_convertHumdrumToHumdrum(void *tkPtr, const char *humdrumData);
@@ -34,12 +37,15 @@ const char *vrvToolkit_convertMEIToHumdrum(void *tkPtr, const char *meiData);
 const char *vrvToolkit_getLog(void *tkPtr);
 const char *vrvToolkit_getMEI(void *tkPtr, const char *options);
 const char *vrvToolkit_getMIDIValuesForElement(void *tkPtr, const char *xmlId);
+const char *vrvToolkit_getMIDIValuesForElements(void *tkPtr, const char *c_query);
 const char *vrvToolkit_getNotatedIdForElement(void *tkPtr, const char *xmlId);
 const char *vrvToolkit_getOptions(void *tkPtr);
 const char *vrvToolkit_getOptionUsageString(void *tkPtr);
 int vrvToolkit_getPageCount(void *tkPtr);
 int vrvToolkit_getPageWithElement(void *tkPtr, const char *xmlId);
+const char *vrvToolkit_getPagesWithElements(void *tkPtr, const char *c_query);
 double vrvToolkit_getTimeForElement(void *tkPtr, const char *xmlId);
+const char *vrvToolkit_getTimesForElements(void *tkPtr, const char *c_query);
 const char *vrvToolkit_getVersion(void *tkPtr);
 bool vrvToolkit_loadData(void *tkPtr, const char *data);
 bool vrvToolkit_loadZipDataBase64(void *tkPtr, const char *data);
@@ -47,14 +53,19 @@ bool vrvToolkit_loadZipDataBuffer(void *tkPtr, const unsigned char *data, int le
 void vrvToolkit_redoLayout(void *tkPtr, const char *c_options);
 void vrvToolkit_redoPagePitchPosLayout(void *tkPtr);
 const char *vrvToolkit_renderData(void *tkPtr, const char *data, const char *options);
+const char *vrvToolkit_renderPAEBatch(void *tkPtr, const char *records, const char *options);
+const char *vrvToolkit_renderPagesToSVG(void *tkPtr, int firstPageNo, int lastPageNo, bool xmlDeclaration);
 const char *vrvToolkit_renderToExpansionMap(void *tkPtr);
 const char *vrvToolkit_renderToMIDI(void *tkPtr, const char *c_options);
+const unsigned char *vrvToolkit_renderToMIDIBuffer(void *tkPtr, const char *c_options, int *length);
 const char *vrvToolkit_renderToPAE(void *tkPtr);
 const char *vrvToolkit_renderToSVG(void *tkPtr, int page_no, bool xmlDeclaration);
 const char *vrvToolkit_renderToTimemap(void *tkPtr, const char *c_options);
+const unsigned char *vrvToolkit_renderToTimemapBuffer(void *tkPtr, const char *c_options, int *length);
 void vrvToolkit_resetOptions(void *tkPtr);
 void vrvToolkit_resetXmlIdSeed(void *tkPtr, int seed);
 bool vrvToolkit_select(void *tkPtr, const char *selection);
+void vrvToolkit_setLogCallbackUserData(void *tkPtr, void *userData);
 bool vrvToolkit_setOptions(void *tkPtr, const char *options);
 const char *vrvToolkit_validatePAE(void *tkPtr, const char *data);
 
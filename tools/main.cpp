@@ -5,13 +5,19 @@
 // Copyright (c) Authors and others. All rights reserved.
 /////////////////////////////////////////////////////////////////////////////
 
+#include <atomic>
 #include <cassert>
+#include <chrono>
 #include <fstream>
 #include <iostream>
+#include <map>
+#include <memory>
+#include <mutex>
 #include <regex>
 #include <sstream>
 #include <string>
 #include <sys/stat.h>
+#include <thread>
 
 #ifndef _WIN32
 #include <getopt.h>
@@ -72,13 +78,97 @@ bool optionExists(const std::string &option, int argc, char **argv, std::string
     return false;
 }
 
+std::string mei_params(const std::string &outformat, int all_pages, int page, bool remove_ids)
+{
+    const char *scoreBased = (outformat == "mei-pb") ? "false" : "true";
+    const char *basic = (outformat == "mei-basic") ? "true" : "false";
+    const char *removeIds = (remove_ids) ? "true" : "false";
+    if (all_pages) {
+        return vrv::StringFormat("{'scoreBased': %s, 'basic': %s, 'removeIds': %s}", scoreBased, basic, removeIds);
+    }
+    return vrv::StringFormat(
+        "{'scoreBased': %s, 'basic': %s, 'pageNo': %d, 'removeIds': %s}", scoreBased, basic, page, removeIds);
+}
+
+// A JSON object on a single line (strings are escaped by jsonxx, so line breaks and tabs are only indentation)
+std::string json_line(const jsonxx::Object &object)
+{
+    std::string line = object.json();
+    line.erase(std::remove_if(line.begin(), line.end(), [](char c) { return (c == '\n') || (c == '\t'); }), line.end());
+    return line;
+}
+
+// Convert one file of a batch and fill the list of files written, or the error
+bool batch_convert(vrv::Toolkit &toolkit, const std::string &infile, const std::string &outfile,
+    const std::string &outformat, int all_pages, int page, std::vector<std::string> &outputs, std::string &error)
+{
+    // Seed the ids for each file so that the output does not depend on the batch
+    const int seed = toolkit.GetOptionsObj()->m_xmlIdSeed.GetValue();
+    if (seed != 0) vrv::Object::SeedID(seed);
+
+    if (!toolkit.LoadFile(infile)) {
+        error = "The file could not be loaded";
+        return false;
+    }
+    if (page > toolkit.GetPageCount()) {
+        error = vrv::StringFormat("The page requested (%d) is not in the page range", page);
+        return false;
+    }
+
+    std::string cur_outfile;
+    bool success = true;
+    if (outformat == "svg") {
+        const int to = (all_pages) ? toolkit.GetPageCount() + 1 : page + 1;
+        for (int p = page; p < to; ++p) {
+            cur_outfile = outfile + ((all_pages) ? vrv::StringFormat("_%03d", p) : "") + ".svg";
+            if (!toolkit.RenderToSVGFile(cur_outfile, p)) {
+                success = false;
+                break;
+            }
+            outputs.push_back(cur_outfile);
+        }
+    }
+    else if (outformat == "midi") {
+        cur_outfile = outfile + ".mid";
+        success = toolkit.RenderToMIDIFile(cur_outfile);
+        if (success) outputs.push_back(cur_outfile);
+    }
+    else if (outformat == "timemap") {
+        cur_outfile = outfile + ".json";
+        success = toolkit.RenderToTimemapFile(cur_outfile);
+        if (success) outputs.push_back(cur_outfile);
+    }
+    else if (outformat == "expansionmap") {
+        cur_outfile = outfile + "-em.json";
+        success = toolkit.RenderToExpansionMapFile(cur_outfile);
+        if (success) outputs.push_back(cur_outfile);
+    }
+    else if (outformat == "pae") {
+        cur_outfile = outfile + ".pae";
+        success = toolkit.RenderToPAEFile(cur_outfile);
+        if (success) outputs.push_back(cur_outfile);
+    }
+    else {
+        cur_outfile = outfile + ".mei";
+        success = toolkit.SaveFile(
+            cur_outfile, mei_params(outformat, all_pages, page, toolkit.GetOptionsObj()->m_removeIds.GetValue()));
+        if (success) outputs.push_back(cur_outfile);
+    }
+
+    if (!success) error = "Unable to write " + cur_outfile;
+    return success;
+}
+
 int main(int argc, char **argv)
 {
     std::string infile;
     std::string svgdir;
     std::string outfile;
     std::string outformat = "svg";
+    std::string informat;
     bool std_output = false;
+    bool pae_batch = false;
+    bool batch = false;
 
     int all_pages = 0;
     int page = 1;
@@ -103,6 +193,10 @@ int main(int argc, char **argv)
         { "xml-id-seed", required_argument, 0, 'x' }, //
         // standard input - long options only or - as filename
         { "stdin", no_argument, 0, 'z' }, //
+        // batch of PAE records, one per line - long options only
+        { "pae-batch", no_argument, 0, 'z' }, //
+        // batch of input files, one per line - long options only
+        { "batch", no_argument, 0, 'z' }, //
         { 0, 0, 0, 0 }
     };
 
@@ -187,6 +281,7 @@ int main(int argc, char **argv)
                 if (!toolkit.SetInputFrom(std::string(optarg))) {
                     exit(1);
                 };
+                informat = std::string(optarg);
                 break;
 
             case 'l': vrv::EnableLog(vrv::StrToLogLevel(std::string(optarg))); break;
@@ -221,6 +316,12 @@ int main(int argc, char **argv)
                 if (!strcmp(long_options[option_index].name, "stdin")) {
                     infile = "-";
                 }
+                else if (!strcmp(long_options[option_index].name, "pae-batch")) {
+                    pae_batch = true;
+                }
+                else if (!strcmp(long_options[option_index].name, "batch")) {
+                    batch = true;
+                }
                 break;
 
             case 'h':
@@ -288,6 +389,129 @@ int main(int argc, char **argv)
         exit(1);
     }
 
+    // Skip the layout for MIDI and timemap output by setting --breaks to none
+    if ((outformat == "midi") || (outformat == "timemap") || (outformat == "expansionmap")) {
+        toolkit.SetOptions("{'breaks': 'none'}");
+    }
+
+    // Convert each file listed in the input (one per line) with a pool of toolkits kept for the whole batch
+    if (batch) {
+        if (pae_batch || (outformat == "humdrum") || (outformat == "hum")) {
+            std::cerr << "Output format (" << outformat << ") or --pae-batch cannot be used with --batch." << std::endl;
+            exit(1);
+        }
+        // The output file is the directory where the files are written
+        std::string outdir = outfile;
+        if (outdir == "-") {
+            std::cerr << "Standard output cannot be used with --batch." << std::endl;
+            exit(1);
+        }
+        if (!outdir.empty() && !dir_exists(outdir)) {
+            std::cerr << "The output directory " << outdir << " could not be found." << std::endl;
+            exit(1);
+        }
+
+        std::ifstream instream;
+        if (infile != "-") {
+            instream.open(infile.c_str());
+            if (!instream.is_open()) {
+                std::cerr << "The file '" << infile << "' could not be opened." << std::endl;
+                exit(1);
+            }
+        }
+        std::istream &manifest = (infile == "-") ? std::cin : instream;
+        std::vector<std::string> files;
+        for (std::string line; std::getline(manifest, line);) {
+            size_t start = line.find_first_not_of(" \t\r");
+            if (start == std::string::npos) continue;
+            files.push_back(line.substr(start, line.find_last_not_of(" \t\r") - start + 1));
+        }
+        const int fileCount = (int)files.size();
+
+        // The output name of each file, without extension
+        // An entry with the same output name as a previous one (e.g., the same basename in another directory) fails
+        std::vector<std::string> outputNames;
+        std::vector<int> outputOwners;
+        std::map<std::string, int> owners;
+        for (int i = 0; i < fileCount; ++i) {
+            const std::string &file = files.at(i);
+            outputNames.push_back(
+                (outdir.empty()) ? removeExtension(file) : outdir + "/" + removeExtension(basename(file)));
+            outputOwners.push_back(owners.insert({ outputNames.back(), i }).first->second);
+        }
+
+        const int threadCount = std::min(vrv::GetThreadCount(options->m_threads.GetValue()), std::max(fileCount, 1));
+
+        // Each worker has its own toolkit with the options of the command line and converts one file at a time
+        const std::string toolkitOptions = toolkit.GetOptions();
+        std::vector<std::unique_ptr<vrv::Toolkit>> workers;
+        for (int i = 0; i < threadCount; ++i) {
+            workers.push_back(std::make_unique<vrv::Toolkit>(false));
+            workers.back()->SetResourcePath(resourcePath);
+            workers.back()->SetOptions(toolkitOptions);
+            workers.back()->GetOptionsObj()->m_threads.SetValue(1);
+            if (!informat.empty()) workers.back()->SetInputFrom(informat);
+            workers.back()->SetOutputTo(outformat);
+        }
+
+        std::atomic<int> nextFile = 0;
+        std::mutex reportMutex;
+        int failed = 0;
+        auto convertFiles = [&](int threadIdx) {
+            vrv::Toolkit *worker = workers.at(threadIdx).get();
+            for (int i = nextFile++; i < fileCount; i = nextFile++) {
+                const std::string &file = files.at(i);
+                const std::string &cur_outfile = outputNames.at(i);
+                std::vector<std::string> outputs;
+                std::string error;
+                auto start = std::chrono::steady_clock::now();
+                bool success = false;
+                if (outputOwners.at(i) != i) {
+                    error = "The output " + cur_outfile + " is already written for " + files.at(outputOwners.at(i));
+                }
+                else {
+                    success = batch_convert(*worker, file, cur_outfile, outformat, all_pages, page, outputs, error);
+                }
+                std::chrono::duration<double, std::milli> time = std::chrono::steady_clock::now() - start;
+
+                // One JSON object per line and per file, in the order of completion
+                jsonxx::Object report;
+                report << "input" << file;
+                report << "success" << success;
+                jsonxx::Array outputArray;
+                for (const std::string &output : outputs) outputArray << output;
+                report << "output" << outputArray;
+                if (!success) report << "error" << error;
+                jsonxx::Value milliseconds(time.count());
+                milliseconds.precision_ = 3;
+                report << "time" << milliseconds;
+                const std::lock_guard<std::mutex> lock(reportMutex);
+                std::cout << json_line(report) << std::endl;
+                if (!success) ++failed;
+            }
+        };
+
+        // The main thread converts files too
+        std::vector<std::thread> threads;
+        for (int threadIdx = 1; threadIdx < threadCount; ++threadIdx) {
+            try {
+                threads.emplace_back(convertFiles, threadIdx);
+            }
+            catch (const std::system_error &error) {
+                vrv::LogWarning("Thread for converting files could not be started (%s)", error.what());
+                break;
+            }
+        }
+        convertFiles(0);
+        for (std::thread &thread : threads) {
+            thread.join();
+        }
+        std::cerr << fileCount - failed << " of " << fileCount << " file(s) converted." << std::endl;
+
+        free(long_options);
+        return (failed > 0) ? 1 : 0;
+    }
+
     // Make sure we provide a file name or output to std output with std input
     if ((infile == "-") && (outfile.empty())) {
         std::cerr << "Standard input can be used only with standard output or output filename." << std::endl;
@@ -306,9 +530,57 @@ int main(int argc, char **argv)
         outfile = removeExtension(outfile);
     }
 
-    // Skip the layout for MIDI and timemap output by setting --breaks to none
-    if ((outformat == "midi") || (outformat == "timemap") || (outformat == "expansionmap")) {
-        toolkit.SetOptions("{'breaks': 'none'}");
+    // Render each PAE record of the input to its own file (or to a JSON array on the std output)
+    if (pae_batch) {
+        if ((outformat != "svg") && (outformat != "mei")) {
+            std::cerr << "Output format (" << outformat << ") can only be 'svg' or 'mei' with --pae-batch."
+                      << std::endl;
+            exit(1);
+        }
+        std::ifstream instream;
+        if (infile != "-") {
+            instream.open(infile.c_str());
+            if (!instream.is_open()) {
+                std::cerr << "The file '" << infile << "' could not be opened." << std::endl;
+                exit(1);
+            }
+        }
+        std::istream &records = (infile == "-") ? std::cin : instream;
+
+        const bool includeMEI = (outformat == "mei");
+        int invalid = 0;
+        int n = 0;
+        auto writeRecord = [&](const vrv::PAEBatchRecord &record) {
+            ++n;
+            if (!record.m_valid) {
+                std::cerr << "Record " << n << " (" << record.m_id << ") could not be loaded." << std::endl;
+                ++invalid;
+            }
+            if (std_output) {
+                jsonxx::Object o;
+                o << "id" << record.m_id;
+                o << "valid" << record.m_valid;
+                o << ((includeMEI) ? "mei" : "svg") << ((includeMEI) ? record.m_mei : record.m_svg);
+                std::cout << ((n == 1) ? "[\n" : ",\n") << o.json();
+                return;
+            }
+            if (!record.m_valid) return;
+            std::string cur_outfile = outfile + vrv::StringFormat("_%03d", n) + ((includeMEI) ? ".mei" : ".svg");
+            std::ofstream outstream(cur_outfile.c_str());
+            if (!outstream.is_open()) {
+                std::cerr << "Unable to write output to " << cur_outfile << "." << std::endl;
+                ++invalid;
+                return;
+            }
+            outstream << ((includeMEI) ? record.m_mei : record.m_svg);
+            outstream.close();
+        };
+        int count = toolkit.RenderPAEBatchStream(records, writeRecord, includeMEI);
+        if (std_output) std::cout << ((count == 0) ? "[" : "") << "]" << std::endl;
+        std::cerr << count - invalid << " of " << count << " record(s) rendered." << std::endl;
+
+        free(long_options);
+        return (invalid > 0) ? 1 : 0;
     }
 
     // Load the std input or load the file
@@ -350,7 +622,27 @@ int main(int argc, char **argv)
         to = toolkit.GetPageCount() + 1;
     }
 
-    if (outformat == "svg") {
+    if ((outformat == "svg") && all_pages) {
+        // Render all the pages at once for drawing them concurrently
+        std::vector<std::string> output = toolkit.RenderPagesToSVG(from, to - 1, !std_output);
+        for (int p = from; p < to; ++p) {
+            if (std_output) {
+                std::cout << output.at(p - from);
+                continue;
+            }
+            std::string cur_outfile = outfile + vrv::StringFormat("_%03d", p) + ".svg";
+            std::ofstream outstream(cur_outfile.c_str());
+            if (!outstream.is_open()) {
+                std::cerr << "Unable to write SVG to " << cur_outfile << "." << std::endl;
+                exit(1);
+            }
+            outstream << output.at(p - from);
+            outstream.close();
+            std::cerr << "Output written to " << cur_outfile << "." << std::endl;
+        }
+    }
+
+    else if (outformat == "svg") {
         int p;
         for (p = from; p < to; ++p) {
             std::string cur_outfile = outfile;
@@ -550,13 +842,9 @@ int main(int argc, char **argv)
         }
     }
     else {
-        const char *scoreBased = (outformat == "mei-pb") ? "false" : "true";
-        const char *basic = (outformat == "mei-basic") ? "true" : "false";
-        const char *removeIds = (options->m_removeIds.GetValue()) ? "true" : "false";
+        std::string params = mei_params(outformat, all_pages, page, options->m_removeIds.GetValue());
         outfile += ".mei";
         if (all_pages) {
-            std::string params
-                = vrv::StringFormat("{'scoreBased': %s, 'basic': %s, 'removeIds': %s}", scoreBased, basic, removeIds);
             if (std_output) {
                 std::string output;
                 std::cout << toolkit.GetMEI(params);
@@ -569,8 +857,6 @@ int main(int argc, char **argv)
             }
         }
         else {
-            std::string params = vrv::StringFormat(
-                "{'scoreBased': %s, 'basic': %s, 'pageNo': %d, 'removeIds': %s}", scoreBased, basic, page, removeIds);
             if (std_output) {
                 std::cout << toolkit.GetMEI(params);
             }